@@ -2,11 +2,65 @@
 #include "GameFramework/RHGameEngine.h"
 #include "GameFramework/RHRuntimeTelemetryCollector.h"
 #include "UnrealEngine.h"
+#include "GameFramework/GameModeBase.h"
+#include "IO/IoDispatcher.h"
+#include "UObject/Package.h"
 
 #include "RH_GameInstanceSessionSubsystem.h"
 
+void FRHMapLoadTimeline::Reset()
+{
+    MapName.Empty();
+    StartTimeSeconds = 0.0;
+    for (double& PhaseTime : PhaseTimes)
+    {
+        PhaseTime = -1.0;
+    }
+    StartMemoryBytes = 0;
+    PeakMemoryBytes = 0;
+    PackagesLoaded = 0;
+    PackageBytesLoaded = 0;
+}
+
+void FRHMapLoadTimeline::MarkPhase(ERHMapLoadPhase Phase)
+{
+    if (Phase == ERHMapLoadPhase::TravelStart)
+    {
+        StartTimeSeconds = FPlatformTime::Seconds();
+        StartMemoryBytes = FPlatformMemory::GetStats().UsedPhysical;
+    }
+
+    // only the first occurrence of each phase is recorded
+    if (!HasReachedPhase(Phase))
+    {
+        PhaseTimes[(int32)Phase] = FPlatformTime::Seconds() - StartTimeSeconds;
+    }
+
+    SampleMemory();
+}
+
+void FRHMapLoadTimeline::SampleMemory()
+{
+    PeakMemoryBytes = FMath::Max<uint64>(PeakMemoryBytes, FPlatformMemory::GetStats().UsedPhysical);
+}
+
+const TCHAR* FRHMapLoadTimeline::GetPhaseName(ERHMapLoadPhase Phase)
+{
+    switch (Phase)
+    {
+    case ERHMapLoadPhase::TravelStart: return TEXT("TravelStart");
+    case ERHMapLoadPhase::PackageLoad: return TEXT("PackageLoad");
+    case ERHMapLoadPhase::WorldInit: return TEXT("WorldInit");
+    case ERHMapLoadPhase::GameModeInitGame: return TEXT("GameModeInitGame");
+    case ERHMapLoadPhase::FirstFrame: return TEXT("FirstFrame");
+    case ERHMapLoadPhase::FirstPlayerLogin: return TEXT("FirstPlayerLogin");
+    default: return TEXT("Unknown");
+    }
+}
+
 URHGameEngine::URHGameEngine(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , bIsTrackingMapLoad(false)
 {
 }
 
@@ -15,6 +69,11 @@ void URHGameEngine::Init(class IEngineLoop* InEngineLoop)
     Super::Init(InEngineLoop);
 
     FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &URHGameEngine::OnPostLoadMapWithWorld);
+    FCoreUObjectDelegates::OnEndLoadPackage.AddUObject(this, &URHGameEngine::OnEndLoadPackage);
+    FWorldDelegates::OnPreWorldInitialization.AddUObject(this, &URHGameEngine::OnPreWorldInitialization);
+    FWorldDelegates::OnPostWorldInitialization.AddUObject(this, &URHGameEngine::OnPostWorldInitialization);
+    FGameModeEvents::OnGameModeInitializedEvent().AddUObject(this, &URHGameEngine::OnGameModeInitialized);
+    FGameModeEvents::OnGameModePostLoginEvent().AddUObject(this, &URHGameEngine::OnGameModePostLogin);
 }
 
 void URHGameEngine::OnPostLoadMapWithWorld(UWorld* pLoadedWorld)
@@ -25,6 +84,91 @@ void URHGameEngine::OnPostLoadMapWithWorld(UWorld* pLoadedWorld)
     }
 }
 
+void URHGameEngine::OnPreWorldInitialization(UWorld* pWorld, const UWorld::InitializationValues IVS)
+{
+    // The world package has finished loading by the time it is initialized
+    if (bIsTrackingMapLoad && pWorld != nullptr && pWorld->IsGameWorld())
+    {
+        MarkMapLoadPhase(ERHMapLoadPhase::PackageLoad);
+    }
+}
+
+void URHGameEngine::OnPostWorldInitialization(UWorld* pWorld, const UWorld::InitializationValues IVS)
+{
+    if (bIsTrackingMapLoad && pWorld != nullptr && pWorld->IsGameWorld())
+    {
+        MarkMapLoadPhase(ERHMapLoadPhase::WorldInit);
+    }
+}
+
+void URHGameEngine::OnGameModeInitialized(AGameModeBase* pGameMode)
+{
+    if (bIsTrackingMapLoad)
+    {
+        MarkMapLoadPhase(ERHMapLoadPhase::GameModeInitGame);
+    }
+}
+
+void URHGameEngine::OnGameModePostLogin(AGameModeBase* pGameMode, APlayerController* pNewPlayer)
+{
+    // Players usually arrive after the load itself is done, so this is tracked for as long as the timeline is current
+    if (MapLoadTimeline.HasReachedPhase(ERHMapLoadPhase::TravelStart) && !MapLoadTimeline.HasReachedPhase(ERHMapLoadPhase::FirstPlayerLogin))
+    {
+        MarkMapLoadPhase(ERHMapLoadPhase::FirstPlayerLogin);
+    }
+}
+
+void URHGameEngine::OnEndLoadPackage(const FEndLoadPackageContext& Context)
+{
+    if (!bIsTrackingMapLoad)
+    {
+        return;
+    }
+
+    for (const UPackage* pPackage : Context.LoadedPackages)
+    {
+        if (pPackage == nullptr)
+        {
+            continue;
+        }
+
+        ++MapLoadTimeline.PackagesLoaded;
+
+#if WITH_EDITORONLY_DATA
+        MapLoadTimeline.PackageBytesLoaded += FMath::Max<int64>(pPackage->GetFileSize(), 0);
+#else
+        if (FIoDispatcher::IsInitialized())
+        {
+            const FIoChunkId ChunkId = CreateIoChunkId(FPackageId::FromName(pPackage->GetFName()).Value(), 0, EIoChunkType::ExportBundleData);
+            TIoStatusOr<uint64> ChunkSize = FIoDispatcher::Get().GetSizeForChunk(ChunkId);
+            if (ChunkSize.IsOk())
+            {
+                MapLoadTimeline.PackageBytesLoaded += ChunkSize.ValueOrDie();
+            }
+        }
+#endif
+    }
+
+    MapLoadTimeline.SampleMemory();
+}
+
+void URHGameEngine::MarkMapLoadPhase(ERHMapLoadPhase Phase)
+{
+    if (MapLoadTimeline.HasReachedPhase(Phase))
+    {
+        return;
+    }
+
+    MapLoadTimeline.MarkPhase(Phase);
+
+    UE_LOG(RallyHereStart, Log, TEXT("Map load of %s reached %s after %.3f s"), *MapLoadTimeline.MapName, FRHMapLoadTimeline::GetPhaseName(Phase), MapLoadTimeline.GetPhaseTime(Phase));
+
+    if (RuntimeTelemetryCollector.IsValid() && (Phase == ERHMapLoadPhase::FirstFrame || Phase == ERHMapLoadPhase::FirstPlayerLogin))
+    {
+        RuntimeTelemetryCollector->RecordMapLoadTimeline(MapLoadTimeline);
+    }
+}
+
 void URHGameEngine::CreateRuntimeTelemetryCollector(UWorld* pWorld)
 {
 	FString TelemetryId = pWorld->URL.GetOption(RH_SESSION_PARAMETER_NAME, TEXT(""));
@@ -62,16 +206,35 @@ bool URHGameEngine::LoadMap(FWorldContext &WorldContext, FURL URL, class UPendin
         RuntimeTelemetryCollector = nullptr;
     }
 
+    MapLoadTimeline.Reset();
+    MapLoadTimeline.MapName = URL.Map;
+    bIsTrackingMapLoad = true;
+    MarkMapLoadPhase(ERHMapLoadPhase::TravelStart);
+
     bool bSuccess = Super::LoadMap(WorldContext, URL, Pending, Error);
 
+    if (!bSuccess)
+    {
+        bIsTrackingMapLoad = false;
+    }
+
     return bSuccess;
 }
 
 
 void URHGameEngine::Tick(float DeltaSeconds, bool bIdleMode)
 {
+    // LoadMap runs inside the engine tick, so the first full frame of a new map is the tick after it
+    const bool bIsFirstFrameAfterLoad = bIsTrackingMapLoad;
+
     Super::Tick(DeltaSeconds, bIdleMode);
 
+    if (bIsFirstFrameAfterLoad && bIsTrackingMapLoad)
+    {
+        bIsTrackingMapLoad = false;
+        MarkMapLoadPhase(ERHMapLoadPhase::FirstFrame);
+    }
+
     if (RuntimeTelemetryCollector.IsValid())
     {
         RuntimeTelemetryCollector->Tick(DeltaSeconds);
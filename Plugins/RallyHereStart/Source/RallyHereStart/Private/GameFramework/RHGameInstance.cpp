@@ -12,6 +12,7 @@
 #include "Managers/RHPushNotificationManager.h"
 #include "Managers/RHStoreItemHelper.h"
 #include "GameFramework/RHGameModeBase.h"
+#include "GameFramework/RHGameUserSettings.h"
 #include "Misc/CoreDelegates.h"
 #include "PlatformInventoryItem/PlatformStoreAsset.h"
 #include "DeviceProfiles/DeviceProfileManager.h"
@@ -154,6 +155,12 @@ void URHGameInstance::Shutdown()
 {
 	UPlayerExperienceGlobals::Get().UninitGlobalData(this);
 
+	// Settings saves are deferred, make sure the last ones land before we go away
+	if (URHGameUserSettings* pGameSettings = Cast<URHGameUserSettings>(GEngine->GetGameUserSettings()))
+	{
+		pGameSettings->FlushPendingSave();
+	}
+
     Super::Shutdown();
 
     if (StoreItemHelper)
@@ -557,6 +564,12 @@ void URHGameInstance::AppSuspendCallbackInGameThread()
 {
     UE_LOG(LogOnlineGame, Log, TEXT("URHGameInstance::AppSuspendCallbackInGameThread()"));
 
+	// The app may never resume, so write any deferred settings save now
+	if (URHGameUserSettings* pGameSettings = Cast<URHGameUserSettings>(GEngine->GetGameUserSettings()))
+	{
+		pGameSettings->FlushPendingSave();
+	}
+
 	// On Xbox, this is called when the player kills the game via their dashboard overlay
     if (bLogoffOnAppSuspend)
     {
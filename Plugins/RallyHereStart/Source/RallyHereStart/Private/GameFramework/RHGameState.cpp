@@ -1,6 +1,7 @@
 #include "RallyHereStart.h"
 #include "GameFramework/RHGameState.h"
 #include "Player/Controllers/RHPlayerController.h"
+#include "Player/Controllers/RHPlayerState.h"
 #include "GameFramework/PlayerState.h"
 
 ARHGameState::ARHGameState(const FObjectInitializer& ObjectInitializer)
@@ -12,6 +13,11 @@ void ARHGameState::AddPlayerState(APlayerState* PlayerState)
 {
     Super::AddPlayerState(PlayerState);
 
+    if (PlayerState != nullptr)
+    {
+        SetIsHumanPlayer(PlayerState, !PlayerState->IsInactive() && !PlayerState->IsABot());
+    }
+
     if (UWorld* CurWorld = GetWorld())
     {
         for (FConstPlayerControllerIterator Iterator = CurWorld->GetPlayerControllerIterator(); Iterator; ++Iterator)
@@ -29,6 +35,8 @@ void ARHGameState::RemovePlayerState(APlayerState* PlayerState)
 {
     Super::RemovePlayerState(PlayerState);
 
+    SetIsHumanPlayer(PlayerState, false);
+
     if (UWorld* CurWorld = GetWorld())
     {
         for (FConstPlayerControllerIterator Iterator = CurWorld->GetPlayerControllerIterator(); Iterator; ++Iterator)
@@ -40,4 +48,50 @@ void ARHGameState::RemovePlayerState(APlayerState* PlayerState)
             }
         }
     }
-}
\ No newline at end of file
+}
+
+void ARHGameState::RefreshHumanPlayer(APlayerState* PlayerState)
+{
+    if (IsValid(PlayerState) && !PlayerState->IsActorBeingDestroyed())
+    {
+        // Only player states this game state has added can count, a refresh must not add one that was never added or already removed
+        SetIsHumanPlayer(PlayerState, PlayerArray.Contains(PlayerState) && !PlayerState->IsInactive() && !PlayerState->IsABot());
+    }
+}
+
+void ARHGameState::SetIsHumanPlayer(APlayerState* PlayerState, bool bIsHuman)
+{
+    const bool bWasUsingMultiplayerFeatures = IsUsingMultiplayerFeatures();
+
+    if (bIsHuman)
+    {
+        HumanPlayers.Add(PlayerState);
+    }
+    else
+    {
+        HumanPlayers.Remove(PlayerState);
+    }
+
+    if (bWasUsingMultiplayerFeatures != IsUsingMultiplayerFeatures())
+    {
+        OnUsingMultiplayerFeaturesChanged();
+    }
+}
+
+void ARHGameState::OnUsingMultiplayerFeaturesChanged()
+{
+    if (UWorld* CurWorld = GetWorld())
+    {
+        for (FConstPlayerControllerIterator Iterator = CurWorld->GetPlayerControllerIterator(); Iterator; ++Iterator)
+        {
+            APlayerController* PlayerController = Iterator->Get();
+            if (PlayerController != nullptr && PlayerController->IsLocalController())
+            {
+                if (ARHPlayerState* RHPlayerState = PlayerController->GetPlayerState<ARHPlayerState>())
+                {
+                    RHPlayerState->UpdateMultiplayerFeaturesForOSS();
+                }
+            }
+        }
+    }
+}
@@ -11,6 +11,7 @@
 #include "DeviceProfiles/DeviceProfileManager.h"
 #include "DynamicRHI.h"
 #include "Widgets/Layout/SSafeZone.h"
+#include "Async/Async.h"
 #if (defined(PLATFORM_PS4) && PLATFORM_PS4) || (defined(PLATFORM_PS5) && PLATFORM_PS5)
 #include <system_service.h>
 #endif
@@ -22,6 +23,12 @@
 #include "Framework/Application/SlateApplication.h"
 #endif
 
+namespace
+{
+	// Settings changes tend to come in bursts (menus, store and media screens), so hold writes briefly to batch them
+	const float SaveDebounceSeconds = 2.f;
+}
+
 const FName URHGameUserSettings::MasterSoundVolume(TEXT("MasterSoundVolume"));
 const FName URHGameUserSettings::MusicSoundVolume(TEXT("MusicSoundVolume"));
 const FName URHGameUserSettings::SFXSoundVolume(TEXT("SFXSoundVolume"));
@@ -130,6 +137,10 @@ URHGameUserSettings::URHGameUserSettings(const FObjectInitializer& ObjectInitial
 	: Super(ObjectInitializer)
 {
 	bIsLoading = false;
+	bSavePending = false;
+	bSlotWriteQueued = false;
+	SlotWriteSerial = 0;
+	NumCoalescedSaves = 0;
 
 	bSettingGlobalQuality = false;
 
@@ -251,6 +262,9 @@ void URHGameUserSettings::ApplySavedSettings()
 
 void URHGameUserSettings::LoadSettings(bool bForceReload /* = false*/)
 {
+	// Loading replaces the in memory settings, so persist anything still waiting on the debounce first
+	FlushPendingSave();
+
 	bIsLoading = true;
 
     Super::LoadSettings(bForceReload);
@@ -272,17 +286,91 @@ void URHGameUserSettings::LoadSettings(bool bForceReload /* = false*/)
 
 void URHGameUserSettings::SaveSettings()
 {
+	if (bSavePending)
+	{
+		++NumCoalescedSaves;
+		return;
+	}
+
+	// Without the engine ticking there is nothing to flush a deferred save, so write it straight away
+	if (HasAnyFlags(RF_ClassDefaultObject) || IsEngineExitRequested())
+	{
+		WriteSettings(true);
+		return;
+	}
+
+	bSavePending = true;
+	SaveDebounceHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &URHGameUserSettings::HandleSaveDebounceElapsed), SaveDebounceSeconds);
+}
+
+bool URHGameUserSettings::HandleSaveDebounceElapsed(float DeltaTime)
+{
+	SaveDebounceHandle.Reset();
+
+	if (bSavePending)
+	{
+		WriteSettings(false);
+	}
+
+	// One shot, the next save request registers a new ticker
+	return false;
+}
+
+void URHGameUserSettings::FlushPendingSave()
+{
+	// The completion of an in flight slot write needs the game thread to tick, which won't happen on shutdown or suspend, so wait on it here
+	WaitForSlotWrite();
+
+	if (bSavePending || bSlotWriteQueued)
+	{
+		WriteSettings(true);
+	}
+}
+
+void URHGameUserSettings::WaitForSlotWrite()
+{
+	if (SlotWriteResult.IsValid())
+	{
+		if (!SlotWriteResult.Get())
+		{
+			UE_LOG(RallyHereStart, Warning, TEXT("URHGameUserSettings::WaitForSlotWrite - failed to write settings to the save game slot"));
+		}
+
+		SlotWriteResult.Reset();
+		++SlotWriteSerial;
+	}
+}
+
+void URHGameUserSettings::WriteSettings(bool bWaitForWrite)
+{
+	if (SaveDebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SaveDebounceHandle);
+		SaveDebounceHandle.Reset();
+	}
+
+	bSavePending = false;
+
 	Super::SaveSettings();
-	SaveSaveGameConfig();
+	SaveSaveGameConfig(bWaitForWrite);
 }
 
-bool URHGameUserSettings::LoadSaveGameConfig()
+bool URHGameUserSettings::GetSaveGameSlot(FString& OutSlotName, int32& OutUserIndex) const
 {
+#if WITH_DEV_AUTOMATION_TESTS
+	if (!TestSaveGameSlotName.IsEmpty())
+	{
+		OutSlotName = TestSaveGameSlotName;
+		OutUserIndex = 0;
+		return true;
+	}
+#endif
+
 	const FString PlatformName = UGameplayStatics::GetPlatformName();
 	if (PlatformName == TEXT("XboxOne") || PlatformName == TEXT("XSX") || PlatformName == TEXT("PS4") || PlatformName == TEXT("PS5") || PlatformName == TEXT("Switch"))
 	{
-		FString SaveGameSlotName = GetClass()->GetName();
-		int32 SaveGameUserIndex = 0;
+		OutSlotName = GetClass()->GetName();
+		OutUserIndex = 0;
 
 		auto Identity = Online::GetIdentityInterface();
 		if (UWorld* const World = GWorld)
@@ -292,11 +380,26 @@ bool URHGameUserSettings::LoadSaveGameConfig()
 				const auto PlayerId = LocalPlayer->GetPreferredUniqueNetId();
 				if (Identity.IsValid() && PlayerId.IsValid())
 				{
-					SaveGameUserIndex = Identity->GetPlatformUserIdFromUniqueNetId(*PlayerId);
+					OutUserIndex = Identity->GetPlatformUserIdFromUniqueNetId(*PlayerId);
 				}
 			}
 		}
-		
+
+		return true;
+	}
+
+	return false;
+}
+
+bool URHGameUserSettings::LoadSaveGameConfig()
+{
+	FString SaveGameSlotName;
+	int32 SaveGameUserIndex = 0;
+	if (GetSaveGameSlot(SaveGameSlotName, SaveGameUserIndex))
+	{
+		// Read back the latest settings, and never while a worker is still writing the slot
+		FlushPendingSave();
+
 		if (UGameplayStatics::DoesSaveGameExist(SaveGameSlotName, SaveGameUserIndex))
 		{
 			if (URHSettingsSaveGame* const pSaveGame = Cast<URHSettingsSaveGame>(UGameplayStatics::LoadGameFromSlot(SaveGameSlotName, SaveGameUserIndex)))
@@ -327,49 +430,95 @@ bool URHGameUserSettings::LoadSaveGameConfig()
 	return false;
 }
 
-bool URHGameUserSettings::SaveSaveGameConfig()
+URHSettingsSaveGame* URHGameUserSettings::CreateSaveGameSnapshot() const
 {
-	const FString PlatformName = UGameplayStatics::GetPlatformName();
-	if (PlatformName == TEXT("XboxOne") || PlatformName == TEXT("XSX") || PlatformName == TEXT("PS4") || PlatformName == TEXT("PS5") || PlatformName == TEXT("Switch"))
+	if (URHSettingsSaveGame* const pSaveGame = Cast<URHSettingsSaveGame>(UGameplayStatics::CreateSaveGameObject(URHSettingsSaveGame::StaticClass())))
 	{
-		const FString SaveGameSlotName = GetClass()->GetName();
-		int32 SaveGameUserIndex = 0;
-
-		auto Identity = Online::GetIdentityInterface();
-		if (UWorld* const World = GWorld)
+		// Only write the allowed settings to the profile
+		if (URHGameUserSettingsDefault* const DefaultUserSettings = Cast<URHGameUserSettingsDefault>(URHGameUserSettingsDefault::StaticClass()->GetDefaultObject()))
 		{
-			if (ULocalPlayer* const LocalPlayer = World->GetFirstLocalPlayerFromController())
+			pSaveGame->SavedSettingsConfig.Empty();
+			for (const TPair<FName, FString>& SavedSettingConfig : SavedSettingsConfig)
 			{
-				const auto PlayerId = LocalPlayer->GetPreferredUniqueNetId();
-				if (Identity.IsValid() && PlayerId.IsValid())
-				{
-					SaveGameUserIndex = Identity->GetPlatformUserIdFromUniqueNetId(*PlayerId);
-				}
+				pSaveGame->SavedSettingsConfig.Add(SavedSettingConfig.Key, SavedSettingConfig.Value);
 			}
 		}
-		if (URHSettingsSaveGame* const pSaveGame = Cast<URHSettingsSaveGame>(UGameplayStatics::CreateSaveGameObject(URHSettingsSaveGame::StaticClass())))
+
+		pSaveGame->SavedDisplayLanguage = SavedDisplayLanguage;
+		pSaveGame->SavedLocalActions = SavedLocalActions;
+		pSaveGame->SavedSelectedRegion = SavedSelectedRegion;
+		pSaveGame->LastWhatsNewVersion = LastWhatsNewVersion;
+		pSaveGame->SavedTransientOrderIds = SavedTransientOrderIds;
+		pSaveGame->SavedViewedNewsPanelIds = SavedViewedNewsPanelIds;
+		pSaveGame->SavedRecentlySeenStoreItemLootIds = SavedRecentlySeenStoreItemLootIds;
+		pSaveGame->SavedSeenAcquiredItemIds = SavedSeenAcquiredItemIds;
+
+		return pSaveGame;
+	}
+
+	return nullptr;
+}
+
+bool URHGameUserSettings::SerializeSaveGameSnapshot(TArray<uint8>& OutSaveData) const
+{
+	FString SaveGameSlotName;
+	int32 SaveGameUserIndex = 0;
+	if (!GetSaveGameSlot(SaveGameSlotName, SaveGameUserIndex))
+	{
+		return false;
+	}
+
+	URHSettingsSaveGame* const pSaveGame = CreateSaveGameSnapshot();
+	return pSaveGame != nullptr && UGameplayStatics::SaveGameToMemory(pSaveGame, OutSaveData);
+}
+
+bool URHGameUserSettings::SaveSaveGameConfig(bool bWaitForWrite /* = false*/)
+{
+	FString SaveGameSlotName;
+	int32 SaveGameUserIndex = 0;
+	if (GetSaveGameSlot(SaveGameSlotName, SaveGameUserIndex))
+	{
+		if (bWaitForWrite)
 		{
-			// Only write the allowed settings to the profile
-			if (URHGameUserSettingsDefault* const DefaultUserSettings = Cast<URHGameUserSettingsDefault>(URHGameUserSettingsDefault::StaticClass()->GetDefaultObject()))
-			{
-				pSaveGame->SavedSettingsConfig.Empty();
-				for (const TPair<FName, FString>& SavedSettingConfig : SavedSettingsConfig)
-				{
-					pSaveGame->SavedSettingsConfig.Add(SavedSettingConfig.Key, SavedSettingConfig.Value);
-				}
-			}
+			// The write in flight holds older settings, let it finish so this write is the one left in the slot
+			WaitForSlotWrite();
+			bSlotWriteQueued = false;
 
-			pSaveGame->SavedDisplayLanguage = SavedDisplayLanguage;
-			pSaveGame->SavedLocalActions = SavedLocalActions;
-			pSaveGame->SavedSelectedRegion = SavedSelectedRegion;
-			pSaveGame->LastWhatsNewVersion = LastWhatsNewVersion;
-			pSaveGame->SavedTransientOrderIds = SavedTransientOrderIds;
-			pSaveGame->SavedViewedNewsPanelIds = SavedViewedNewsPanelIds;
-			pSaveGame->SavedRecentlySeenStoreItemLootIds = SavedRecentlySeenStoreItemLootIds;
-			pSaveGame->SavedSeenAcquiredItemIds = SavedSeenAcquiredItemIds;
+			URHSettingsSaveGame* const pSaveGame = CreateSaveGameSnapshot();
+			return pSaveGame != nullptr && UGameplayStatics::SaveGameToSlot(pSaveGame, SaveGameSlotName, SaveGameUserIndex);
+		}
+
+		if (SlotWriteResult.IsValid())
+		{
+			// Never block on the write in flight, chain another write once it lands
+			bSlotWriteQueued = true;
+			return true;
+		}
 
-			return UGameplayStatics::SaveGameToSlot(pSaveGame, SaveGameSlotName, SaveGameUserIndex);
+		// Serialize the snapshot on the game thread, only the file write happens on the worker
+		TArray<uint8> SaveData;
+		if (!SerializeSaveGameSnapshot(SaveData))
+		{
+			return false;
 		}
+
+		const int32 WriteSerial = ++SlotWriteSerial;
+		TWeakObjectPtr<URHGameUserSettings> WeakThis(this);
+		SlotWriteResult = Async(EAsyncExecution::ThreadPool, [SaveData = MoveTemp(SaveData), SaveGameSlotName, SaveGameUserIndex, WriteSerial, WeakThis]()
+			{
+				const bool bSuccess = UGameplayStatics::SaveDataToSlot(SaveData, SaveGameSlotName, SaveGameUserIndex);
+
+				AsyncTask(ENamedThreads::GameThread, [WriteSerial, bSuccess, WeakThis]()
+					{
+						if (URHGameUserSettings* const pSettings = WeakThis.Get())
+						{
+							pSettings->HandleSlotWriteComplete(WriteSerial, bSuccess);
+						}
+					});
+
+				return bSuccess;
+			});
+		return true;
 	}
 	else
 	{
@@ -379,6 +528,29 @@ bool URHGameUserSettings::SaveSaveGameConfig()
     return false;
 }
 
+void URHGameUserSettings::HandleSlotWriteComplete(int32 WriteSerial, bool bSuccess)
+{
+	// Already waited on by a flush, which also wrote anything that was chained after it
+	if (WriteSerial != SlotWriteSerial || !SlotWriteResult.IsValid())
+	{
+		return;
+	}
+
+	SlotWriteResult.Reset();
+
+	if (!bSuccess)
+	{
+		UE_LOG(RallyHereStart, Warning, TEXT("URHGameUserSettings::HandleSlotWriteComplete - failed to write settings to the save game slot"));
+	}
+
+	// Settings changed while the write was in flight, write them out now
+	if (bSlotWriteQueued)
+	{
+		bSlotWriteQueued = false;
+		SaveSaveGameConfig(false);
+	}
+}
+
 bool URHGameUserSettings::GetDefaultSettingAsBool(const FName& Name, bool& OutBool) const
 {
 	const FCachedSettingValue* ValuePtr = DefaultSettingsConfig.Find(Name);
@@ -520,6 +692,27 @@ void URHGameUserSettings::SaveLocalAction(const FName& Name)
 	SaveSettings();
 }
 
+void URHGameUserSettings::SaveLocalActions(const TArray<FName>& Names)
+{
+	bool bAnyAdded = false;
+	for (const FName& Name : Names)
+	{
+		bool bAlreadySaved = false;
+		SavedLocalActions.Add(Name, &bAlreadySaved);
+
+		if (!bAlreadySaved)
+		{
+			bAnyAdded = true;
+			OnLocalSettingSaved.Broadcast(Name);
+		}
+	}
+
+	if (bAnyAdded)
+	{
+		SaveSettings();
+	}
+}
+
 bool URHGameUserSettings::RevertSettingToDefault(const FName& Name)
 {
 	FCachedSettingValue* ValuePtr = AppliedSettingsConfig.Find(Name);
@@ -10,6 +10,8 @@
 
 #define LOOK_ACCELERATION_EVAL_RATE 150.f
 #define LOW_FPS_LOOK_ACCELERATION_EVALS_PER_FRAME 10.f
+// Sub-steps shorter than this are dropped rather than evaluated
+#define LOOK_ACCELERATION_MIN_STEP 0.0005f
 
 bool URHGamepadCurvedLookSpeedManager::StickAimDebug = false;
 
@@ -22,6 +24,112 @@ static FAutoConsoleVariableRef CVarEnableAimAcceleration(
 	ECVF_Default
 );
 
+void FRHBakedLookCurve::Bake(const UCurveVector* Curve, int32 NumSamples, const FVector2D& Scale)
+{
+	Reset();
+
+	if (Curve == nullptr || NumSamples < 2)
+	{
+		return;
+	}
+
+	for (int32 Axis = 0; Axis < 2; ++Axis)
+	{
+		const FRichCurve& AxisCurve = Curve->FloatCurves[Axis];
+		TArray<float>& Samples = Axis == 0 ? SamplesX : SamplesY;
+		const float AxisScale = Axis == 0 ? Scale.X : Scale.Y;
+
+		// Sample across the keyed range, evaluation outside of it holds the end values like the default curve extrapolation
+		float StartTime = 0.f, EndTime = 0.f;
+		AxisCurve.GetTimeRange(StartTime, EndTime);
+		if (EndTime <= StartTime)
+		{
+			EndTime = StartTime + 1.f;
+		}
+
+		const float Step = (EndTime - StartTime) / (NumSamples - 1);
+
+		Samples.SetNumUninitialized(NumSamples);
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			Samples[i] = AxisCurve.Eval(StartTime + i * Step) * AxisScale;
+		}
+
+		if (Axis == 0)
+		{
+			MinTime.X = StartTime;
+			InvStep.X = 1.f / Step;
+		}
+		else
+		{
+			MinTime.Y = StartTime;
+			InvStep.Y = 1.f / Step;
+		}
+	}
+}
+
+void FRHBakedLookCurve::Reset()
+{
+	SamplesX.Reset();
+	SamplesY.Reset();
+	MinTime = FVector2D::ZeroVector;
+	InvStep = FVector2D::ZeroVector;
+}
+
+FVector2D FRHBakedLookCurve::Eval(const FVector2D& Time) const
+{
+	return FVector2D(EvalSamples(SamplesX, MinTime.X, InvStep.X, Time.X), EvalSamples(SamplesY, MinTime.Y, InvStep.Y, Time.Y));
+}
+
+float FRHBakedLookCurve::EvalSamples(const TArray<float>& Samples, float SampleMinTime, float SampleInvStep, float Time)
+{
+	const int32 LastIndex = Samples.Num() - 1;
+	const float Position = FMath::Max((Time - SampleMinTime) * SampleInvStep, 0.f);
+	const int32 Index = FMath::Min(FMath::FloorToInt(Position), LastIndex - 1);
+	const float Alpha = FMath::Min(Position - Index, 1.f);
+
+	return FMath::Lerp(Samples[Index], Samples[Index + 1], Alpha);
+}
+
+float FRHBaseVelocityLookAxis::IntegrateBoostRamp(float StartSpeed, float MaxSpeed, float Accel, float Step, int32 NumSteps, float Remainder, float& OutEndSpeed)
+{
+	const float StepGain = FMath::Max(Accel, 0.f) * Step;
+
+	// Number of steps that finish below MaxSpeed, every step after these is clamped
+	int32 RampSteps = 0;
+	if (StartSpeed < MaxSpeed)
+	{
+		RampSteps = StepGain > 0.f ? FMath::Clamp(FMath::CeilToInt((MaxSpeed - StartSpeed) / StepGain) - 1, 0, NumSteps) : NumSteps;
+	}
+
+	float Distance = Step * (RampSteps * StartSpeed + StepGain * (RampSteps * (RampSteps + 1) / 2.f));
+	Distance += Step * (NumSteps - RampSteps) * MaxSpeed;
+
+	OutEndSpeed = FMath::Min(StartSpeed + FMath::Max(Accel, 0.f) * (NumSteps * Step + Remainder), MaxSpeed);
+	Distance += Remainder * OutEndSpeed;
+
+	return Distance;
+}
+
+float FRHBaseVelocityLookAxis::Integrate(float AbsInput, float Dir, float BaseSpeed, float BoostedSpeed, float BoostThreshold, float BoostAcceleration, float Step, int32 NumSteps, float Remainder, float& InOutSpeed, float& OutAcceleration)
+{
+	if (AbsInput < BoostThreshold)
+	{
+		InOutSpeed = BaseSpeed * Dir;
+		return InOutSpeed * (NumSteps * Step + Remainder);
+	}
+
+	// Boosting starts from the base speed if we aren't already at or above it in this direction
+	const float StartSpeed = FMath::Sign(InOutSpeed) != Dir ? BaseSpeed : FMath::Max(FMath::Abs(InOutSpeed), BaseSpeed);
+
+	float EndSpeed = 0.f;
+	const float Distance = IntegrateBoostRamp(StartSpeed, BoostedSpeed, BoostAcceleration, Step, NumSteps, Remainder, EndSpeed);
+
+	InOutSpeed = EndSpeed * Dir;
+	OutAcceleration = BoostAcceleration;
+	return Distance * Dir;
+}
+
 URHGamepadCurvedLookSpeedManager::URHGamepadCurvedLookSpeedManager(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
     bUseBaseVelocity = true;
@@ -60,27 +168,62 @@ URHGamepadCurvedLookSpeedManager::URHGamepadCurvedLookSpeedManager(const FObject
 
     CurrentTurnSpeed = FVector2D::ZeroVector;
     PrevInput = FVector2D::ZeroVector;
+
+    LookCurveTableResolution = 256;
+    bLookCurveTablesDirty = true;
+    CachedSensitivity = FVector2D(1.f, 1.f);
+    CachedSettingsRevision = 0;
+    bHasCachedSettings = false;
 }
 
 void URHGamepadCurvedLookSpeedManager::Init()
 {
 	Super::Init();
 
+	bHasCachedSettings = false;
+	MarkLookCurveTablesDirty();
+
 	if (PlayerController != nullptr)
 	{
-		if (URHPlayerInput* const playerInput = Cast<URHPlayerInput>(PlayerController->PlayerInput))
+		RefreshLookSettings(Cast<URHPlayerInput>(PlayerController->PlayerInput));
+	}
+}
+
+void URHGamepadCurvedLookSpeedManager::RefreshLookSettings(const URHPlayerInput* PlayerInput)
+{
+	if (PlayerInput != nullptr && (!bHasCachedSettings || CachedSettingsRevision != PlayerInput->GetSettingsRevision()))
+	{
+		bHasCachedSettings = true;
+		CachedSettingsRevision = PlayerInput->GetSettingsRevision();
+		CachedSensitivity = PlayerInput->GetGamepadLookSensitivity();
+
+		float OutValue = BoostAcceleration;
+		if (PlayerInput->GetSettingAsFloat(URHPlayerInput::GamepadAccelerationBoost, OutValue))
 		{
-			float OutValue = BoostAcceleration;
-			if (playerInput->GetSettingAsFloat(URHPlayerInput::GamepadAccelerationBoost, OutValue))
-			{
-				SetBoostAcceleration(OutValue);
-			}
-			if (playerInput->GetSettingAsFloat(URHPlayerInput::GamepadMultiplierBoost, OutValue))
-			{
-				SetBoostMultiplier(OutValue, OutValue);
-			}
+			SetBoostAcceleration(OutValue);
+		}
+		if (PlayerInput->GetSettingAsFloat(URHPlayerInput::GamepadMultiplierBoost, OutValue))
+		{
+			SetBoostMultiplier(OutValue, OutValue);
 		}
 	}
+
+	if (bLookCurveTablesDirty)
+	{
+		RebuildLookCurveTables();
+	}
+}
+
+void URHGamepadCurvedLookSpeedManager::RebuildLookCurveTables()
+{
+	const int32 NumSamples = FMath::Clamp(LookCurveTableResolution, 2, 4096);
+
+	BaseVelocityTable.Bake(LookBaseVelocityCurve, NumSamples);
+	BoostedVelocityTable.Bake(LookBaseVelocityCurve, NumSamples, BoostMultiplier);
+	MaxVelocityTable.Bake(MouseLookMaxVelocityCurve, NumSamples);
+	AccelerationTable.Bake(MouseLookAccelerationCurve, NumSamples);
+
+	bLookCurveTablesDirty = false;
 }
 
 FVector2D URHGamepadCurvedLookSpeedManager::UpdateGamepadLook(FVector2D GamepadInput, float DeltaTime)
@@ -97,13 +240,15 @@ FVector2D URHGamepadCurvedLookSpeedManager::UpdateGamepadLook(FVector2D GamepadI
 	{
 		if (const URHPlayerInput* playerInput = Cast<URHPlayerInput>(PlayerController->PlayerInput))
 		{
+            RefreshLookSettings(playerInput);
+
             // Realm method + FOV scaling and sensitivity
 
             //We want to use a fixed timestep of 1/150 sec, but at low framerates, in order to still maintain smooth acceleration calculations,
             //we switch to doing a defined amount per frame.
             const float AccelerationTimestep = FMath::Max(DeltaTime / LOW_FPS_LOOK_ACCELERATION_EVALS_PER_FRAME, 1.f / LOOK_ACCELERATION_EVAL_RATE);
 
-			const FVector2D sensitivity = playerInput->GetGamepadLookSensitivity();
+			const FVector2D sensitivity = CachedSensitivity;
 	
 			// TODO: Hook up Scope/ADS sensitivity modifiers
 /*			switch (playerInput->AimMode)
@@ -130,58 +275,32 @@ FVector2D URHGamepadCurvedLookSpeedManager::UpdateGamepadLook(FVector2D GamepadI
 
             if (bUseBaseVelocity)
             {
-                while (AccelerationTimeRemaining > 0.0005f)
+                if (BaseVelocityTable.IsValid() && DeltaTime > LOOK_ACCELERATION_MIN_STEP)
                 {
-                    const float Timestep = FMath::Min(AccelerationTimestep, AccelerationTimeRemaining);
+                    // Input is constant across the frame, so the sub-steps reduce to a clamped linear ramp that can be summed directly
+                    int32 NumSteps = FMath::FloorToInt(DeltaTime / AccelerationTimestep);
+                    float Remainder = DeltaTime - NumSteps * AccelerationTimestep;
+                    if (Remainder <= LOOK_ACCELERATION_MIN_STEP)
+                    {
+                        Remainder = 0.f;
+                    }
+
+                    const FVector2D AbsInput(FMath::Abs(aTurn), FMath::Abs(aLookUp));
+                    const FVector2D BaseSpeed = BaseVelocityTable.Eval(AbsInput);
+                    const FVector2D BoostedSpeed = BoostedVelocityTable.Eval(AbsInput);
 
                     if (!bZeroTurn)
                     {
-                        const float BaseTurnSpeed = LookBaseVelocityCurve->FloatCurves[0].Eval(FMath::Abs(aTurn));
-
-                        if (FMath::Abs(aTurn) < BoostThreshold.X || FMath::Abs(CurrentTurnSpeed.X) < BaseTurnSpeed || FMath::Sign(CurrentTurnSpeed.X) != dirX)
-                        {
-                            //Set the turn speed directly if we aren't at a boostable input or the current speed isn't yet at base.
-                            CurrentTurnSpeed.X = BaseTurnSpeed * dirX;
-                        }
-
-                        if (FMath::Abs(aTurn) >= BoostThreshold.X)
-                        {
-                            acceleration.X = BoostAcceleration;
-                            CurrentTurnSpeed.X += Timestep * dirX * acceleration.X;
-
-                            const float DesiredTurnSpeed = BaseTurnSpeed * BoostMultiplier.X;
-                            CurrentTurnSpeed.X = FMath::Clamp(CurrentTurnSpeed.X, -DesiredTurnSpeed, DesiredTurnSpeed);
-                        }
-						
-                        AverageTurnSpeed.X += CurrentTurnSpeed.X * Timestep;
+                        AverageTurnSpeed.X = FRHBaseVelocityLookAxis::Integrate(AbsInput.X, dirX, BaseSpeed.X, BoostedSpeed.X, BoostThreshold.X, BoostAcceleration, AccelerationTimestep, NumSteps, Remainder, CurrentTurnSpeed.X, acceleration.X);
                     }
 
                     if (!bZeroLookUp)
                     {
-                        const float BaseLookUpSpeed = LookBaseVelocityCurve->FloatCurves[1].Eval(FMath::Abs(aLookUp));
-
-                        if (FMath::Abs(aLookUp) < BoostThreshold.Y || FMath::Abs(CurrentTurnSpeed.Y) < BaseLookUpSpeed || FMath::Sign(CurrentTurnSpeed.Y) != dirY)
-                        {
-                            //Set the lookup speed directly if we aren't at a boostable input or the current speed isn't yet at base.
-                            CurrentTurnSpeed.Y = BaseLookUpSpeed * dirY;
-                        }
-
-                        if (FMath::Abs(aLookUp) >= BoostThreshold.Y)
-                        {
-                            acceleration.Y = BoostAcceleration;
-                            CurrentTurnSpeed.Y += Timestep * dirY * acceleration.Y;
-
-                            const float DesiredLookUpSpeed = BaseLookUpSpeed * BoostMultiplier.Y;
-                            CurrentTurnSpeed.Y = FMath::Clamp(CurrentTurnSpeed.Y, -DesiredLookUpSpeed, DesiredLookUpSpeed);
-                        }
-
-                        AverageTurnSpeed.Y += CurrentTurnSpeed.Y * Timestep;
+                        AverageTurnSpeed.Y = FRHBaseVelocityLookAxis::Integrate(AbsInput.Y, dirY, BaseSpeed.Y, BoostedSpeed.Y, BoostThreshold.Y, BoostAcceleration, AccelerationTimestep, NumSteps, Remainder, CurrentTurnSpeed.Y, acceleration.Y);
                     }
-
-                    AccelerationTimeRemaining -= Timestep;
                 }
             }
-            else if (MouseLookAccelerationCurve != nullptr)
+            else if (AccelerationTable.IsValid() && MaxVelocityTable.IsValid())
             {
                 if (CurrentTurnSpeed.X * dirX <= 0 || bZeroTurn)
                 {
@@ -195,35 +314,23 @@ FVector2D URHGamepadCurvedLookSpeedManager::UpdateGamepadLook(FVector2D GamepadI
                 }
 
                 const FVector2D OldInput = PrevInput;
+                const FVector2D Dir(dirX, dirY);
+                // Axes without input keep a zero speed, so masking their acceleration is enough to leave them untouched
+                const FVector2D ActiveAxes(bZeroTurn ? 0.f : 1.f, bZeroLookUp ? 0.f : 1.f);
 
-                while (AccelerationTimeRemaining > 0.0005f)
+                while (AccelerationTimeRemaining > LOOK_ACCELERATION_MIN_STEP)
                 {
                     const float Timestep = FMath::Min(AccelerationTimestep, AccelerationTimeRemaining);
 
-                    if (!bZeroTurn)
-                    {
-                        const float StepATurn = FMath::Lerp(OldInput.X, aTurn, 1.f - (AccelerationTimeRemaining / DeltaTime));
-                        const float DesiredTurnSpeed = MouseLookMaxVelocityCurve->FloatCurves[0].Eval(FMath::Abs(StepATurn));
-                        acceleration.X = MouseLookAccelerationCurve->FloatCurves[0].Eval(FMath::Abs(CurrentTurnSpeed.X));
-
-                        CurrentTurnSpeed.X += Timestep * dirX * acceleration.X;
-                        CurrentTurnSpeed.X = FMath::Clamp(CurrentTurnSpeed.X, -DesiredTurnSpeed, DesiredTurnSpeed);
-						
-                        AverageTurnSpeed.X += CurrentTurnSpeed.X * Timestep;
-                    }
+                    const FVector2D StepInput = FMath::Lerp(OldInput, GamepadInput, 1.f - (AccelerationTimeRemaining / DeltaTime));
+                    const FVector2D DesiredTurnSpeed = MaxVelocityTable.Eval(StepInput.GetAbs());
+                    acceleration = AccelerationTable.Eval(CurrentTurnSpeed.GetAbs()) * ActiveAxes;
 
-                    if (!bZeroLookUp)
-                    {
-                        const float StepALookUp = FMath::Lerp(OldInput.Y, aLookUp, 1.f - (AccelerationTimeRemaining / DeltaTime));
-                        const float DesiredTurnSpeed = MouseLookMaxVelocityCurve->FloatCurves[1].Eval(FMath::Abs(StepALookUp));
+                    CurrentTurnSpeed += Dir * acceleration * Timestep;
+                    CurrentTurnSpeed.X = FMath::Clamp(CurrentTurnSpeed.X, -DesiredTurnSpeed.X, DesiredTurnSpeed.X);
+                    CurrentTurnSpeed.Y = FMath::Clamp(CurrentTurnSpeed.Y, -DesiredTurnSpeed.Y, DesiredTurnSpeed.Y);
 
-                        acceleration.Y = MouseLookAccelerationCurve->FloatCurves[1].Eval(FMath::Abs(CurrentTurnSpeed.Y));
-
-                        CurrentTurnSpeed.Y += Timestep * dirY * acceleration.Y;
-                        CurrentTurnSpeed.Y = FMath::Clamp(CurrentTurnSpeed.Y, -DesiredTurnSpeed, DesiredTurnSpeed);
-
-                        AverageTurnSpeed.Y += CurrentTurnSpeed.Y * Timestep;
-                    }
+                    AverageTurnSpeed += CurrentTurnSpeed * Timestep;
 
                     AccelerationTimeRemaining -= Timestep;
                 }
@@ -263,7 +370,9 @@ FVector2D URHGamepadCurvedLookSpeedManager::UpdateGamepadLook(FVector2D GamepadI
 	{
 		if (const URHPlayerInput* playerInput = Cast<URHPlayerInput>(PlayerController->PlayerInput))
 		{
-			const FVector2D sensitivity = playerInput->GetGamepadLookSensitivity();
+			RefreshLookSettings(playerInput);
+
+			const FVector2D sensitivity = CachedSensitivity;
 			
 			// TODO: Hook up Scope/ADS sensitivity modifiers
 /*			switch (playerInput->AimMode)
@@ -321,6 +430,8 @@ void URHGamepadCurvedLookSpeedManager::SetBoostMultiplier(float NewBoostX, float
     {
         BoostMultiplier.Y = NewBoostY;
     }
+
+    MarkLookCurveTablesDirty();
 }
 
 void URHGamepadCurvedLookSpeedManager::SetBoostAcceleration(float NewAccel)
@@ -339,6 +450,7 @@ void URHGamepadCurvedLookSpeedManager::SetBaseVelocityCurve(FName TestCurveName)
         if (TestCurve != nullptr && *TestCurve != nullptr)
         {
             LookBaseVelocityCurve = *TestCurve;
+            MarkLookCurveTablesDirty();
         }
     }
 }
@@ -14,6 +14,96 @@
 
 DEFINE_LOG_CATEGORY_STATIC(RHInput, Log, All);
 
+namespace
+{
+	const TArray<FRHInputActionKeyMapping>* GetActionMappingsForInputType(const FRHCustomInputActionKeyMappings& CustomMappings, EInputType InputType)
+	{
+		switch (InputType)
+		{
+		case EInputType::KBM:
+			return &CustomMappings.KBM_Mappings;
+		case EInputType::GP:
+			return &CustomMappings.GP_Mappings;
+		case EInputType::Touch:
+			return &CustomMappings.Touch_Mappings;
+		}
+		return nullptr;
+	}
+
+	const TMap<float, FRHInputAxisKeyMappings>* GetAxisMappingsForInputType(const FRHCustomInputAxisKeyMappings& CustomMappings, EInputType InputType)
+	{
+		switch (InputType)
+		{
+		case EInputType::KBM:
+			return &CustomMappings.KBM_Mappings;
+		case EInputType::GP:
+			return &CustomMappings.GP_Mappings;
+		case EInputType::Touch:
+			return &CustomMappings.Touch_Mappings;
+		}
+		return nullptr;
+	}
+
+	// Gamepad bindings only match when they are exactly the chord of keys, other input types match on any shared key
+	bool DoActionMappingsMatchKeys(const TArray<FRHInputActionKeyMapping>& Mappings, const TArray<FRHInputActionKey>& Keys, EInputType InputType)
+	{
+		if (InputType == EInputType::GP)
+		{
+			if (Keys.Num() == 0 || Keys.Num() != Mappings.Num())
+			{
+				return false;
+			}
+
+			for (const FRHInputActionKeyMapping& InputActionMapping : Mappings)
+			{
+				if (!Keys.Contains(FRHInputActionKey(InputActionMapping.Mapping.Key, InputActionMapping.Type)))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		for (const FRHInputActionKeyMapping& InputActionMapping : Mappings)
+		{
+			if (Keys.Contains(FRHInputActionKey(InputActionMapping.Mapping.Key, InputActionMapping.Type)))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool DoAxisMappingsMatchKeys(const TArray<FInputAxisKeyMapping>& Mappings, const TArray<FKey>& Keys, EInputType InputType)
+	{
+		if (InputType == EInputType::GP)
+		{
+			if (Keys.Num() == 0 || Keys.Num() != Mappings.Num())
+			{
+				return false;
+			}
+
+			for (const FInputAxisKeyMapping& Mapping : Mappings)
+			{
+				if (!Keys.Contains(Mapping.Key))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		for (const FInputAxisKeyMapping& Mapping : Mappings)
+		{
+			if (Keys.Contains(Mapping.Key))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
 const FName URHPlayerInput::MouseDoubleClickTime(TEXT("MouseDoubleClickTime"));
 const FName URHPlayerInput::MouseHoldTime(TEXT("MouseHoldTime"));
 
@@ -298,6 +388,8 @@ void URHPlayerInput::ApplySavedSettings()
 		AppliedSettingsConfig.Add(KeyPair.Key, FCachedSettingValue(KeyPair.Value));
 	}
 
+	++SettingsRevision;
+
 	// Do anything needed in order to apply the setting externally
 	for (TPair<FName, FApplyInputSettingFunctionPtr>& ApplySettingPair : ApplySettingFunctionMap)
 	{
@@ -549,6 +641,8 @@ bool URHPlayerInput::RevertSettingToDefault(const FName& Name)
 
 void URHPlayerInput::CallApplySettingFunction(const FName& Name)
 {
+	++SettingsRevision;
+
 	const FApplyInputSettingFunctionPtr* ApplySettingFunctionPtr = ApplySettingFunctionMap.Find(Name);
 	if (ApplySettingFunctionPtr != nullptr)
 	{
@@ -911,6 +1005,7 @@ void URHPlayerInput::SetCustomKeyMappingsToDefault()
 	CustomActionKeyMappings.Empty();
 	CustomAxisKeyMappings.Empty();
 
+	RebuildKeyMappingIndex();
     ApplyCustomMappings();
 
     OnKeyMappingsUpdated.Broadcast();
@@ -987,6 +1082,7 @@ void URHPlayerInput::RemoveStaleCustomBindings()
 			AppliedAxisKeyMappings.Remove(AxisKeyMappingKey);
 		}
 	}
+	RebuildKeyMappingIndex();
 }
 
 void URHPlayerInput::GetCustomActionKeyMappingNames(TArray<FName>& OutNames) const
@@ -1257,85 +1353,186 @@ void URHPlayerInput::GetCustomInputAxisKeys(const FName& Name, EInputType InputT
 
 FName URHPlayerInput::GetCustomInputActionWithKeys(const TArray<FRHInputActionKey>& Keys, EInputType InputType) const
 {
-	for (const TPair<FName, FRHCustomInputActionKeyMappings>& CustomActionKeyMapping : AppliedActionKeyMappings)
+	// Only names bound to one of the keys can match, so check those instead of every applied mapping
+	TArray<FName> CandidateNames;
+	GetIndexedActionNamesForKeys(Keys, InputType, CandidateNames);
+
+	for (const FName& CandidateName : CandidateNames)
+	{
+		const TArray<FRHInputActionKeyMapping>* Mappings = GetActionMappingsForInputType(AppliedActionKeyMappings[CandidateName], InputType);
+		if (Mappings != nullptr && DoActionMappingsMatchKeys(*Mappings, Keys, InputType))
+		{
+			return CandidateName;
+		}
+	}
+
+	return FName();
+}
+
+TPair<FName, float> URHPlayerInput::GetCustomInputAxisWithKeys(const TArray<FKey>& Keys, EInputType InputType) const
+{
+	TArray<FName> CandidateNames;
+	GetIndexedAxisNamesForKeys(Keys, InputType, CandidateNames);
+
+	for (const FName& CandidateName : CandidateNames)
 	{
-		TArray<FRHInputActionKeyMapping> OutInputActionKeyMappings;
-		GetCustomInputActionKeyMappingsCopyFor(CustomActionKeyMapping.Key, InputType, OutInputActionKeyMappings);
-		if (InputType == EInputType::KBM || InputType == EInputType::Touch)
+		if (const TMap<float, FRHInputAxisKeyMappings>* ScaleMappings = GetAxisMappingsForInputType(AppliedAxisKeyMappings[CandidateName], InputType))
 		{
-			for (FRHInputActionKeyMapping& InputActionMapping : OutInputActionKeyMappings)
+			for (const TPair<float, FRHInputAxisKeyMappings>& Mappings : *ScaleMappings)
 			{
-				FRHInputActionKey InputActionKey(InputActionMapping.Mapping.Key, InputActionMapping.Type);
-				if (Keys.Contains(InputActionKey))
+				if (DoAxisMappingsMatchKeys(Mappings.Value.InputAxisKeyMappings, Keys, InputType))
 				{
-					return CustomActionKeyMapping.Key;
+					return TPair<FName, float>(CandidateName, Mappings.Key);
 				}
 			}
 		}
-		else if (InputType == EInputType::GP)
+	}
+
+	return TPair<FName, float>(FName(), 0.f);
+}
+
+void URHPlayerInput::GetIndexedActionNamesForKeys(const TArray<FRHInputActionKey>& Keys, EInputType InputType, TArray<FName>& OutNames) const
+{
+	OutNames.Reset();
+	for (const FRHInputActionKey& Key : Keys)
+	{
+		if (const TArray<FName>* Names = ActionNamesByKey.Find(FRHKeyBindingIndexKey(Key.Key, InputType, Key.Type)))
 		{
-			bool bContainsAllKeys = Keys.Num() > 0 && Keys.Num() == OutInputActionKeyMappings.Num();
-			if (bContainsAllKeys)
+			for (const FName& Name : *Names)
 			{
-				for (FRHInputActionKeyMapping& InputActionMapping : OutInputActionKeyMappings)
+				if (AppliedActionKeyMappings.Contains(Name))
 				{
-					FRHInputActionKey InputActionKey(InputActionMapping.Mapping.Key, InputActionMapping.Type);
-					if (!Keys.Contains(InputActionKey))
-					{
-						bContainsAllKeys = false;
-					}
+					OutNames.AddUnique(Name);
 				}
 			}
-			if (bContainsAllKeys)
+		}
+	}
+
+	// Keep the results in map order so the first match is the same one a full iteration would find
+	OutNames.Sort([this](const FName& A, const FName& B)
+		{
+			return AppliedActionKeyMappings.FindId(A).AsInteger() < AppliedActionKeyMappings.FindId(B).AsInteger();
+		});
+}
+
+void URHPlayerInput::GetIndexedAxisNamesForKeys(const TArray<FKey>& Keys, EInputType InputType, TArray<FName>& OutNames) const
+{
+	OutNames.Reset();
+	for (const FKey& Key : Keys)
+	{
+		if (const TArray<FName>* Names = AxisNamesByKey.Find(FRHKeyBindingIndexKey(Key, InputType)))
+		{
+			for (const FName& Name : *Names)
 			{
-				return CustomActionKeyMapping.Key;
+				if (AppliedAxisKeyMappings.Contains(Name))
+				{
+					OutNames.AddUnique(Name);
+				}
 			}
 		}
 	}
 
-	return FName();
+	OutNames.Sort([this](const FName& A, const FName& B)
+		{
+			return AppliedAxisKeyMappings.FindId(A).AsInteger() < AppliedAxisKeyMappings.FindId(B).AsInteger();
+		});
 }
 
-TPair<FName, float> URHPlayerInput::GetCustomInputAxisWithKeys(const TArray<FKey>& Keys, EInputType InputType) const
+void URHPlayerInput::ReindexCustomActionKeyMappings(const FName& Name)
 {
-	for (const TPair<FName, FRHCustomInputAxisKeyMappings>& CustomInputAxisKeyMappings : AppliedAxisKeyMappings)
+	TArray<FRHKeyBindingIndexKey>& IndexedKeys = IndexedActionKeys.FindOrAdd(Name);
+	for (const FRHKeyBindingIndexKey& IndexedKey : IndexedKeys)
+	{
+		if (TArray<FName>* Names = ActionNamesByKey.Find(IndexedKey))
+		{
+			Names->RemoveSingleSwap(Name);
+			if (Names->Num() == 0)
+			{
+				ActionNamesByKey.Remove(IndexedKey);
+			}
+		}
+	}
+	IndexedKeys.Reset();
+
+	if (const FRHCustomInputActionKeyMappings* CustomMappings = AppliedActionKeyMappings.Find(Name))
 	{
-		TMap<float, TArray<FInputAxisKeyMapping>> OutMappingsList;
-		GetCustomInputAxisKeyMappingsCopyFor(CustomInputAxisKeyMappings.Key, InputType, OutMappingsList);
-		for (const TPair<float, TArray<FInputAxisKeyMapping>>& Mappings : OutMappingsList)
+		for (const EInputType InputType : { EInputType::KBM, EInputType::GP, EInputType::Touch })
 		{
-			if (InputType == EInputType::KBM || InputType == EInputType::Touch)
+			for (const FRHInputActionKeyMapping& InputActionMapping : *GetActionMappingsForInputType(*CustomMappings, InputType))
 			{
-				TArray<FInputAxisKeyMapping> AxisKeyBindingsToRemove;
-				for (const FInputAxisKeyMapping& Mapping : Mappings.Value)
+				const FRHKeyBindingIndexKey IndexKey(InputActionMapping.Mapping.Key, InputType, InputActionMapping.Type);
+				if (!IndexedKeys.Contains(IndexKey))
 				{
-					if (Keys.Contains(Mapping.Key))
-					{
-						return TPair<FName,float>(CustomInputAxisKeyMappings.Key, Mappings.Key);
-					}
+					IndexedKeys.Add(IndexKey);
+					ActionNamesByKey.FindOrAdd(IndexKey).Add(Name);
 				}
 			}
-			else if (InputType == EInputType::GP)
+		}
+	}
+
+	if (IndexedKeys.Num() == 0)
+	{
+		IndexedActionKeys.Remove(Name);
+	}
+}
+
+void URHPlayerInput::ReindexCustomAxisKeyMappings(const FName& Name)
+{
+	TArray<FRHKeyBindingIndexKey>& IndexedKeys = IndexedAxisKeys.FindOrAdd(Name);
+	for (const FRHKeyBindingIndexKey& IndexedKey : IndexedKeys)
+	{
+		if (TArray<FName>* Names = AxisNamesByKey.Find(IndexedKey))
+		{
+			Names->RemoveSingleSwap(Name);
+			if (Names->Num() == 0)
 			{
-				bool bContainsAllKeys = Keys.Num() > 0 && Keys.Num() == Mappings.Value.Num();
-				if (bContainsAllKeys)
+				AxisNamesByKey.Remove(IndexedKey);
+			}
+		}
+	}
+	IndexedKeys.Reset();
+
+	if (const FRHCustomInputAxisKeyMappings* CustomMappings = AppliedAxisKeyMappings.Find(Name))
+	{
+		for (const EInputType InputType : { EInputType::KBM, EInputType::GP, EInputType::Touch })
+		{
+			for (const TPair<float, FRHInputAxisKeyMappings>& Mappings : *GetAxisMappingsForInputType(*CustomMappings, InputType))
+			{
+				for (const FInputAxisKeyMapping& Mapping : Mappings.Value.InputAxisKeyMappings)
 				{
-					for (const FInputAxisKeyMapping& Mapping : Mappings.Value)
+					const FRHKeyBindingIndexKey IndexKey(Mapping.Key, InputType);
+					if (!IndexedKeys.Contains(IndexKey))
 					{
-						if (!Keys.Contains(Mapping.Key))
-						{
-							bContainsAllKeys = false;
-						}
+						IndexedKeys.Add(IndexKey);
+						AxisNamesByKey.FindOrAdd(IndexKey).Add(Name);
 					}
 				}
-				if (bContainsAllKeys)
-				{
-					return TPair<FName, float>(CustomInputAxisKeyMappings.Key, Mappings.Key);
-				}
 			}
 		}
 	}
-	return TPair<FName, float>(FName(), 0.f);
+
+	if (IndexedKeys.Num() == 0)
+	{
+		IndexedAxisKeys.Remove(Name);
+	}
+}
+
+void URHPlayerInput::RebuildKeyMappingIndex()
+{
+	ActionNamesByKey.Reset();
+	AxisNamesByKey.Reset();
+	IndexedActionKeys.Reset();
+	IndexedAxisKeys.Reset();
+
+	for (const TPair<FName, FRHCustomInputActionKeyMappings>& ActionMappingPair : AppliedActionKeyMappings)
+	{
+		ReindexCustomActionKeyMappings(ActionMappingPair.Key);
+	}
+
+	for (const TPair<FName, FRHCustomInputAxisKeyMappings>& AxisMappingPair : AppliedAxisKeyMappings)
+	{
+		ReindexCustomAxisKeyMappings(AxisMappingPair.Key);
+	}
 }
 
 void URHPlayerInput::SetCustomInputActionKeyMapping(const FName& Name, const TArray<FRHInputActionKey>& Keys, EInputType InputType, TArray<FName>& OutModifiedKeybindNames)
@@ -1529,6 +1726,7 @@ void URHPlayerInput::SetCustomInputActionKeyMapping_Internal(const FName& Name,
             }
         }
 
+		ReindexCustomActionKeyMappings(Name);
         OutModifiedKeybindNames.Add(Name);
     }
 	
@@ -1592,6 +1790,7 @@ void URHPlayerInput::SetCustomInputAxisKeyMapping(const FName& Name, const TArra
             }
         }
 
+		ReindexCustomAxisKeyMappings(Name);
         OutModifiedKeybindNames.Add(Name);
     }
 
@@ -1600,17 +1799,22 @@ void URHPlayerInput::SetCustomInputAxisKeyMapping(const FName& Name, const TArra
 
 void URHPlayerInput::ResolveCustomInputActionKeyMappingConflicts(const TArray<FRHInputActionKey>& ConflictingKeys, const TArray<FRHInputActionKey>& ReplacementKeys, EInputType InputType, TArray<FName>& OutModifiedKeybindNames)
 {
-    for (const TPair<FName, FRHCustomInputActionKeyMappings>& CustomInputActionKeyMappings : AppliedActionKeyMappings)
+	TArray<FName> KeybindNamesToResolve;
+	GetCustomActionKeyMappingNames(KeybindNamesToResolve);
+	GetCustomAxisKeyMappingNames(KeybindNamesToResolve);
+
+	// Only names bound to one of the conflicting keys can conflict with them
+	TArray<FName> CandidateNames;
+	GetIndexedActionNamesForKeys(ConflictingKeys, InputType, CandidateNames);
+
+    for (const FName& CandidateName : CandidateNames)
     {
-		TArray<FName> KeybindNamesToResolve;
-		GetCustomActionKeyMappingNames(KeybindNamesToResolve);
-		GetCustomAxisKeyMappingNames(KeybindNamesToResolve);
-        if (!KeybindNamesToResolve.Contains(CustomInputActionKeyMappings.Key))
+        if (!KeybindNamesToResolve.Contains(CandidateName))
         {
             continue;
         }
 
-        if (TArray<FRHInputActionKeyMapping>* const InputActionKeyMappings = GetCustomInputActionKeyMappingsFor(CustomInputActionKeyMappings.Key, InputType))
+        if (TArray<FRHInputActionKeyMapping>* const InputActionKeyMappings = GetCustomInputActionKeyMappingsFor(CandidateName, InputType))
         {
 			if (DoesInputTypeSupportChords(InputType))
 			{
@@ -1636,12 +1840,12 @@ void URHPlayerInput::ResolveCustomInputActionKeyMappingConflicts(const TArray<FR
 
 					for (const FRHInputActionKey& InputActionKey : ReplacementKeys)
 					{
-						FInputActionKeyMapping Mapping(CustomInputActionKeyMappings.Key, InputActionKey.Key);
+						FInputActionKeyMapping Mapping(CandidateName, InputActionKey.Key);
 						InputActionKeyMappings->Emplace(Mapping, InputActionKey.Type);
 						AddActionMapping(InputActionKeyMappings->Last().Mapping);
 					}
 
-					OutModifiedKeybindNames.Add(CustomInputActionKeyMappings.Key);
+					OutModifiedKeybindNames.Add(CandidateName);
 				}
 			}
 			else
@@ -1666,7 +1870,7 @@ void URHPlayerInput::ResolveCustomInputActionKeyMappingConflicts(const TArray<FR
                         {
                             ActionKeyBindingsToRemove.AddUnique(InputActionMapping);
                         }
-                        OutModifiedKeybindNames.Add(CustomInputActionKeyMappings.Key);
+                        OutModifiedKeybindNames.Add(CandidateName);
                     }
                 }
                 for (const FRHInputActionKeyMapping& ActionKeyBindingToRemove : ActionKeyBindingsToRemove)
@@ -1674,24 +1878,30 @@ void URHPlayerInput::ResolveCustomInputActionKeyMappingConflicts(const TArray<FR
 					InputActionKeyMappings->Remove(ActionKeyBindingToRemove);
                 }
             }
+
+			ReindexCustomActionKeyMappings(CandidateName);
         }
     }
 }
 
 void URHPlayerInput::ResolveCustomInputAxisKeyMappingConflicts(const TArray<FKey>& ConflictingKeys, const TArray<FKey>& ReplacementKeys, EInputType InputType, TArray<FName>& OutModifiedKeybindNames)
 {
-    for (const TPair<FName, FRHCustomInputAxisKeyMappings>& CustomInputAxisKeyMappings : AppliedAxisKeyMappings)
+	TArray<FName> KeybindNamesToResolve;
+	GetCustomActionKeyMappingNames(KeybindNamesToResolve);
+	GetCustomAxisKeyMappingNames(KeybindNamesToResolve);
+
+	TArray<FName> CandidateNames;
+	GetIndexedAxisNamesForKeys(ConflictingKeys, InputType, CandidateNames);
+
+    for (const FName& CandidateName : CandidateNames)
     {
-		TArray<FName> KeybindNamesToResolve;
-		GetCustomActionKeyMappingNames(KeybindNamesToResolve);
-		GetCustomAxisKeyMappingNames(KeybindNamesToResolve);
-        if (!KeybindNamesToResolve.Contains(CustomInputAxisKeyMappings.Key))
+        if (!KeybindNamesToResolve.Contains(CandidateName))
         {
             continue;
         }
 
         TMap<float, TArray<FInputAxisKeyMapping>*> OutMappingsList;
-        GetCustomInputAxisKeyMappingsFor(CustomInputAxisKeyMappings.Key, InputType, OutMappingsList);
+        GetCustomInputAxisKeyMappingsFor(CandidateName, InputType, OutMappingsList);
         for(const TPair<float, TArray<FInputAxisKeyMapping>*>& Mappings : OutMappingsList)
         {
             if (Mappings.Value == nullptr)
@@ -1722,11 +1932,11 @@ void URHPlayerInput::ResolveCustomInputAxisKeyMappingConflicts(const TArray<FKey
 
 					for (const FKey& Key : ReplacementKeys)
 					{
-						Mappings.Value->Emplace(CustomInputAxisKeyMappings.Key, Key, Mappings.Key);
+						Mappings.Value->Emplace(CandidateName, Key, Mappings.Key);
 						AddAxisMapping(Mappings.Value->Last());
 					}
 
-					OutModifiedKeybindNames.Add(CustomInputAxisKeyMappings.Key);
+					OutModifiedKeybindNames.Add(CandidateName);
 				}
 			}
 			else
@@ -1749,7 +1959,7 @@ void URHPlayerInput::ResolveCustomInputAxisKeyMappingConflicts(const TArray<FKey
                         {
                             AxisKeyBindingsToRemove.AddUnique(Mapping);
                         }
-                        OutModifiedKeybindNames.Add(CustomInputAxisKeyMappings.Key);
+                        OutModifiedKeybindNames.Add(CandidateName);
                     }
                 }
                 for (const FInputAxisKeyMapping& AxisKeyBindingToRemove : AxisKeyBindingsToRemove)
@@ -1758,6 +1968,8 @@ void URHPlayerInput::ResolveCustomInputAxisKeyMappingConflicts(const TArray<FKey
                 }
             }
         }
+
+		ReindexCustomAxisKeyMappings(CandidateName);
     }
 }
 
@@ -60,6 +60,28 @@ void FPCom_RuntimeTelemetryCollector::UpdateWorld(UWorld* pWorld)
     ResetStats();
 }
 
+void FPCom_RuntimeTelemetryCollector::RecordMapLoadTimeline(const FRHMapLoadTimeline& InTimeline)
+{
+    MapLoadTimeline = InTimeline;
+
+    if (LogFile != nullptr)
+    {
+        FString LogLine = FString::Printf(TEXT("MapLoad Map=%s"), *MapLoadTimeline.MapName);
+        for (int32 PhaseIndex = 0; PhaseIndex < (int32)ERHMapLoadPhase::MAX; ++PhaseIndex)
+        {
+            const ERHMapLoadPhase Phase = (ERHMapLoadPhase)PhaseIndex;
+            LogLine += FString::Printf(TEXT(", %s=%0.3f"), FRHMapLoadTimeline::GetPhaseName(Phase), MapLoadTimeline.GetPhaseTime(Phase));
+        }
+        LogLine += FString::Printf(TEXT(", PeakMemoryMB=%llu, MemoryGrowthMB=%lld, PackagesLoaded=%d, PackagesLoadedMB=%0.2f"),
+            MapLoadTimeline.PeakMemoryBytes >> 20,
+            ((int64)MapLoadTimeline.PeakMemoryBytes - (int64)MapLoadTimeline.StartMemoryBytes) >> 20,
+            MapLoadTimeline.PackagesLoaded,
+            MapLoadTimeline.PackageBytesLoaded / (1024.0 * 1024.0));
+
+        LogFile->Serialize(*LogLine, ELogVerbosity::Warning, LogFeatures.LogCategory, FPlatformTime::Seconds());
+    }
+}
+
 void FPCom_RuntimeTelemetryCollector::InitFeaturesFromConfig()
 {
     uint32 LogFlags = 0;
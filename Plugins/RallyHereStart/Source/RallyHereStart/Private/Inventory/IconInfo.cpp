@@ -23,30 +23,9 @@ void UImageIconInfo::ApplyToAsyncImage(URHAsyncImage* InImage, bool bMatchSize /
 {
 	if (InImage != nullptr && !IconImage.IsNull())
 	{
-		TWeakObjectPtr<URHAsyncImage> WeakImage(InImage); // using weak ptr in case 'InImage' has gone out of scope by the time this lambda is called
-		TSoftObjectPtr<UObject> SoftObject(IconImage);
 		InImage->SetColorAndOpacity(IconTint);
 
-		InImage->RequestAsyncLoad(SoftObject,
-			[WeakImage, SoftObject, bMatchSize]() {
-			if (URHAsyncImage* StrongImage = WeakImage.Get())
-			{
-				UObject* StrongObject = SoftObject.Get();
-				ensureMsgf(StrongObject, TEXT("Failed to load %s"), *SoftObject.ToSoftObjectPath().ToString());
-				if (UTexture2D* StrongTexture = Cast<UTexture2D>(StrongObject))
-				{
-					StrongImage->InternalSetBrushFromItemTexture(StrongTexture, bMatchSize);
-				}
-				else if (UMaterialInterface* StrongMI = Cast<UMaterialInterface>(StrongObject))
-				{
-					StrongImage->SetBrushFromMaterial(StrongMI);
-				}
-				else
-				{
-					ensureMsgf(false, TEXT("Object %s is not a valid object type. Must be Texture2D or MaterialInterface."), *GetNameSafe(StrongObject));
-					StrongImage->InternalSetBrushFromItemTexture(nullptr, bMatchSize);
-				}
-			}
-		});
+		// Shares the load with any other image waiting on the same icon
+		InImage->SetBrushFromPathOnItem(nullptr, IconImage, bMatchSize);
 	}
 }
\ No newline at end of file
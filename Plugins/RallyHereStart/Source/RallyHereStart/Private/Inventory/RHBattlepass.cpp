@@ -5,6 +5,7 @@
 #include "RH_PlayerInfoSubsystem.h"
 #include "RH_CatalogSubsystem.h"
 #include "Inventory/RHBattlepass.h"
+#include "Engine/AssetManager.h"
 
 URHBattlepass::URHBattlepass(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
 	: Super(ObjectInitializer)
@@ -15,7 +16,12 @@ URHBattlepass::URHBattlepass(const FObjectInitializer& ObjectInitializer /*= FOb
 	FreeIconInfo = CreateDefaultSubobject<UImageIconInfo>(TEXT("FreeIconInfo"));
 	PremiumIconInfo = CreateDefaultSubobject<UImageIconInfo>(TEXT("PremiumIconInfo"));
 	RewardsFullyLoaded = false;
+	AllRewardAssetPagesLoaded = false;
 	InstantUnlocksFullyLoaded = false;
+	RewardAssetPageSize = 10;
+	NumRewardAssetPagesLoaded = 0;
+	InitialRewardAssetPage = INDEX_NONE;
+	PriorityLevelNumber = 0;
 }
 
 void URHBattlepass::AppendRequiredLootTableIds(TArray<int32>& LootTableIds)
@@ -28,6 +34,21 @@ void URHBattlepass::AppendRequiredLootTableIds(TArray<int32>& LootTableIds)
 	LootTableIds.Push(PurchaseVendorId);
 }
 
+void URHBattlepass::AppendPrefetchAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const
+{
+	Super::AppendPrefetchAssetPaths(OutAssetPaths);
+
+	if (FreeIconInfo != nullptr)
+	{
+		FreeIconInfo->AppendIconAssetPaths(OutAssetPaths);
+	}
+
+	if (PremiumIconInfo != nullptr)
+	{
+		PremiumIconInfo->AppendIconAssetPaths(OutAssetPaths);
+	}
+}
+
 void URHBattlepass::GetTotalXpProgress(URH_PlayerInfo* PlayerInfo, const FRH_GetInventoryCountBlock& Delegate)
 {
 	if (ProgressItemId.IsValid() && PlayerInfo != nullptr)
@@ -56,9 +77,18 @@ void URHBattlepass::GetCurrentLevel(URH_PlayerInfo* PlayerInfo, const FRH_GetInv
 					{
 						if (URH_PlayerInventory* PlayerInventory = PlayerInfo->GetPlayerInventory())
 						{
-							PlayerInventory->GetInventoryCount(ProgressItemId, FRH_GetInventoryCountDelegate::CreateWeakLambda(this, [XpTable, Delegate](int32 Count)
+							PlayerInventory->GetInventoryCount(ProgressItemId, FRH_GetInventoryCountDelegate::CreateWeakLambda(this, [this, XpTable, Delegate](int32 Count)
 								{
-									Delegate.ExecuteIfBound(URH_CatalogBlueprintLibrary::GetLevelAtXp(XpTable, Count));
+									const int32 CurrentLevel = URH_CatalogBlueprintLibrary::GetLevelAtXp(XpTable, Count);
+
+									// The rewards the player is working towards are the ones most likely to be looked at first
+									PriorityLevelNumber = CurrentLevel + 1;
+									if (RewardAssetPageHandles.Num() > 0)
+									{
+										StreamRewardAssetsForLevels(PriorityLevelNumber, PriorityLevelNumber);
+									}
+
+									Delegate.ExecuteIfBound(CurrentLevel);
 								}));
 							return;
 						}
@@ -105,77 +135,200 @@ TArray<URHBattlepassLevel*> URHBattlepass::GetLevels(const UObject* WorldContext
 	{
 		if (URHStoreItemHelper* StoreItemHelper = GetStoreItemHelper(WorldContextObject))
 		{
-			// First Create the Levels from the XP table
-			FRHAPI_XpTable XpTable;
-			if (StoreItemHelper->GetXpTable(XpTableId, XpTable))
+			BuildLevelModel(StoreItemHelper);
+		}
+	}
+
+	return CachedBattlepassLevels;
+}
+
+void URHBattlepass::BuildLevelModel(URHStoreItemHelper* StoreItemHelper)
+{
+	LevelEndXp.Reset();
+	LevelRewardOffsets.Reset();
+	CachedLevelRewards.Reset();
+	CachedBattlepassLevels.Reset();
+
+	// First Create the Levels from the XP table, each boundary is looked up once and doubles as the next level's start
+	FRHAPI_XpTable XpTable;
+	if (StoreItemHelper->GetXpTable(XpTableId, XpTable))
+	{
+		if (const auto& Entries = XpTable.GetXpEntriesOrNull())
+		{
+			LevelEndXp.SetNumUninitialized((*Entries).Num());
+
+			for (int32 i = 0; i < LevelEndXp.Num(); ++i)
 			{
-				if (const auto& Entries = XpTable.GetXpEntriesOrNull())
+				LevelEndXp[i] = URH_CatalogBlueprintLibrary::GetXpAtLevel(XpTable, i);
+			}
+		}
+	}
+
+	const int32 NumLevels = LevelEndXp.Num();
+
+	// Then fill out the rewards, bucketing them by level in a single pass with free track rewards ahead of premium ones
+	TArray<URHBattlepassRewardItem*> Rewards;
+	TArray<int32> RewardLevelCounts;
+	RewardLevelCounts.SetNumZeroed(NumLevels);
+
+	auto GatherRewards = [StoreItemHelper, NumLevels, &Rewards, &RewardLevelCounts](int32 VendorId, EBattlepassTrackType TrackType)
+	{
+		if (VendorId > 0)
+		{
+			for (URHStoreItem* StoreItem : StoreItemHelper->GetStoreItemsForVendor(VendorId, false, false))
+			{
+				const int32 LevelNumber = StoreItem->GetSortOrder();
+
+				if (LevelNumber > 0 && LevelNumber <= NumLevels)
 				{
-					int32 i = 0;
-					for (const auto& Entry : *Entries)
+					if (URHBattlepassRewardItem* NewReward = NewObject<URHBattlepassRewardItem>())
 					{
-						if (URHBattlepassLevel* NewLevel = NewObject<URHBattlepassLevel>())
-						{
-							// We index our XP levels where the player starts at 0 and earns XP to become level 1
-							NewLevel->LevelNumber = i + 1;
-							NewLevel->StartXp = i > 0 ? URH_CatalogBlueprintLibrary::GetXpAtLevel(XpTable, i - 1) : 0, URH_CatalogBlueprintLibrary::GetXpAtLevel(XpTable, i);
-							NewLevel->EndXp = URH_CatalogBlueprintLibrary::GetXpAtLevel(XpTable, i);
-							CachedBattlepassLevels.Push(NewLevel);
-						}
-						i++;
+						NewReward->Item = StoreItem;
+						NewReward->Track = TrackType;
+						Rewards.Push(NewReward);
+						++RewardLevelCounts[LevelNumber - 1];
 					}
 				}
 			}
+		}
+	};
 
-			// Then fill out the rewards
-			auto FillOutRewards = [this, StoreItemHelper](int32 VendorId, EBattlepassTrackType TrackType)
-			{
-				if (VendorId > 0)
-				{
-					TArray<URHStoreItem*> StoreItems = StoreItemHelper->GetStoreItemsForVendor(VendorId, false, false);
+	GatherRewards(FreeRewardVendorId, EBattlepassTrackType::EFreeTrack);
+	GatherRewards(PremiumRewardVendorId, EBattlepassTrackType::EPremiumTrack);
 
-					TArray<FSoftObjectPath> AssetsToLoad;
+	LevelRewardOffsets.SetNumUninitialized(NumLevels + 1);
+	LevelRewardOffsets[0] = 0;
+	for (int32 i = 0; i < NumLevels; ++i)
+	{
+		LevelRewardOffsets[i + 1] = LevelRewardOffsets[i] + RewardLevelCounts[i];
+	}
 
-					for (URHStoreItem* StoreItem : StoreItems)
-					{
-						int32 LevelNumber = StoreItem->GetSortOrder();
+	// Reuse the counts as the write cursor of each level
+	CachedLevelRewards.SetNumZeroed(Rewards.Num());
+	for (int32 i = 0; i < NumLevels; ++i)
+	{
+		RewardLevelCounts[i] = LevelRewardOffsets[i];
+	}
 
-						if (!StoreItem->GetInventoryItem().IsValid())
-						{
-							AssetsToLoad.Add(StoreItem->GetInventoryItem().ToSoftObjectPath());
-						}
+	for (URHBattlepassRewardItem* Reward : Rewards)
+	{
+		CachedLevelRewards[RewardLevelCounts[Reward->GetRewardLevel() - 1]++] = Reward;
+	}
 
-						if (LevelNumber > 0)
-						{
-							if (URHBattlepassLevel* Level = GetBattlepassLevel(LevelNumber))
-							{
-								if (URHBattlepassRewardItem* NewReward = NewObject<URHBattlepassRewardItem>())
-								{
-									NewReward->Item = StoreItem;
-									NewReward->Track = TrackType;
-									Level->RewardItems.Push(NewReward);
-								}
-							}
-						}
-					}
+	CachedBattlepassLevels.Reserve(NumLevels);
+	for (int32 i = 0; i < NumLevels; ++i)
+	{
+		if (URHBattlepassLevel* NewLevel = NewObject<URHBattlepassLevel>())
+		{
+			// We index our XP levels where the player starts at 0 and earns XP to become level 1
+			NewLevel->LevelNumber = i + 1;
+			NewLevel->StartXp = i > 0 ? LevelEndXp[i - 1] : 0;
+			NewLevel->EndXp = LevelEndXp[i];
+			NewLevel->RewardItems.Append(CachedLevelRewards.GetData() + LevelRewardOffsets[i], LevelRewardOffsets[i + 1] - LevelRewardOffsets[i]);
+			CachedBattlepassLevels.Push(NewLevel);
+		}
+	}
 
-					if (AssetsToLoad.Num() > 0)
-					{
-						UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad, FStreamableDelegate::CreateUObject(this, &URHBattlepass::RewardAssetsFullyLoaded));
-					}
-					else
-					{
-						RewardAssetsFullyLoaded();
-					}
-				}
-			};
+	// Reward assets are streamed a page at a time as the levels are shown
+	const int32 NumPages = FMath::DivideAndRoundUp(NumLevels, FMath::Max(RewardAssetPageSize, 1));
+	RewardAssetPageHandles.Reset();
+	RewardAssetPageHandles.SetNum(NumPages);
+	RewardAssetPagesRequested.Init(false, NumPages);
+	RewardAssetPagesLoaded.Init(false, NumPages);
+	NumRewardAssetPagesLoaded = 0;
+	RewardsFullyLoaded = false;
+	AllRewardAssetPagesLoaded = false;
+
+	if (NumPages == 0)
+	{
+		InitialRewardAssetPage = INDEX_NONE;
+		RewardAssetsFullyLoaded();
+		AllRewardAssetPagesLoaded = true;
+		return;
+	}
+
+	// The rewards count as loaded once the first page shown is, that is the page the player is earning towards if it is known yet
+	const int32 PageSize = FMath::Max(RewardAssetPageSize, 1);
+	InitialRewardAssetPage = PriorityLevelNumber > 0 ? FMath::Min((PriorityLevelNumber - 1) / PageSize, NumPages - 1) : 0;
+	RequestRewardAssetPage(InitialRewardAssetPage, FStreamableManager::AsyncLoadHighPriority);
+}
+
+void URHBattlepass::StreamRewardAssetsForLevels(int32 FirstLevelNumber, int32 LastLevelNumber)
+{
+	const int32 NumPages = RewardAssetPageHandles.Num();
+	if (NumPages == 0)
+	{
+		return;
+	}
+
+	const int32 PageSize = FMath::Max(RewardAssetPageSize, 1);
+
+	if (PriorityLevelNumber > 0)
+	{
+		RequestRewardAssetPage(FMath::Min((PriorityLevelNumber - 1) / PageSize, NumPages - 1), FStreamableManager::AsyncLoadHighPriority);
+	}
+
+	const int32 FirstPage = FMath::Clamp((FirstLevelNumber - 1) / PageSize, 0, NumPages - 1);
+	const int32 LastPage = FMath::Clamp((LastLevelNumber - 1) / PageSize, FirstPage, NumPages - 1);
+
+	for (int32 PageIndex = FirstPage; PageIndex <= LastPage; ++PageIndex)
+	{
+		RequestRewardAssetPage(PageIndex, FStreamableManager::DefaultAsyncLoadPriority);
+	}
+}
+
+void URHBattlepass::RequestRewardAssetPage(int32 PageIndex, int32 Priority)
+{
+	if (!RewardAssetPagesRequested.IsValidIndex(PageIndex) || RewardAssetPagesRequested[PageIndex])
+	{
+		return;
+	}
 
-			FillOutRewards(FreeRewardVendorId, EBattlepassTrackType::EFreeTrack);
-			FillOutRewards(PremiumRewardVendorId, EBattlepassTrackType::EPremiumTrack);
+	RewardAssetPagesRequested[PageIndex] = true;
+
+	const int32 PageSize = FMath::Max(RewardAssetPageSize, 1);
+	const int32 FirstLevelIndex = PageIndex * PageSize;
+	const int32 EndLevelIndex = FMath::Min(FirstLevelIndex + PageSize, LevelEndXp.Num());
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (int32 i = LevelRewardOffsets[FirstLevelIndex]; i < LevelRewardOffsets[EndLevelIndex]; ++i)
+	{
+		URHStoreItem* StoreItem = CachedLevelRewards[i]->Item;
+		if (StoreItem != nullptr && !StoreItem->GetInventoryItem().IsNull() && !StoreItem->GetInventoryItem().IsValid())
+		{
+			AssetsToLoad.AddUnique(StoreItem->GetInventoryItem().ToSoftObjectPath());
 		}
 	}
 
-	return CachedBattlepassLevels;
+	if (AssetsToLoad.Num() > 0)
+	{
+		RewardAssetPageHandles[PageIndex] = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad, FStreamableDelegate::CreateUObject(this, &URHBattlepass::OnRewardAssetPageLoaded, PageIndex), Priority);
+	}
+	else
+	{
+		OnRewardAssetPageLoaded(PageIndex);
+	}
+}
+
+void URHBattlepass::OnRewardAssetPageLoaded(int32 PageIndex)
+{
+	if (!RewardAssetPagesLoaded.IsValidIndex(PageIndex) || RewardAssetPagesLoaded[PageIndex])
+	{
+		return;
+	}
+
+	RewardAssetPagesLoaded[PageIndex] = true;
+
+	if (PageIndex == InitialRewardAssetPage)
+	{
+		RewardAssetsFullyLoaded();
+	}
+
+	if (++NumRewardAssetPagesLoaded >= RewardAssetPageHandles.Num())
+	{
+		AllRewardAssetPagesLoaded = true;
+		OnAllRewardAssetPagesLoaded.Broadcast();
+	}
 }
 
 void URHBattlepass::RewardAssetsFullyLoaded()
@@ -230,15 +383,7 @@ TArray<URHBattlepassRewardItem*> URHBattlepass::GetInstantUnlockRewards(const UO
 
 URHBattlepassLevel* URHBattlepass::GetBattlepassLevel(int32 LevelNumber) const
 {
-	for (URHBattlepassLevel* Level : CachedBattlepassLevels)
-	{
-		if (Level->LevelNumber == LevelNumber)
-		{
-			return Level;
-		}
-	}
-
-	return nullptr;
+	return CachedBattlepassLevels.IsValidIndex(LevelNumber - 1) ? CachedBattlepassLevels[LevelNumber - 1] : nullptr;
 }
 
 URHStoreItemHelper* URHBattlepass::GetStoreItemHelper(const UObject* WorldContextObject)
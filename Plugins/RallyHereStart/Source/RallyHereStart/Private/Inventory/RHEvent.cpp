@@ -4,6 +4,7 @@
 #include "Managers/RHStoreItemHelper.h"
 #include "Managers/RHEventManager.h"
 #include "RH_PlayerInfoSubsystem.h"
+#include "Inventory/IconInfo.h"
 #include "Inventory/RHEvent.h"
 
 URHEvent::URHEvent(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
@@ -15,6 +16,22 @@ URHEvent::URHEvent(const FObjectInitializer& ObjectInitializer /*= FObjectInitia
 	CollectionContainer.AddTag(EventCollectionTag);
 }
 
+void URHEvent::AppendPrefetchAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const
+{
+	if (ItemIconInfo != nullptr)
+	{
+		ItemIconInfo->AppendIconAssetPaths(OutAssetPaths);
+	}
+
+	for (const FIconReference& IconReference : Icons)
+	{
+		if (IconReference.IconInfo != nullptr)
+		{
+			IconReference.IconInfo->AppendIconAssetPaths(OutAssetPaths);
+		}
+	}
+}
+
 int32 URHEvent::GetRemainingSeconds(const UObject* WorldContextObject) const
 {
 	UWorld* const World = GEngine != nullptr ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
@@ -400,6 +400,7 @@ void ARHLobbyHUD::ShowPopupConfirmation(FText Message, ESocialMessageType Messag
             FRHPopupConfig errorPopupParams;
             errorPopupParams.Description = Message;
             errorPopupParams.IsImportant = true;
+            errorPopupParams.CanBeCoalesced = true;
             errorPopupParams.CancelAction.AddDynamic(popup, &URHPopupManager::OnPopupCanceled);
 
             FRHPopupButtonConfig& confirmErrorBtn = (errorPopupParams.Buttons[errorPopupParams.Buttons.Add(FRHPopupButtonConfig())]);
@@ -430,6 +431,7 @@ void ARHLobbyHUD::ShowPopupConfirmation(FText Message, ESocialMessageType Messag
             FRHPopupConfig genericPopupParams;
             genericPopupParams.Description = Message;
             genericPopupParams.IsImportant = true;
+            genericPopupParams.CanBeCoalesced = true;
             genericPopupParams.CancelAction.AddDynamic(popup, &URHPopupManager::OnPopupCanceled);
 
             FRHPopupButtonConfig& confirmGenericBtn = (genericPopupParams.Buttons[genericPopupParams.Buttons.Add(FRHPopupButtonConfig())]);
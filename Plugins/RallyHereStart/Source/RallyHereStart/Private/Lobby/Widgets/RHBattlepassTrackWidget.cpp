@@ -13,12 +13,9 @@ void URHBattlepassTrackWidget::SetBattlepass(URHBattlepass* InBattlepass)
 		// Append the instant unlocks first
 		RewardItems.Append(Battlepass->GetInstantUnlockRewards(this));
 		
-		TArray<URHBattlepassLevel*> Levels = Battlepass->GetLevels(this);
-
-		for (URHBattlepassLevel* Level : Levels)
-		{
-			RewardItems.Append(Level->RewardItems);
-		}
+		// Level rewards are already grouped in level order
+		Battlepass->GetLevels(this);
+		RewardItems.Append(Battlepass->GetCachedLevelRewards());
 	}
 
 	if (ItemButtons.Num())
@@ -46,12 +43,27 @@ void URHBattlepassTrackWidget::GetRewardItemsForPage(int32 Index, TArray<URHBatt
 			TargetIndex = FMath::Max(0, RewardItems.Num() - PageSize);
 		}
 
+		int32 FirstLevel = MAX_int32;
+		int32 LastLevel = 0;
+
 		for (int32 i = TargetIndex; i < TargetIndex + PageSize; ++i)
 		{
 			if (i < RewardItems.Num())
 			{
 				OutRewardItems.Push(RewardItems[i]);
+
+				if (RewardItems[i]->Track != EBattlepassTrackType::EInstantUnlock)
+				{
+					FirstLevel = FMath::Min(FirstLevel, RewardItems[i]->GetRewardLevel());
+					LastLevel = FMath::Max(LastLevel, RewardItems[i]->GetRewardLevel());
+				}
 			}
 		}
+
+		// Only stream in the reward assets for the levels that are being shown
+		if (LastLevel > 0)
+		{
+			Battlepass->StreamRewardAssetsForLevels(FirstLevel, LastLevel);
+		}
 	}
 }
\ No newline at end of file
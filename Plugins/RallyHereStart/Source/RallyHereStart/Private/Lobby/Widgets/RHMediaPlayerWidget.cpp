@@ -25,6 +25,15 @@ void URHMediaPlayerWidget::InitializeWidget_Implementation()
 	Super::InitializeWidget_Implementation();
 }
 
+void URHMediaPlayerWidget::UninitializeWidget_Implementation()
+{
+	UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::UninitializeWidget_Implementation()"));
+
+	CleanUp();
+
+	Super::UninitializeWidget_Implementation();
+}
+
 void URHMediaPlayerWidget::ShowWidget()
 {
 	UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::ShowWidget()"));
@@ -42,8 +51,12 @@ void URHMediaPlayerWidget::CleanUp()
 	CleanupAsyncLoadHandle();
 	ClearUpdateSkipPromptDelayTimer();
 	SetCurrentEntrySkippable(false);
+	FlushWatchedActions();
 	bPlaying = false;
 	PlaylistEntriesWatched = 0;
+	CurrentPlaylistEntry = nullptr;
+	ResolvedPlaylist.Reset();
+	bPlaylistResolved = false;
 }
 
 void URHMediaPlayerWidget::CloseMediaPlayerWidget()
@@ -62,6 +75,13 @@ void URHMediaPlayerWidget::CleanupAsyncLoadHandle()
 	}
 	
 	MediaAsyncLoadHandle.Reset();
+
+	if (NextMediaAsyncLoadHandle.IsValid())
+	{
+		NextMediaAsyncLoadHandle->CancelHandle();
+	}
+
+	NextMediaAsyncLoadHandle.Reset();
 }
 
 void URHMediaPlayerWidget::PlayNextPlaylistEntry()
@@ -72,83 +92,145 @@ void URHMediaPlayerWidget::PlayNextPlaylistEntry()
 	ClearUpdateSkipPromptDelayTimer();
 	SetCurrentEntrySkippable(false);
 
-	CleanupAsyncLoadHandle();
-
-	if (!bOnlyWatchFirstEntry || PlaylistEntriesWatched == 0)
+	// release the entry that just finished (or cancel it if it was skipped before loading), the next one may already be streamed in
+	if (MediaAsyncLoadHandle.IsValid())
 	{
-		if (PlaylistDataTable)
+		if (MediaAsyncLoadHandle->IsLoadingInProgress())
 		{
-			bPlaying = true;
-
-			// queue up the first media player entry for playback
-			TArray<FName> RowNames = PlaylistDataTable->GetRowNames();
-			int PlaylistSkipCount = PlaylistEntriesWatched;
-			for (auto& RowName : RowNames)
-			{
-				if (PlaylistSkipCount > 0)
-				{
-					PlaylistSkipCount--;
-					continue;
-				}
-				
-				CurrentPlaylistEntry = PlaylistDataTable->FindRow<FRHMediaPlayerWidgetPlaylistEntry>(RowName, "Get playList entry.");
-				if (!CurrentPlaylistEntry)
-				{
-					continue;
-				}
-
-				bool bHaveWatchedBefore = false;
-				if (!CurrentPlaylistEntry->LocalActionName.IsNone())
-				{
-					if (URHGameUserSettings* GameSettings = Cast<URHGameUserSettings>(GEngine->GetGameUserSettings()))
-					{
-						bHaveWatchedBefore = GameSettings->IsLocalActionSaved(CurrentPlaylistEntry->LocalActionName);
-
-						if (!bHaveWatchedBefore)
-						{
-							GameSettings->SaveLocalAction(CurrentPlaylistEntry->LocalActionName);
-						}
-					}
-				}
-
-				bool bBlockSkipping = false;
-				if (bHaveWatchedBefore && CurrentPlaylistEntry->bOnlyWatchOnce)
-				{
-					// skip it, we've seen it and it's marked only to be watched once
-					continue;
-				}
-				else
-				{
-					// should we block skipping on the first watch?
-					bBlockSkipping = (CurrentPlaylistEntry->bForceFirstWatch && !bHaveWatchedBefore) ? true : !CurrentPlaylistEntry->bIsSkippable;
-				}
-				
-				SetupSkipPrompting(bBlockSkipping, CurrentPlaylistEntry->SkippableAfter);
-
-				UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::PlayNextPlaylistEntry() - passing up the next entry for playback to the view layer."));
-				PlaylistEntriesWatched++;
-
-				// update view layer with loading state
-				OnBeginLoadingMedia();
-
-				// load the media entry assets from the softobj pointers
-				TArray<FSoftObjectPath> MediaPaths = { CurrentPlaylistEntry->PlatformMediaSource.ToSoftObjectPath() };
-				struct FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
-				MediaAsyncLoadHandle = StreamableManager.RequestAsyncLoad(MediaPaths, FStreamableDelegate::CreateUObject(this, &URHMediaPlayerWidget::HandleMediaLoaded));
-				return;
-			}
-			
-			// if we get here, we've watched all of the entries
-			UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::PlayNextPlaylistEntry() - No more entries to watch."));
+			MediaAsyncLoadHandle->CancelHandle();
 		}
 		else
 		{
-			// problem loading playlist entries
-			UE_LOG(RallyHereStart, Warning, TEXT("URHMediaPlayerWidget::PlayNextPlaylistEntry() - Problem loading playlist entries."));
+			MediaAsyncLoadHandle->ReleaseHandle();
 		}
 	}
+	MediaAsyncLoadHandle.Reset();
+
+	if (!PlaylistDataTable)
+	{
+		// problem loading playlist entries
+		UE_LOG(RallyHereStart, Warning, TEXT("URHMediaPlayerWidget::PlayNextPlaylistEntry() - Problem loading playlist entries."));
+		CloseMediaPlayerWidget();
+		return;
+	}
 
-	CloseMediaPlayerWidget();
+	if (!bPlaylistResolved)
+	{
+		ResolvePlaylist();
+	}
+
+	if (!ResolvedPlaylist.IsValidIndex(PlaylistEntriesWatched))
+	{
+		// if we get here, we've watched all of the entries
+		UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::PlayNextPlaylistEntry() - No more entries to watch."));
+		CloseMediaPlayerWidget();
+		return;
+	}
+
+	bPlaying = true;
+
+	const FRHMediaPlayerResolvedEntry& NextEntry = ResolvedPlaylist[PlaylistEntriesWatched];
+	CurrentPlaylistEntry = NextEntry.Entry;
+
+	if (!CurrentPlaylistEntry->LocalActionName.IsNone())
+	{
+		PendingWatchedActions.AddUnique(CurrentPlaylistEntry->LocalActionName);
+	}
+
+	SetupSkipPrompting(NextEntry.bBlockSkipping, CurrentPlaylistEntry->SkippableAfter);
+
+	UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::PlayNextPlaylistEntry() - passing up the next entry for playback to the view layer."));
+	PlaylistEntriesWatched++;
+
+	// update view layer with loading state
+	OnBeginLoadingMedia();
+
+	// pick up the preload of this entry if there is one
+	MediaAsyncLoadHandle = NextMediaAsyncLoadHandle;
+	NextMediaAsyncLoadHandle.Reset();
+
+	if (MediaAsyncLoadHandle.IsValid() && MediaAsyncLoadHandle->HasLoadCompleted())
+	{
+		HandleMediaLoaded();
+	}
+	else if (!MediaAsyncLoadHandle.IsValid() || !MediaAsyncLoadHandle->BindCompleteDelegate(FStreamableDelegate::CreateUObject(this, &URHMediaPlayerWidget::HandleMediaLoaded)))
+	{
+		// load the media entry assets from the softobj pointers
+		TArray<FSoftObjectPath> MediaPaths = { CurrentPlaylistEntry->PlatformMediaSource.ToSoftObjectPath() };
+		struct FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+		MediaAsyncLoadHandle = StreamableManager.RequestAsyncLoad(MediaPaths, FStreamableDelegate::CreateUObject(this, &URHMediaPlayerWidget::HandleMediaLoaded));
+	}
+}
+
+void URHMediaPlayerWidget::ResolvePlaylist()
+{
+	UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::ResolvePlaylist()"));
+
+	ResolvedPlaylist.Reset();
+	bPlaylistResolved = true;
+
+	if (!PlaylistDataTable)
+	{
+		return;
+	}
+
+	const URHGameUserSettings* GameSettings = Cast<URHGameUserSettings>(GEngine->GetGameUserSettings());
+
+	for (const auto& RowPair : PlaylistDataTable->GetRowMap())
+	{
+		FRHMediaPlayerWidgetPlaylistEntry* Entry = reinterpret_cast<FRHMediaPlayerWidgetPlaylistEntry*>(RowPair.Value);
+		if (Entry == nullptr)
+		{
+			continue;
+		}
+
+		const bool bHaveWatchedBefore = !Entry->LocalActionName.IsNone() && GameSettings != nullptr && GameSettings->IsLocalActionSaved(Entry->LocalActionName);
+		if (bHaveWatchedBefore && Entry->bOnlyWatchOnce)
+		{
+			// skip it, we've seen it and it's marked only to be watched once
+			continue;
+		}
+
+		FRHMediaPlayerResolvedEntry& ResolvedEntry = ResolvedPlaylist.AddDefaulted_GetRef();
+		ResolvedEntry.Entry = Entry;
+		// should we block skipping on the first watch?
+		ResolvedEntry.bBlockSkipping = (Entry->bForceFirstWatch && !bHaveWatchedBefore) ? true : !Entry->bIsSkippable;
+
+		if (bOnlyWatchFirstEntry)
+		{
+			break;
+		}
+	}
+}
+
+void URHMediaPlayerWidget::PreloadNextPlaylistEntry()
+{
+	if (NextMediaAsyncLoadHandle.IsValid() || !ResolvedPlaylist.IsValidIndex(PlaylistEntriesWatched))
+	{
+		return;
+	}
+
+	const FSoftObjectPath NextMediaPath = ResolvedPlaylist[PlaylistEntriesWatched].Entry->PlatformMediaSource.ToSoftObjectPath();
+	if (!NextMediaPath.IsNull())
+	{
+		UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::PreloadNextPlaylistEntry() - streaming in %s."), *NextMediaPath.ToString());
+		NextMediaAsyncLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(NextMediaPath, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority - 1);
+	}
+}
+
+void URHMediaPlayerWidget::FlushWatchedActions()
+{
+	if (PendingWatchedActions.Num() == 0)
+	{
+		return;
+	}
+
+	if (URHGameUserSettings* GameSettings = Cast<URHGameUserSettings>(GEngine->GetGameUserSettings()))
+	{
+		GameSettings->SaveLocalActions(PendingWatchedActions);
+	}
+
+	PendingWatchedActions.Reset();
 }
 
 void URHMediaPlayerWidget::HandleMediaLoaded()
@@ -157,11 +239,14 @@ void URHMediaPlayerWidget::HandleMediaLoaded()
 
 	OnEndLoadingMedia();
 	
-	UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::HandleMediaLoaded() %p %i %i %i"), CurrentPlaylistEntry, MediaAsyncLoadHandle.IsValid(), MediaAsyncLoadHandle->HasLoadCompleted(), CurrentPlaylistEntry ? (int32)CurrentPlaylistEntry->PlatformMediaSource.IsValid() : -1);
+	UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::HandleMediaLoaded() %p %i %i %i"), CurrentPlaylistEntry, MediaAsyncLoadHandle.IsValid(), MediaAsyncLoadHandle.IsValid() && MediaAsyncLoadHandle->HasLoadCompleted(), CurrentPlaylistEntry ? (int32)CurrentPlaylistEntry->PlatformMediaSource.IsValid() : -1);
 	if (CurrentPlaylistEntry && MediaAsyncLoadHandle.IsValid() && MediaAsyncLoadHandle->HasLoadCompleted() && CurrentPlaylistEntry->PlatformMediaSource.IsValid())
 	{
 		UE_LOG(RallyHereStart, Verbose, TEXT("URHMediaPlayerWidget::HandleMediaLoaded() - passing up the next entry for playback to the view layer."));
 		OnReadyForPlayback(CurrentPlaylistEntry->PlatformMediaSource.Get());
+
+		// stream the following entry in while this one plays
+		PreloadNextPlaylistEntry();
 	}
 }
 
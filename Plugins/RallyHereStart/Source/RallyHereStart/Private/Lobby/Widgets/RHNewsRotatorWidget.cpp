@@ -14,6 +14,7 @@ void URHNewsRotatorWidget::InitializeWidget_Implementation()
     if (URHJsonDataFactory* pJsonDataFactory = GetJsonDataFactory())
     {
         pJsonDataFactory->JsonPanelUpdated.AddDynamic(this, &URHNewsRotatorWidget::OnJsonChanged);
+        pJsonDataFactory->JsonPanelsInvalidated.AddDynamic(this, &URHNewsRotatorWidget::OnJsonPanelsInvalidated);
     }
 }
 
@@ -24,95 +25,112 @@ void URHNewsRotatorWidget::UninitializeWidget_Implementation()
     if (URHJsonDataFactory* pJsonDataFactory = GetJsonDataFactory())
     {
         pJsonDataFactory->JsonPanelUpdated.RemoveDynamic(this, &URHNewsRotatorWidget::OnJsonChanged);
+        pJsonDataFactory->JsonPanelsInvalidated.RemoveDynamic(this, &URHNewsRotatorWidget::OnJsonPanelsInvalidated);
     }
 }
 
 void URHNewsRotatorWidget::GetPanelDataAsync(FOnGetNewsRotatorPanelsBlock Delegate /*= FOnGetNewsRotatorPanelsBlock()*/)
+{
+    if (URHJsonDataFactory* pJsonDataFactory = GetJsonDataFactory())
+    {
+		// Only rebuild the panel models when the document, its images or the display language changed since they were built
+		const int32 Revision = pJsonDataFactory->GetJsonPanelRevision(TEXT("landingpanel"));
+		const FString Culture = FInternationalization::Get().GetCurrentCulture()->GetName();
+
+		if (Revision != CachedPanelsRevision || Culture != CachedPanelsCulture)
+		{
+			RebuildPanelModels(pJsonDataFactory);
+			CachedPanelsRevision = Revision;
+			CachedPanelsCulture = Culture;
+		}
+    }
+    else
+    {
+        UE_LOG(RallyHereStart, Warning, TEXT("URHNewsRotatorWidget::GetPanelData failed to get JsonDataFactory -- delegates will not be bound."));
+    }
+
+	CheckShouldShowPanels(CachedPanels, Delegate);
+}
+
+void URHNewsRotatorWidget::RebuildPanelModels(URHJsonDataFactory* pJsonDataFactory)
 {
     TArray<URHNewsRotatorData*> Panels;
 
-    if (URHJsonDataFactory* pJsonDataFactory = GetJsonDataFactory())
+    TSharedPtr<FJsonObject> LandingPanelJson = pJsonDataFactory->GetJsonPanelByName(TEXT("landingpanel"));
+
+    if (LandingPanelJson.IsValid())
     {
-        TSharedPtr<FJsonObject> LandingPanelJson = pJsonDataFactory->GetJsonPanelByName(TEXT("landingpanel"));
+        const TSharedPtr<FJsonObject>* JsonSectionObj;
 
-        if (LandingPanelJson.IsValid())
+        if (LandingPanelJson.Get()->TryGetObjectField(JsonSection, JsonSectionObj))
         {
-            const TSharedPtr<FJsonObject>* JsonSectionObj;
+            const TArray<TSharedPtr<FJsonValue>>* JsonSectionContents;
 
-            if (LandingPanelJson.Get()->TryGetObjectField(JsonSection, JsonSectionObj))
+            if ((*JsonSectionObj)->TryGetArrayField(TEXT("content"), JsonSectionContents))
             {
-                const TArray<TSharedPtr<FJsonValue>>* JsonSectionContents;
-
-                if ((*JsonSectionObj)->TryGetArrayField(TEXT("content"), JsonSectionContents))
+                for (TSharedPtr<FJsonValue> JsonContents : *JsonSectionContents)
                 {
-                    for (TSharedPtr<FJsonValue> JsonContents : *JsonSectionContents)
-                    {
-                        const TSharedPtr<FJsonObject>* JsonRotatorObj;
+                    const TSharedPtr<FJsonObject>* JsonRotatorObj;
 
-                        if (JsonContents->TryGetObject(JsonRotatorObj))
+                    if (JsonContents->TryGetObject(JsonRotatorObj))
+                    {
+                        if (URHNewsRotatorData* Panel = NewObject<URHNewsRotatorData>())
                         {
-                            if (URHNewsRotatorData* Panel = NewObject<URHNewsRotatorData>())
-                            {
-                                const TSharedPtr<FJsonObject>* ObjectField;
-                                int32 NumValue;
-
-                                if ((*JsonRotatorObj)->TryGetNumberField(TEXT("type"), NumValue))
-                                {
-                                    Panel->PanelAction = (ENewsActions)NumValue;
-                                }
+                            const TSharedPtr<FJsonObject>* ObjectField;
+                            int32 NumValue;
 
-                                if ((*JsonRotatorObj)->TryGetObjectField(TEXT("actionDetails"), ObjectField))
-                                {
-                                    Panel->ActionDetails = URHJsonDataFactory::GetLocalizedStringFromObject(ObjectField);
-                                }
+                            if ((*JsonRotatorObj)->TryGetNumberField(TEXT("type"), NumValue))
+                            {
+                                Panel->PanelAction = (ENewsActions)NumValue;
+                            }
 
-								if ((*JsonRotatorObj)->TryGetObjectField(TEXT("headerText"), ObjectField))
-								{
-									Panel->Header = FText::FromString(URHJsonDataFactory::GetLocalizedStringFromObject(ObjectField));
-								}
+                            if ((*JsonRotatorObj)->TryGetObjectField(TEXT("actionDetails"), ObjectField))
+                            {
+                                Panel->ActionDetails = URHJsonDataFactory::GetLocalizedStringFromObject(ObjectField);
+                            }
 
-								if ((*JsonRotatorObj)->TryGetObjectField(TEXT("bodyText"), ObjectField))
-								{
-									Panel->Body = FText::FromString(URHJsonDataFactory::GetLocalizedStringFromObject(ObjectField));
-								}
+							if ((*JsonRotatorObj)->TryGetObjectField(TEXT("headerText"), ObjectField))
+							{
+								Panel->Header = FText::FromString(URHJsonDataFactory::GetLocalizedStringFromObject(ObjectField));
+							}
 
-                                if ((*JsonRotatorObj)->TryGetObjectField(TEXT("imageUrl"), ObjectField))
-                                {
-                                    Panel->Image = pJsonDataFactory->GetTextureByRemoteURL(ObjectField);
+							if ((*JsonRotatorObj)->TryGetObjectField(TEXT("bodyText"), ObjectField))
+							{
+								Panel->Body = FText::FromString(URHJsonDataFactory::GetLocalizedStringFromObject(ObjectField));
+							}
 
-									// If the URL was invalid (404) we didn't save the texture, so skip adding this panel
-									if (!Panel->Image)
-									{
-										continue;
-									}
-                                }
+                            if ((*JsonRotatorObj)->TryGetObjectField(TEXT("imageUrl"), ObjectField))
+                            {
+                                Panel->Image = pJsonDataFactory->GetTextureByRemoteURL(ObjectField);
 
-								(*JsonRotatorObj)->TryGetBoolField(TEXT("trackClicks"), Panel->bTrackClicks);
-								if (!(*JsonRotatorObj)->TryGetNumberField(TEXT("numCohortGroups"), Panel->NumGroups))
-								{
-									Panel->NumGroups = INDEX_NONE;
-								}
-								if (!(*JsonRotatorObj)->TryGetNumberField(TEXT("cohortGroupToShowFor"), Panel->GroupToShowFor))
+								// If the URL was invalid (404) we didn't save the texture, so skip adding this panel
+								if (!Panel->Image)
 								{
-									Panel->GroupToShowFor = INDEX_NONE;
+									continue;
 								}
+                            }
 
-                                pJsonDataFactory->LoadData(Panel, JsonRotatorObj);
+							(*JsonRotatorObj)->TryGetBoolField(TEXT("trackClicks"), Panel->bTrackClicks);
+							if (!(*JsonRotatorObj)->TryGetNumberField(TEXT("numCohortGroups"), Panel->NumGroups))
+							{
+								Panel->NumGroups = INDEX_NONE;
+							}
+							if (!(*JsonRotatorObj)->TryGetNumberField(TEXT("cohortGroupToShowFor"), Panel->GroupToShowFor))
+							{
+								Panel->GroupToShowFor = INDEX_NONE;
+							}
 
-                                Panels.Push(Panel);
-                            }
+                            pJsonDataFactory->LoadData(Panel, JsonRotatorObj);
+
+                            Panels.Push(Panel);
                         }
                     }
                 }
             }
         }
     }
-    else
-    {
-        UE_LOG(RallyHereStart, Warning, TEXT("URHNewsRotatorWidget::GetPanelData failed to get JsonDataFactory -- delegates will not be bound."));
-    }
 
-	CheckShouldShowPanels(Panels, Delegate);
+	CachedPanels = MoveTemp(Panels);
 }
 
 void URHNewsRotatorWidget::CheckShouldShowPanels(TArray<URHNewsRotatorData*> Panels, FOnGetNewsRotatorPanelsBlock Delegate /*= FOnGetNewsRotatorPanelsBlock()*/)
@@ -145,6 +163,13 @@ void URHNewsRotatorWidget::CheckShouldShowPanels(TArray<URHNewsRotatorData*> Pan
 				}
 			}
 
+			CheckedPanels.Reset(PanelsToCheck.Num());
+			for (URHJsonData* Panel : PanelsToCheck)
+			{
+				CheckedPanels.Add(Cast<URHNewsRotatorData>(Panel));
+			}
+			VisiblePanels.Reset();
+
 			pJsonDataFactory->CheckShouldShowForPlayer(PanelsToCheck, LocalPlayerInfo, FOnGetShouldShowPanels::CreateLambda([this, Delegate](FRHShouldShowPanelsWrapper Wrapper)
 				{
 					TArray<URHNewsRotatorData*> DataToShow;
@@ -152,7 +177,13 @@ void URHNewsRotatorWidget::CheckShouldShowPanels(TArray<URHNewsRotatorData*> Pan
 					{
 						if (pair.Value)
 						{
-							DataToShow.Add(Cast<URHNewsRotatorData>(pair.Key));
+							URHNewsRotatorData* Panel = Cast<URHNewsRotatorData>(pair.Key);
+							DataToShow.Add(Panel);
+
+							if (CheckedPanels.Contains(Panel))
+							{
+								VisiblePanels.Add(Panel);
+							}
 						}
 					}
 					Delegate.ExecuteIfBound(DataToShow);
@@ -161,6 +192,79 @@ void URHNewsRotatorWidget::CheckShouldShowPanels(TArray<URHNewsRotatorData*> Pan
 	}
 }
 
+void URHNewsRotatorWidget::OnJsonPanelsInvalidated(const TArray<URHJsonData*>& InvalidatedPanels)
+{
+	TArray<URHJsonData*> PanelsToRecheck;
+	for (URHJsonData* Panel : InvalidatedPanels)
+	{
+		URHNewsRotatorData* RotatorPanel = Cast<URHNewsRotatorData>(Panel);
+		if (RotatorPanel != nullptr && CheckedPanels.Contains(RotatorPanel))
+		{
+			PanelsToRecheck.Add(RotatorPanel);
+		}
+	}
+
+	if (PanelsToRecheck.Num() == 0 || !MyHud.IsValid())
+	{
+		return;
+	}
+
+	URH_PlayerInfo* LocalPlayerInfo = MyHud->GetLocalPlayerInfo();
+	URHJsonDataFactory* pJsonDataFactory = GetJsonDataFactory();
+	if (LocalPlayerInfo == nullptr || pJsonDataFactory == nullptr)
+	{
+		return;
+	}
+
+	pJsonDataFactory->CheckShouldShowForPlayer(PanelsToRecheck, LocalPlayerInfo, FOnGetShouldShowPanels::CreateWeakLambda(this, [this](FRHShouldShowPanelsWrapper Wrapper)
+		{
+			bool bVisibilityChanged = false;
+			for (const auto& pair : Wrapper.ShouldShowByPanel)
+			{
+				URHNewsRotatorData* Panel = Cast<URHNewsRotatorData>(pair.Key);
+
+				// A newer check may have replaced the panels while this one was in flight
+				if (Panel == nullptr || !CheckedPanels.Contains(Panel))
+				{
+					continue;
+				}
+
+				if (pair.Value != VisiblePanels.Contains(Panel))
+				{
+					bVisibilityChanged = true;
+
+					if (pair.Value)
+					{
+						VisiblePanels.Add(Panel);
+					}
+					else
+					{
+						VisiblePanels.Remove(Panel);
+					}
+				}
+			}
+
+			if (bVisibilityChanged)
+			{
+				TArray<URHNewsRotatorData*> DataToShow;
+				for (URHNewsRotatorData* Panel : CheckedPanels)
+				{
+					if (VisiblePanels.Contains(Panel))
+					{
+						DataToShow.Add(Panel);
+					}
+				}
+
+				OnVisiblePanelsChanged(DataToShow);
+			}
+		}));
+}
+
+void URHNewsRotatorWidget::OnVisiblePanelsChanged_Implementation(const TArray<URHNewsRotatorData*>& InVisiblePanels)
+{
+	OnJsonChanged(TEXT("landingpanel"));
+}
+
 void URHNewsRotatorWidget::OnNewsPanelClicked(URHNewsRotatorData* Panel)
 {
 	if (!Panel)
@@ -18,6 +18,7 @@ void URHVoucherOrder::DisplayVoucherRedemptionFailed()
 				FRHPopupConfig VoucherFailedPopup;
 				VoucherFailedPopup.Header = NSLOCTEXT("General", "Error", "Error");
 				VoucherFailedPopup.Description = NSLOCTEXT("RHVoucherOrder", "FailedDesc", "Failed to Redeem Voucher, please restart the game and try again");
+				VoucherFailedPopup.CanBeCoalesced = true;
 				VoucherFailedPopup.CancelAction.AddDynamic(PopupManager, &URHPopupManager::OnPopupCanceled);
 
 				FRHPopupButtonConfig& ConfirmButton = (VoucherFailedPopup.Buttons[VoucherFailedPopup.Buttons.Add(FRHPopupButtonConfig())]);
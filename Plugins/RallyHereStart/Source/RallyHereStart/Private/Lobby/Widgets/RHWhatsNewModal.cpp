@@ -20,6 +20,7 @@ void URHWhatsNewModal::InitializeWidget_Implementation()
     if (URHJsonDataFactory* pJsonDataFactory = GetJsonDataFactory())
     {
         pJsonDataFactory->JsonPanelUpdated.AddDynamic(this, &URHWhatsNewModal::UpdateWhatsNewPanels);
+        pJsonDataFactory->JsonPanelsInvalidated.AddDynamic(this, &URHWhatsNewModal::HandleJsonPanelsInvalidated);
 		// Simulate checking for the proper json
 		UpdateWhatsNewPanels(TEXT("landingpanel"));
 	}
@@ -32,12 +33,13 @@ void URHWhatsNewModal::UninitializeWidget_Implementation()
     if (URHJsonDataFactory* pJsonDataFactory = GetJsonDataFactory())
     {
         pJsonDataFactory->JsonPanelUpdated.RemoveDynamic(this, &URHWhatsNewModal::UpdateWhatsNewPanels);
+        pJsonDataFactory->JsonPanelsInvalidated.RemoveDynamic(this, &URHWhatsNewModal::HandleJsonPanelsInvalidated);
     }
 }
 
 void URHWhatsNewModal::UpdateWhatsNewPanels(const FString& JsonName)
 {
-	if (JsonName != TEXT("landingpanel") && JsonName != TEXT("itemsUpdated"))
+	if (JsonName != TEXT("landingpanel"))
 	{
 		return;
 	}
@@ -171,6 +173,18 @@ void URHWhatsNewModal::UpdateWhatsNewPanels(const FString& JsonName)
 	OnJsonChanged();
 }
 
+void URHWhatsNewModal::HandleJsonPanelsInvalidated(const TArray<URHJsonData*>& InvalidatedPanels)
+{
+	for (URHJsonData* Panel : InvalidatedPanels)
+	{
+		if (StoredPanels.Contains(Cast<URHWhatsNewPanel>(Panel)))
+		{
+			OnJsonChanged();
+			return;
+		}
+	}
+}
+
 void URHWhatsNewModal::GetPanelDataAsync(FOnGetWhatsNewPanelDataBlock Delegate /*= FOnGetWhatsNewPanelDataBlock()*/)
 {
     TArray<URHJsonData*> PanelsToCheck;
@@ -1,9 +1,18 @@
+#include "RallyHereStart.h"
 
 #include "Managers/RHStoreItemHelper.h"
 #include "RHUIBlueprintFunctionLibrary.h"
 #include "GameFramework/RHGameInstance.h"
 #include "RH_GameInstanceSubsystem.h"
 #include "Managers/RHEventManager.h"
+#include "Engine/AssetManager.h"
+#include "TimerManager.h"
+
+namespace
+{
+	// Prefetches run below the default priority so loads requested by open screens are serviced first
+	const TAsyncLoadPriority EventPrefetchLoadPriority = FStreamableManager::DefaultAsyncLoadPriority - 1;
+}
 
 void URHEventManager::Initialize()
 {
@@ -13,6 +22,8 @@ void URHEventManager::Initialize()
 	}
 
 	bEventsInitialized = false;
+	bEventPrefetchComplete = false;
+	NextTransitionIndex = 0;
 
 	if (UWorld* World = GetWorld())
 	{
@@ -21,6 +32,17 @@ void URHEventManager::Initialize()
 			GameInstance->OnLocalPlayerLoginChanged.AddUObject(this, &URHEventManager::OnLoginPlayerChanged);
 		}
 	}
+
+	// Event timeframes come from app settings, so only reparse them when those change
+	if (URH_ConfigSubsystem* ConfigSubsystem = GetConfigSubsystem())
+	{
+		SettingsUpdatedHandle = ConfigSubsystem->OnSettingsUpdated.AddWeakLambda(this, [this](URH_ConfigSubsystem* pUpdatedConfigSubsystem)
+			{
+				RebuildEventSchedule();
+			});
+	}
+
+	RebuildEventSchedule();
 }
 
 void URHEventManager::Uninitialize()
@@ -32,41 +54,303 @@ void URHEventManager::Uninitialize()
 			GameInstance->OnLocalPlayerLoginChanged.RemoveAll(this);
 		}
 	}
+
+	if (URH_ConfigSubsystem* ConfigSubsystem = GetConfigSubsystem())
+	{
+		ConfigSubsystem->OnSettingsUpdated.Remove(SettingsUpdatedHandle);
+	}
+
+	if (UGameInstance* GameInstance = GetTypedOuter<UGameInstance>())
+	{
+		GameInstance->GetTimerManager().ClearTimer(ScheduleTimerHandle);
+	}
+
+	for (TPair<FName, FRHEventPrefetchState>& PrefetchState : EventPrefetchStates)
+	{
+		if (PrefetchState.Value.DataObjectHandle.IsValid())
+		{
+			PrefetchState.Value.DataObjectHandle->CancelHandle();
+		}
+
+		if (PrefetchState.Value.AssetsHandle.IsValid())
+		{
+			PrefetchState.Value.AssetsHandle->CancelHandle();
+		}
+	}
+
+	EventPrefetchStates.Empty();
+	LoginPrefetchEvents.Empty();
+	PendingLootTableIds.Empty();
 }
 
-void URHEventManager::OnLoginPlayerChanged(ULocalPlayer* LocalPlayer)
+void URHEventManager::RebuildEventSchedule()
 {
-	if (!bEventsInitialized)
+	TMap<FName, FRHEventScheduleEntry> PreviousSchedule = MoveTemp(EventSchedule);
+	EventSchedule.Reset();
+	ScheduleTimeline.Reset();
+	NextTransitionIndex = 0;
+
+	const FDateTime CurrentTime = GetCurrentTime();
+
+	if (EventsDataDT != nullptr)
+	{
+		for (FName EventTag : EventsDataDT->GetRowNames())
+		{
+			FRHEventScheduleEntry& ScheduleEntry = EventSchedule.Add(EventTag);
+			ScheduleEntry.StartTime = ReadEventTimeSetting(EventTag, TEXT(".StartTime"));
+			ScheduleEntry.EndTime = ReadEventTimeSetting(EventTag, TEXT(".EndTime"));
+
+			// Carry over the active state so only real changes are broadcast below
+			const FRHEventScheduleEntry* PreviousEntry = PreviousSchedule.Find(EventTag);
+			ScheduleEntry.bActive = PreviousEntry != nullptr && PreviousEntry->bActive;
+
+			if (ScheduleEntry.StartTime > CurrentTime)
+			{
+				ScheduleTimeline.Add({ ScheduleEntry.StartTime, EventTag });
+			}
+
+			if (ScheduleEntry.EndTime > CurrentTime)
+			{
+				ScheduleTimeline.Add({ ScheduleEntry.EndTime, EventTag });
+			}
+		}
+	}
+
+	ScheduleTimeline.Sort([](const FRHEventScheduleTransition& A, const FRHEventScheduleTransition& B) { return A.Time < B.Time; });
+
+	for (TPair<FName, FRHEventScheduleEntry>& ScheduleEntry : EventSchedule)
+	{
+		SetEventActive(ScheduleEntry.Key, ScheduleEntry.Value, ScheduleEntry.Value.IsActiveAt(CurrentTime));
+	}
+
+	ScheduleNextTransition();
+}
+
+void URHEventManager::ProcessScheduleTransitions()
+{
+	const FDateTime CurrentTime = GetCurrentTime();
+
+	while (ScheduleTimeline.IsValidIndex(NextTransitionIndex) && ScheduleTimeline[NextTransitionIndex].Time <= CurrentTime)
+	{
+		const FName EventTag = ScheduleTimeline[NextTransitionIndex++].EventTag;
+
+		if (FRHEventScheduleEntry* ScheduleEntry = EventSchedule.Find(EventTag))
+		{
+			SetEventActive(EventTag, *ScheduleEntry, ScheduleEntry->IsActiveAt(CurrentTime));
+		}
+	}
+
+	ScheduleNextTransition();
+}
+
+void URHEventManager::ScheduleNextTransition()
+{
+	if (UGameInstance* GameInstance = GetTypedOuter<UGameInstance>())
+	{
+		FTimerManager& TimerManager = GameInstance->GetTimerManager();
+		TimerManager.ClearTimer(ScheduleTimerHandle);
+
+		if (ScheduleTimeline.IsValidIndex(NextTransitionIndex))
+		{
+			// If the timer comes in early nothing will have been reached yet, and we will just wait for the remainder
+			const double SecondsToTransition = (ScheduleTimeline[NextTransitionIndex].Time - GetCurrentTime()).GetTotalSeconds();
+			TimerManager.SetTimer(ScheduleTimerHandle, this, &URHEventManager::ProcessScheduleTransitions, FMath::Max((float)SecondsToTransition, 0.001f), false);
+		}
+	}
+}
+
+void URHEventManager::SetEventActive(FName EventTag, FRHEventScheduleEntry& ScheduleEntry, bool bActive)
+{
+	if (ScheduleEntry.bActive != bActive)
 	{
-		TArray<int32> VendorIdsToRequest;
+		ScheduleEntry.bActive = bActive;
 
-		if (EventsDataDT != nullptr)
+		if (bActive)
+		{
+			PrefetchEvent(EventTag);
+			OnEventActivated.Broadcast(EventTag);
+		}
+		else
 		{
-			for (FName EventTag : EventsDataDT->GetRowNames())
+			OnEventDeactivated.Broadcast(EventTag);
+		}
+	}
+}
+
+void URHEventManager::PrefetchEvent(FName EventTag)
+{
+	if (EventsDataDT != nullptr && !EventPrefetchStates.Contains(EventTag))
+	{
+		if (FRHEventData* EventRow = EventsDataDT->FindRow<FRHEventData>(EventTag, "Prefetch Active Event"))
+		{
+			if (!EventRow->DataObject.IsNull())
 			{
-				// Only check active events so we don't try and load everything
-				if (IsEventActive(EventTag))
+				EventPrefetchStates.Add(EventTag).StartTime = FPlatformTime::Seconds();
+
+				TSharedPtr<FStreamableHandle> DataObjectHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(EventRow->DataObject.ToSoftObjectPath(),
+					FStreamableDelegate::CreateUObject(this, &URHEventManager::OnEventDataObjectLoaded, EventTag), EventPrefetchLoadPriority);
+
+				if (FRHEventPrefetchState* PrefetchState = EventPrefetchStates.Find(EventTag))
 				{
-					if (FRHEventData* EventRow = EventsDataDT->FindRow<FRHEventData>(EventTag, "Load Activity to get its required loot table Ids"))
-					{
-						if (URHEvent* Event = EventRow->DataObject.LoadSynchronous())
-						{
-							Event->AppendRequiredLootTableIds(VendorIdsToRequest);
-						}
-					}
+					PrefetchState->DataObjectHandle = DataObjectHandle;
 				}
 			}
 		}
+	}
+}
+
+void URHEventManager::OnEventDataObjectLoaded(FName EventTag)
+{
+	FRHEventPrefetchState* PrefetchState = EventPrefetchStates.Find(EventTag);
+	if (PrefetchState == nullptr || PrefetchState->bDataObjectLoaded)
+	{
+		return;
+	}
+
+	PrefetchState->bDataObjectLoaded = true;
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+
+	URHEvent* Event = PrefetchState->DataObjectHandle.IsValid() ? Cast<URHEvent>(PrefetchState->DataObjectHandle->GetLoadedAsset()) : nullptr;
+	if (Event == nullptr && EventsDataDT != nullptr)
+	{
+		// The handle is not assigned yet if the streamable manager completed the request immediately
+		if (FRHEventData* EventRow = EventsDataDT->FindRow<FRHEventData>(EventTag, "Prefetch Active Event"))
+		{
+			Event = EventRow->DataObject.Get();
+		}
+	}
+
+	if (Event != nullptr)
+	{
+		Event->EventTag = EventTag;
+		Event->AppendRequiredLootTableIds(PendingLootTableIds);
+		Event->AppendPrefetchAssetPaths(AssetsToLoad);
+	}
+	else
+	{
+		UE_LOG(RallyHereStart, Warning, TEXT("URHEventManager::OnEventDataObjectLoaded failed to load the data object for event %s"), *EventTag.ToString());
+	}
+
+	if (AssetsToLoad.Num() > 0)
+	{
+		TSharedPtr<FStreamableHandle> AssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad,
+			FStreamableDelegate::CreateUObject(this, &URHEventManager::OnEventAssetsLoaded, EventTag), EventPrefetchLoadPriority);
+
+		// The streamable manager may have already completed the request if everything was in memory
+		if (FRHEventPrefetchState* AssetsPrefetchState = EventPrefetchStates.Find(EventTag))
+		{
+			AssetsPrefetchState->AssetsHandle = AssetsHandle;
+		}
+	}
+	else
+	{
+		OnEventAssetsLoaded(EventTag);
+	}
+
+	UpdateLoginPrefetch();
+}
+
+void URHEventManager::OnEventAssetsLoaded(FName EventTag)
+{
+	FRHEventPrefetchState* PrefetchState = EventPrefetchStates.Find(EventTag);
+	if (PrefetchState == nullptr || PrefetchState->IsComplete())
+	{
+		return;
+	}
+
+	PrefetchState->LoadSeconds = (float)(FPlatformTime::Seconds() - PrefetchState->StartTime);
+	UE_LOG(RallyHereStart, Verbose, TEXT("URHEventManager prefetched event %s in %.3f seconds"), *EventTag.ToString(), PrefetchState->LoadSeconds);
+
+	UpdateLoginPrefetch();
+}
+
+void URHEventManager::UpdateLoginPrefetch()
+{
+	// Vendor data can only be requested for a logged in player, anything collected before then waits for login
+	if (!bEventsInitialized)
+	{
+		return;
+	}
+
+	if (bEventPrefetchComplete)
+	{
+		// Events that activate after login request their vendors as soon as they have their data
+		RequestPendingVendorData();
+		return;
+	}
+
+	bool bAllDataObjectsLoaded = true;
+	bool bAllPrefetchesComplete = true;
+
+	for (FName EventTag : LoginPrefetchEvents)
+	{
+		if (const FRHEventPrefetchState* PrefetchState = EventPrefetchStates.Find(EventTag))
+		{
+			bAllDataObjectsLoaded &= PrefetchState->bDataObjectLoaded;
+			bAllPrefetchesComplete &= PrefetchState->IsComplete();
+		}
+	}
+
+	// Batch the vendor request for every login event, rather than one request per event
+	if (bAllDataObjectsLoaded)
+	{
+		RequestPendingVendorData();
+	}
+
+	if (bAllPrefetchesComplete)
+	{
+		bEventPrefetchComplete = true;
+		LoginPrefetchEvents.Empty();
+		OnEventPrefetchComplete.Broadcast();
+	}
+}
+
+void URHEventManager::RequestPendingVendorData()
+{
+	if (PendingLootTableIds.Num() > 0)
+	{
+		if (URHStoreItemHelper* StoreItemHelper = URHUIBlueprintFunctionLibrary::GetStoreItemHelper(this))
+		{
+			StoreItemHelper->RequestVendorData(PendingLootTableIds);
+		}
+
+		PendingLootTableIds.Reset();
+	}
+}
+
+float URHEventManager::GetEventPrefetchSeconds(FName EventTag) const
+{
+	if (const FRHEventPrefetchState* PrefetchState = EventPrefetchStates.Find(EventTag))
+	{
+		return PrefetchState->LoadSeconds;
+	}
+
+	return -1.f;
+}
+
+void URHEventManager::OnLoginPlayerChanged(ULocalPlayer* LocalPlayer)
+{
+	if (!bEventsInitialized)
+	{
+		bEventsInitialized = true;
 
-		if (VendorIdsToRequest.Num() > 0)
+		// Events that activated before login have already started prefetching, and just need to be waited on
+		const FDateTime CurrentTime = GetCurrentTime();
+		for (const TPair<FName, FRHEventScheduleEntry>& ScheduleEntry : EventSchedule)
 		{
-			if (URHStoreItemHelper* StoreItemHelper = URHUIBlueprintFunctionLibrary::GetStoreItemHelper(this))
+			if (ScheduleEntry.Value.IsActiveAt(CurrentTime))
 			{
-				StoreItemHelper->RequestVendorData(VendorIdsToRequest);
+				PrefetchEvent(ScheduleEntry.Key);
+
+				if (EventPrefetchStates.Contains(ScheduleEntry.Key))
+				{
+					LoginPrefetchEvents.Add(ScheduleEntry.Key);
+				}
 			}
 		}
 
-		bEventsInitialized = true;
+		UpdateLoginPrefetch();
 	}
 }
 
@@ -91,12 +375,14 @@ URHEvent* URHEventManager::GetEventByTag(FName EventTag) const
 
 bool URHEventManager::IsEventActive(FName EventTag) const
 {
-	if (IsEventPastStartDate(EventTag) && IsEventBeforeEndDate(EventTag))
+	if (const FRHEventScheduleEntry* ScheduleEntry = EventSchedule.Find(EventTag))
 	{
-		return true;
+		// Compare against the clock rather than bActive, the transition timer runs in game time and can fire late
+		return ScheduleEntry->IsActiveAt(GetCurrentTime());
 	}
 
-	return false;
+	// Events outside of the data table aren't scheduled, check them directly
+	return IsEventPastStartDate(EventTag) && IsEventBeforeEndDate(EventTag);
 }
 
 bool URHEventManager::IsEventPastStartDate(FName EventTag) const
@@ -138,42 +424,54 @@ FDateTime URHEventManager::GetCurrentTime() const
 
 FDateTime URHEventManager::GetEventStartTime(FName EventTag) const
 {
-	FDateTime TimeStart;
-	FString TimeStartStr;
-	if (URH_ConfigSubsystem* ConfigSubsystem = GetConfigSubsystem())
+	if (const FRHEventScheduleEntry* ScheduleEntry = EventSchedule.Find(EventTag))
 	{
-		FString ConfigEntryNameStartTime = EventTag.ToString() + ".StartTime";
-		ConfigSubsystem->GetAppSetting(ConfigEntryNameStartTime, TimeStartStr);
-		RallyHereAPI::ParseDateTime(*TimeStartStr, TimeStart);
+		return ScheduleEntry->StartTime;
 	}
-	
-	return TimeStart;
+
+	return ReadEventTimeSetting(EventTag, TEXT(".StartTime"));
 }
 
 FDateTime URHEventManager::GetEventEndTime(FName EventTag) const
 {
-	FDateTime TimeEnd;
-	FString TimeEndStr;
+	if (const FRHEventScheduleEntry* ScheduleEntry = EventSchedule.Find(EventTag))
+	{
+		return ScheduleEntry->EndTime;
+	}
+
+	return ReadEventTimeSetting(EventTag, TEXT(".EndTime"));
+}
+
+FDateTime URHEventManager::ReadEventTimeSetting(FName EventTag, const TCHAR* SettingSuffix) const
+{
+	FDateTime Time;
+	FString TimeStr;
 	if (URH_ConfigSubsystem* ConfigSubsystem = GetConfigSubsystem())
 	{
-		FString ConfigEntryNameEndTime = EventTag.ToString() + ".EndTime";
-		ConfigSubsystem->GetAppSetting(ConfigEntryNameEndTime, TimeEndStr);
-		RallyHereAPI::ParseDateTime(*TimeEndStr, TimeEnd);
+		ConfigSubsystem->GetAppSetting(EventTag.ToString() + SettingSuffix, TimeStr);
+		RallyHereAPI::ParseDateTime(*TimeStr, Time);
 	}
-	
-	return TimeEnd;
+
+	return Time;
 }
 
 URH_ConfigSubsystem* URHEventManager::GetConfigSubsystem() const
 {
-	if (UWorld* World = GetWorld())
+	// The manager is created during game instance init, before there is a world to go through
+	UGameInstance* GameInstance = GetTypedOuter<UGameInstance>();
+	if (GameInstance == nullptr)
 	{
-		if (UGameInstance* GameInstance = World->GetGameInstance())
+		if (UWorld* World = GetWorld())
 		{
-			if (URH_GameInstanceSubsystem* pGISS = GameInstance->GetSubsystem<URH_GameInstanceSubsystem>())
-			{
-				return pGISS->GetConfigSubsystem();
-			}
+			GameInstance = World->GetGameInstance();
+		}
+	}
+
+	if (GameInstance != nullptr)
+	{
+		if (URH_GameInstanceSubsystem* pGISS = GameInstance->GetSubsystem<URH_GameInstanceSubsystem>())
+		{
+			return pGISS->GetConfigSubsystem();
 		}
 	}
 
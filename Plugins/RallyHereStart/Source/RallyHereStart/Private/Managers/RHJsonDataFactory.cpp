@@ -40,6 +40,84 @@ static void RHJsonFactory_WriteRawToTexture_RenderThread(FTexture2DDynamicResour
     RHIUnlockTexture2D(TextureRHI, 0, false, false);
 }
 
+namespace
+{
+	// The platform a build runs on never changes, so only the login platform needs resolving at runtime
+	ERHJsonPanelPlatform GetBuildPlatforms()
+	{
+		static const ERHJsonPanelPlatform BuildPlatforms = []()
+		{
+			const FString PlatformName = UGameplayStatics::GetPlatformName();
+			if (PlatformName == TEXT("PS4")) return ERHJsonPanelPlatform::PS4;
+			if (PlatformName == TEXT("PS5")) return ERHJsonPanelPlatform::PS5;
+			if (PlatformName == TEXT("XboxOne")) return ERHJsonPanelPlatform::XB1;
+			if (PlatformName == TEXT("XSX")) return ERHJsonPanelPlatform::XSX;
+			if (PlatformName == TEXT("Switch")) return ERHJsonPanelPlatform::Switch;
+			if (PlatformName == TEXT("IOS")) return ERHJsonPanelPlatform::IOS;
+			if (PlatformName == TEXT("Android")) return ERHJsonPanelPlatform::Android;
+#if !UE_BUILD_SHIPPING // for oss=anon in dev
+			if (PlatformName == TEXT("Windows") || PlatformName == TEXT("Mac") || PlatformName == TEXT("Linux")) return ERHJsonPanelPlatform::DesktopAnon;
+#endif
+			return ERHJsonPanelPlatform::None;
+		}();
+
+		return BuildPlatforms;
+	}
+
+	void AddUniqueItemIds(TArray<int32>& OutItemIds, const TArray<int32>& ItemIds)
+	{
+		for (const int32 ItemId : ItemIds)
+		{
+			OutItemIds.AddUnique(ItemId);
+		}
+	}
+}
+
+bool FRHJsonDataPredicate::IsInTimeWindow(const FDateTime& Now) const
+{
+	const int64 NowTicks = Now.GetTicks();
+	return (StartTicks <= 0 || NowTicks >= StartTicks) && (EndTicks <= 0 || NowTicks <= EndTicks);
+}
+
+bool FRHJsonDataPredicate::EvaluateInventory(const TMap<FRH_ItemId, int32>& InventoryCounts, const FRH_ItemId& PlayerXpItemId) const
+{
+	// if somehow player level data is wrong, we should show the thing rather than not
+	const int32* Level = InventoryCounts.Find(PlayerXpItemId);
+	if (Level != nullptr && *Level > 0)
+	{
+		if ((MinLevel != INDEX_NONE && *Level < MinLevel) || (MaxLevel != INDEX_NONE && *Level > MaxLevel))
+		{
+			return false;
+		}
+	}
+
+	for (const int32 ItemId : HideIfOwnedIds)
+	{
+		const int32* Count = InventoryCounts.Find(FRH_ItemId(ItemId));
+		if (Count != nullptr && *Count > 0)
+		{
+			return false;
+		}
+	}
+
+	for (const int32 ItemId : RequiredOwnedIds)
+	{
+		// The player xp item is always fetched along with the panel's items, and only feeds the level rule
+		if (FRH_ItemId(ItemId) == PlayerXpItemId)
+		{
+			continue;
+		}
+
+		const int32* Count = InventoryCounts.Find(FRH_ItemId(ItemId));
+		if (Count == nullptr || *Count <= 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 URHStoreItemHelper* GetStoreHelper(const UObject* WorldContextObject)
 {
 	if (WorldContextObject != nullptr)
@@ -66,7 +144,7 @@ void URHJsonDataFactory::Initialize(ARHHUDCommon* InHud)
 
 		if (!PlayerXpProgression.IsValid())
 		{
-			UAssetManager::GetStreamableManager().RequestAsyncLoad(PlayerXpProgression.ToSoftObjectPath());
+			UAssetManager::GetStreamableManager().RequestAsyncLoad(PlayerXpProgression.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &URHJsonDataFactory::OnPlayerXpProgressionLoaded));
 		}
 	}
 
@@ -74,7 +152,13 @@ void URHJsonDataFactory::Initialize(ARHHUDCommon* InHud)
 	{
 		TryLoadLandingPanels();
 	}
-	else if (GameInstance.IsValid())
+	else
+	{
+		bLoadLandingPanelsOnLogin = true;
+	}
+
+	// Always listen for login changes, the local platforms depend on what the players are logged in with
+	if (GameInstance.IsValid())
 	{
 		GameInstance->OnLocalPlayerLoginChanged.AddUObject(this, &URHJsonDataFactory::OnLocalPlayerLoginChanged);
 	}
@@ -82,6 +166,13 @@ void URHJsonDataFactory::Initialize(ARHHUDCommon* InHud)
 
 void URHJsonDataFactory::Uninitialize()
 {
+	if (GameInstance.IsValid())
+	{
+		GameInstance->OnLocalPlayerLoginChanged.RemoveAll(this);
+	}
+
+	PendingInventoryCountHelpers.Empty();
+
     Super::Uninitialize();
 }
 
@@ -109,6 +200,7 @@ void URHJsonDataFactory::HandleJsonReady(URHLandingPanelJSONHandler* pHandler)
     if (pHandler)
     {
         JsonPanels.Add(pHandler->GetName(), pHandler->GetJsonObject());
+		++JsonPanelRevisions.FindOrAdd(pHandler->GetName());
 
     	pHandler->OnJsonReady.RemoveDynamic(this, &URHJsonDataFactory::HandleJsonReady);
     	JsonPanelUpdated.Broadcast(pHandler->GetName());
@@ -121,6 +213,7 @@ void URHJsonDataFactory::HandleImagesReady(URHLandingPanelJSONHandler* pHandler)
     {
 		MapFilePathToTexture.Append(pHandler->GetFilePathToTextureMap());
 		MapRemoteUrlToFilePath.Append(pHandler->GetRemoteUrlToFilePathMap());
+		++JsonPanelRevisions.FindOrAdd(pHandler->GetName());
 
     	pHandler->OnImagesDownloaded.RemoveDynamic(this, &URHJsonDataFactory::HandleImagesReady);
     	JsonPanelUpdated.Broadcast(pHandler->GetName());
@@ -137,6 +230,12 @@ TSharedPtr<FJsonObject> URHJsonDataFactory::GetJsonPanelByName(const FString& na
     return nullptr;
 }
 
+int32 URHJsonDataFactory::GetJsonPanelRevision(const FString& name) const
+{
+	const int32* Revision = JsonPanelRevisions.Find(name);
+	return Revision != nullptr ? *Revision : INDEX_NONE;
+}
+
 FString URHJsonDataFactory::GetLocalizedStringFromObject(const TSharedPtr<FJsonObject>* StringObject)
 {
     FString OutString = "";
@@ -325,270 +424,348 @@ void URHJsonDataFactory::LoadData(URHJsonData* JsonData, const TSharedPtr<FJsonO
 	(*JsonObject)->TryGetBoolField(TEXT("showNX"), JsonData->showNX);
 	(*JsonObject)->TryGetBoolField(TEXT("showIOS"), JsonData->showIOS);
 	(*JsonObject)->TryGetBoolField(TEXT("showAndroid"), JsonData->showAndroid);
+
+	// Compile the eligibility rules once, so checking the panel never has to look at the fields above again
+	FRHJsonDataPredicate& Predicate = JsonData->Predicate;
+	Predicate = FRHJsonDataPredicate();
+	Predicate.StartTicks = JsonData->StartTime.GetTicks();
+	Predicate.EndTicks = JsonData->EndTime.GetTicks();
+	Predicate.MinLevel = JsonData->MinLevel;
+	Predicate.MaxLevel = JsonData->MaxLevel;
+
+	const TPair<bool, ERHJsonPanelPlatform> PlatformFlags[] =
+	{
+		{ JsonData->showSteam, ERHJsonPanelPlatform::Steam },
+		{ JsonData->showEpic, ERHJsonPanelPlatform::Epic },
+		{ JsonData->showSteam || JsonData->showEpic, ERHJsonPanelPlatform::DesktopAnon },
+		{ JsonData->showPS4, ERHJsonPanelPlatform::PS4 },
+		{ JsonData->showPS5, ERHJsonPanelPlatform::PS5 },
+		{ JsonData->showXB1, ERHJsonPanelPlatform::XB1 },
+		{ JsonData->showXSX, ERHJsonPanelPlatform::XSX },
+		{ JsonData->showNX, ERHJsonPanelPlatform::Switch },
+		{ JsonData->showIOS, ERHJsonPanelPlatform::IOS },
+		{ JsonData->showAndroid, ERHJsonPanelPlatform::Android },
+	};
+
+	for (const TPair<bool, ERHJsonPanelPlatform>& PlatformFlag : PlatformFlags)
+	{
+		if (PlatformFlag.Key)
+		{
+			Predicate.AllowedPlatforms |= PlatformFlag.Value;
+		}
+	}
+
+	// Every item the panel checks has to be owned, and on top of that a HideIfItemOwned item being owned hides it
+	AddUniqueItemIds(Predicate.HideIfOwnedIds, JsonData->HideIfItemOwned);
+	AddUniqueItemIds(Predicate.RequiredOwnedIds, JsonData->HideIfItemOwned);
+	if (JsonData->HideIfOwned && JsonData->AssociatedLootId > 0)
+	{
+		Predicate.RequiredOwnedIds.AddUnique(JsonData->AssociatedLootId);
+	}
+	AddUniqueItemIds(Predicate.RequiredOwnedIds, JsonData->ShowIfItemOwned);
 }
 
 void URHJsonDataFactory::OnInventoryItemsUpdated(const TArray<int32>& UpdatedInventoryIds, URH_PlayerInfo* PlayerInfo)
 {
     UE_LOG(RallyHereStart, Log, TEXT("URHJsonDataFactory::OnInventoryItemsUpdated"));
 
-	TSet<int32> RelevantItemIds;
-	if (const auto& FoundJsonDataWrapper = CachedJsonDataByPlayer.Find(PlayerInfo))
+	FRHJsonDataWrapper* PlayerCache = CachedJsonDataByPlayer.Find(PlayerInfo);
+	if (PlayerCache == nullptr)
 	{
-		for (const URHJsonData* JsonData : FoundJsonDataWrapper->JsonDataSet)
-		{
-			if (JsonData->HideIfOwned && JsonData->AssociatedLootId > 0)
-			{
-				RelevantItemIds.Add(JsonData->AssociatedLootId);
-			}
+		return;
+	}
 
-			for (const int32& ItemId : JsonData->HideIfItemOwned)
-			{
-				RelevantItemIds.Add(ItemId);
-			}
+	const int32 PlayerXpItemId = PlayerXpProgression.IsValid() ? int32(PlayerXpProgression->GetItemId()) : INDEX_NONE;
 
-			for (const int32& ItemId : JsonData->ShowIfItemOwned)
-			{
-				RelevantItemIds.Add(ItemId);
-			}
+	TSet<URHJsonData*> InvalidatedPanels;
+	for (const int32& UpdatedId : UpdatedInventoryIds)
+	{
+		if (const TArray<URHJsonData*>* DependentPanels = PlayerCache->PanelsByItemId.Find(UpdatedId))
+		{
+			InvalidatedPanels.Append(*DependentPanels);
+			PlayerCache->InventoryCountsById.Remove(FRH_ItemId(UpdatedId));
+		}
 
-			if (PlayerXpProgression.IsValid())
-			{
-				RelevantItemIds.Add(PlayerXpProgression->GetItemId());
-			}
+		if (UpdatedId == PlayerXpItemId && PlayerXpItemId != INDEX_NONE)
+		{
+			InvalidatedPanels.Append(PlayerCache->LevelGatedPanels);
+			PlayerCache->InventoryCountsById.Remove(FRH_ItemId(UpdatedId));
 		}
 	}
 
-	for (const int32& UpdatedId : UpdatedInventoryIds)
+	if (InvalidatedPanels.Num() == 0)
 	{
-		if (RelevantItemIds.Contains(UpdatedId))
-		{
-			JsonPanelUpdated.Broadcast(TEXT("itemsUpdated"));
-			break;
-		}
-	}	
+		return;
+	}
+
+	for (URHJsonData* Panel : InvalidatedPanels)
+	{
+		PlayerCache->InventoryResultByPanel.Remove(Panel);
+	}
+
+	JsonPanelsInvalidated.Broadcast(InvalidatedPanels.Array());
 }
 
 void URHJsonDataFactory::CheckShouldShowForPlayer(URHJsonData* JsonData, URH_PlayerInfo* PlayerInfo, FOnShouldShow Delegate, bool bCheckPlatform)
 {
 	// null check
-	if (JsonData == nullptr)
+	if (JsonData == nullptr || PlayerInfo == nullptr)
 	{
-		Delegate.Execute(false);
+		Delegate.ExecuteIfBound(false);
 		return;
 	}
+
+	TArray<URHJsonData*> Panels;
+	Panels.Add(JsonData);
+
+	CheckShouldShowForPlayer(Panels, PlayerInfo, FOnGetShouldShowPanels::CreateLambda([JsonData, Delegate](FRHShouldShowPanelsWrapper Wrapper)
+		{
+			const bool* bShouldShow = Wrapper.ShouldShowByPanel.Find(JsonData);
+			Delegate.ExecuteIfBound(bShouldShow != nullptr && *bShouldShow);
+		}), bCheckPlatform);
+}
+
+void URHJsonDataFactory::CheckShouldShowForPlayer(TArray<URHJsonData*> pData, URH_PlayerInfo* PlayerInfo, FOnGetShouldShowPanels Delegate, bool bCheckPlatform /*= true*/)
+{
+	FRHShouldShowPanelsWrapper Results;
+
 	if (PlayerInfo == nullptr)
 	{
-		Delegate.Execute(false);
+		for (URHJsonData* Panel : pData)
+		{
+			Results.ShouldShowByPanel.Add(Panel, false);
+		}
+
+		Delegate.ExecuteIfBound(Results);
 		return;
 	}
 
-	// Make sure Player is registered for Inventory Item Updated callbacks
-	if (URH_PlayerInventory* PlayerInventory = PlayerInfo->GetPlayerInventory())
+	FRHJsonDataWrapper* PlayerCache = RegisterPanelsForPlayer(pData, PlayerInfo);
+
+	const ERHJsonPanelPlatform LocalPlatforms = bCheckPlatform ? GetLocalPlatforms() : ERHJsonPanelPlatform::None;
+	const FDateTime NowTime = FDateTime::UtcNow();
+	const FRH_ItemId PlayerXpItemId = GetPlayerXpItemId();
+
+	// Resolve everything that doesn't need the inventory, and collect the counts the rest are missing
+	TArray<URHJsonData*> PendingPanels;
+	TArray<int32> MissingItemIds;
+
+	for (URHJsonData* Panel : pData)
 	{
-		if (!CachedJsonDataByPlayer.Contains(PlayerInfo))
+		if (Panel == nullptr || !Panel->Predicate.IsInTimeWindow(NowTime) || !Panel->Predicate.IsAllowedOnPlatforms(LocalPlatforms))
 		{
-			PlayerInventory->OnInventoryCacheUpdated.BindUObject(this, &URHJsonDataFactory::OnInventoryItemsUpdated);
+			Results.ShouldShowByPanel.Add(Panel, false);
+			continue;
 		}
 
-		CachedJsonDataByPlayer.FindOrAdd(PlayerInfo).JsonDataSet.Add(JsonData);
-	}
-
-	// Check for time window
-	FDateTime NowTime = FDateTime::UtcNow();
-	
-	if (JsonData->StartTime.GetTicks() > 0)
-	{
-		if (NowTime < JsonData->StartTime)
+		if (!Panel->Predicate.HasInventoryRequirements())
 		{
-			Delegate.Execute(false);
-			return;
+			Results.ShouldShowByPanel.Add(Panel, true);
+			continue;
 		}
-	}
-	if (JsonData->EndTime.GetTicks() > 0)
-	{
-		if (NowTime > JsonData->EndTime)
+
+		if (PlayerCache != nullptr)
 		{
-			Delegate.Execute(false);
-			return;
+			if (const bool* MemoizedResult = PlayerCache->InventoryResultByPanel.Find(Panel))
+			{
+				Results.ShouldShowByPanel.Add(Panel, *MemoizedResult);
+				continue;
+			}
 		}
-	}
 
-	// Check for platform
-	if (bCheckPlatform)
-	{
-		bool isSteam = false;
-		bool isEpic = false;
+		PendingPanels.Add(Panel);
 
-		if (GameInstance.IsValid())
+		if (PlayerCache != nullptr)
 		{
-			for (const auto& LocalPlayer : GameInstance->GetLocalPlayers())
+			for (const int32 ItemId : Panel->Predicate.HideIfOwnedIds)
 			{
-				if (URH_LocalPlayerSubsystem* LPSS = LocalPlayer->GetSubsystem<URH_LocalPlayerSubsystem>())
+				if (!PlayerCache->InventoryCountsById.Contains(FRH_ItemId(ItemId)))
 				{
-					isSteam |= LPSS->GetPlayerPlatformId().PlatformType == ERHAPI_Platform::Steam;
-					isEpic |= LPSS->GetPlayerPlatformId().PlatformType == ERHAPI_Platform::Epic;
+					MissingItemIds.AddUnique(ItemId);
+				}
+			}
+			for (const int32 ItemId : Panel->Predicate.RequiredOwnedIds)
+			{
+				if (!PlayerCache->InventoryCountsById.Contains(FRH_ItemId(ItemId)))
+				{
+					MissingItemIds.AddUnique(ItemId);
 				}
 			}
 		}
+	}
 
-		const FString PlatformName = UGameplayStatics::GetPlatformName();
-		const bool isPc = PlatformName == TEXT("Windows") || PlatformName == TEXT("Mac") || PlatformName == TEXT("Linux");
-		const bool isPS4 = PlatformName == TEXT("PS4");
-		const bool isPS5 = PlatformName == TEXT("PS5");
-		const bool isXB1 = PlatformName == TEXT("XboxOne");
-		const bool isXSX = PlatformName == TEXT("XSX");
-		const bool isSwitch = PlatformName == TEXT("Switch");
-		const bool isIOS = PlatformName == TEXT("IOS");
-		const bool isAndroid = PlatformName == TEXT("Android");
-
-		if (isSteam && !JsonData->showSteam)
-		{
-			Delegate.Execute(false);
-			return;
-		}
-		else if (isEpic && !JsonData->showEpic)
-		{
-			Delegate.Execute(false);
-			return;
-		}
-#if !UE_BUILD_SHIPPING // for oss=anon in dev
-		else if (isPc && !JsonData->showSteam && !JsonData->showEpic)
-		{
-			Delegate.Execute(false);
-			return;
-		}
-#endif
-		else if (isPS4 && !JsonData->showPS4)
+	if (PlayerCache != nullptr && PendingPanels.Num() > 0 && PlayerXpProgression.IsValid() && !PlayerCache->InventoryCountsById.Contains(PlayerXpItemId))
+	{
+		MissingItemIds.AddUnique(PlayerXpProgression->GetItemId());
+	}
+
+	// Everything is already known, answer right away
+	if (PendingPanels.Num() == 0 || MissingItemIds.Num() == 0)
+	{
+		EvaluatePendingPanels(PendingPanels, PlayerCache != nullptr ? PlayerCache->InventoryCountsById : TMap<FRH_ItemId, int32>(), PlayerCache, Results);
+		Delegate.ExecuteIfBound(Results);
+		return;
+	}
+
+	// Fetch every missing count the pending panels need in one batch, then evaluate them all synchronously
+	URH_PlayerInventoryCountHelper* Helper = NewObject<URH_PlayerInventoryCountHelper>();
+	Helper->PlayerInfo = PlayerInfo;
+
+	for (const int32 ItemId : MissingItemIds)
+	{
+		Helper->ItemIdsToCheck.Add(ItemId);
+	}
+
+	Helper->Event = FOnGetInventoryCounts::CreateWeakLambda(this, [this, PlayerInfo, PendingPanels, Results, Delegate, Helper](FRHInventoryCountWrapper CountWrapper)
 		{
-			Delegate.Execute(false);
-			return;
-		}
-		else if (isPS5 && !JsonData->showPS5)
+			PendingInventoryCountHelpers.Remove(Helper);
+
+			FRHShouldShowPanelsWrapper FinalResults = Results;
+
+			// The cache may have been cleared while the counts were in flight, so look it up again
+			FRHJsonDataWrapper* PlayerCache = CachedJsonDataByPlayer.Find(PlayerInfo);
+			if (PlayerCache != nullptr)
+			{
+				PlayerCache->InventoryCountsById.Append(CountWrapper.InventoryCountsById);
+				EvaluatePendingPanels(PendingPanels, PlayerCache->InventoryCountsById, PlayerCache, FinalResults);
+			}
+			else
+			{
+				EvaluatePendingPanels(PendingPanels, CountWrapper.InventoryCountsById, nullptr, FinalResults);
+			}
+
+			Delegate.ExecuteIfBound(FinalResults);
+		});
+
+	PendingInventoryCountHelpers.Add(Helper);
+	Helper->StartCheck();
+}
+
+FRHJsonDataWrapper* URHJsonDataFactory::RegisterPanelsForPlayer(const TArray<URHJsonData*>& Panels, URH_PlayerInfo* PlayerInfo)
+{
+	// Make sure Player is registered for Inventory Item Updated callbacks
+	URH_PlayerInventory* PlayerInventory = PlayerInfo->GetPlayerInventory();
+	if (PlayerInventory == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (!CachedJsonDataByPlayer.Contains(PlayerInfo))
+	{
+		PlayerInventory->OnInventoryCacheUpdated.BindUObject(this, &URHJsonDataFactory::OnInventoryItemsUpdated);
+	}
+
+	FRHJsonDataWrapper& PlayerCache = CachedJsonDataByPlayer.FindOrAdd(PlayerInfo);
+	for (URHJsonData* Panel : Panels)
+	{
+		if (Panel == nullptr)
 		{
-			Delegate.Execute(false);
-			return;
+			continue;
 		}
-		else if (isXB1 && !JsonData->showXB1)
+
+		bool bAlreadyRegistered = false;
+		PlayerCache.JsonDataSet.Add(Panel, &bAlreadyRegistered);
+
+		if (bAlreadyRegistered)
 		{
-			Delegate.Execute(false);
-			return;
+			continue;
 		}
-		else if (isXSX && !JsonData->showXSX)
+
+		// Index the panel under every item its rules read, so an inventory update only invalidates the panels that depend on it
+		const FRHJsonDataPredicate& Predicate = Panel->Predicate;
+		for (const int32 ItemId : Predicate.HideIfOwnedIds)
 		{
-			Delegate.Execute(false);
-			return;
+			PlayerCache.PanelsByItemId.FindOrAdd(ItemId).AddUnique(Panel);
 		}
-		else if (isSwitch && !JsonData->showNX)
+		for (const int32 ItemId : Predicate.RequiredOwnedIds)
 		{
-			Delegate.Execute(false);
-			return;
+			PlayerCache.PanelsByItemId.FindOrAdd(ItemId).AddUnique(Panel);
 		}
-		else if (isIOS && !JsonData->showIOS)
+
+		if (Predicate.MinLevel != INDEX_NONE || Predicate.MaxLevel != INDEX_NONE)
 		{
-			Delegate.Execute(false);
-			return;
+			PlayerCache.LevelGatedPanels.Add(Panel);
 		}
-		else if (isAndroid && !JsonData->showAndroid)
+	}
+
+	return &PlayerCache;
+}
+
+void URHJsonDataFactory::EvaluatePendingPanels(const TArray<URHJsonData*>& PendingPanels, const TMap<FRH_ItemId, int32>& InventoryCounts, FRHJsonDataWrapper* PlayerCache, FRHShouldShowPanelsWrapper& Results) const
+{
+	const FRH_ItemId PlayerXpItemId = GetPlayerXpItemId();
+
+	for (URHJsonData* Panel : PendingPanels)
+	{
+		const bool bShouldShow = Panel->Predicate.EvaluateInventory(InventoryCounts, PlayerXpItemId);
+		Results.ShouldShowByPanel.Add(Panel, bShouldShow);
+
+		if (PlayerCache != nullptr)
 		{
-			Delegate.Execute(false);
-			return;
+			PlayerCache->InventoryResultByPanel.Add(Panel, bShouldShow);
 		}
 	}
+}
 
-	// Check for required Inventory Counts
-	URH_PlayerInventoryCountHelper* Helper = NewObject<URH_PlayerInventoryCountHelper>();
-	Helper->PlayerInfo = PlayerInfo;
-	
-	if (JsonData->HideIfOwned && JsonData->AssociatedLootId > 0)
+FRH_ItemId URHJsonDataFactory::GetPlayerXpItemId() const
+{
+	return PlayerXpProgression.IsValid() ? FRH_ItemId(PlayerXpProgression->GetItemId()) : FRH_ItemId();
+}
+
+void URHJsonDataFactory::OnPlayerXpProgressionLoaded()
+{
+	if (!PlayerXpProgression.IsValid())
 	{
-		Helper->ItemIdsToCheck.Add(JsonData->AssociatedLootId);
+		return;
 	}
 
-	for (const int32& itemId : JsonData->HideIfItemOwned)
+	TSet<URHJsonData*> InvalidatedPanels;
+	for (TPair<URH_PlayerInfo*, FRHJsonDataWrapper>& PlayerCachePair : CachedJsonDataByPlayer)
 	{
-		Helper->ItemIdsToCheck.Add(itemId);
+		for (URHJsonData* Panel : PlayerCachePair.Value.LevelGatedPanels)
+		{
+			if (PlayerCachePair.Value.InventoryResultByPanel.Remove(Panel) > 0)
+			{
+				InvalidatedPanels.Add(Panel);
+			}
+		}
 	}
 
-	for (const int32& itemId : JsonData->ShowIfItemOwned)
+	if (InvalidatedPanels.Num() > 0)
 	{
-		Helper->ItemIdsToCheck.Add(itemId);
+		JsonPanelsInvalidated.Broadcast(InvalidatedPanels.Array());
 	}
+}
 
-	FRH_ItemId PlayerXpProgressionItemId;
-	if (PlayerXpProgression.IsValid())
+ERHJsonPanelPlatform URHJsonDataFactory::GetLocalPlatforms() const
+{
+	if (bLocalPlatformsDirty)
 	{
-		PlayerXpProgressionItemId = PlayerXpProgression->GetItemId();
-		Helper->ItemIdsToCheck.Add(PlayerXpProgressionItemId);
-	}
+		CachedLocalPlatforms = GetBuildPlatforms();
 
-	Helper->Event = FOnGetInventoryCounts::CreateLambda([this, JsonData, Helper, PlayerXpProgressionItemId, Delegate](FRHInventoryCountWrapper CountWrapper)
+		if (GameInstance.IsValid())
 		{
-			int32 Count = 0;
-			if (Helper->Results.InventoryCountsById.Contains(PlayerXpProgressionItemId))
-			{
-				Count = Helper->Results.InventoryCountsById[PlayerXpProgressionItemId];
-			}
-
-			// if somehow player level data is wrong, we should show the thing rather than not
-			if (Count > 0)
+			for (const auto& LocalPlayer : GameInstance->GetLocalPlayers())
 			{
-				if (JsonData->MinLevel != INDEX_NONE)
+				if (URH_LocalPlayerSubsystem* LPSS = LocalPlayer->GetSubsystem<URH_LocalPlayerSubsystem>())
 				{
-					if (Count < JsonData->MinLevel)
+					const ERHAPI_Platform PlatformType = LPSS->GetPlayerPlatformId().PlatformType;
+					if (PlatformType == ERHAPI_Platform::Steam)
 					{
-						Delegate.Execute(false);
-						return;
+						CachedLocalPlatforms |= ERHJsonPanelPlatform::Steam;
 					}
-				}
-
-				if (JsonData->MaxLevel != INDEX_NONE)
-				{
-					if (Count > JsonData->MaxLevel)
+					else if (PlatformType == ERHAPI_Platform::Epic)
 					{
-						Delegate.Execute(false);
-						return;
+						CachedLocalPlatforms |= ERHJsonPanelPlatform::Epic;
 					}
 				}
 			}
+		}
 
-			TSet<int32> HideIfOwnedSet(JsonData->HideIfItemOwned);
-			for (const auto& pair : Helper->Results.InventoryCountsById)
-			{
-				// check hideifowned mask set
-				if (HideIfOwnedSet.Contains(pair.Key) && pair.Value > 0)
-				{
-					Delegate.Execute(false);
-					return;
-				}
-
-				// Ignore the PlayerXp Id, since it's always passed into the inventory check
-				if (pair.Key == PlayerXpProgressionItemId)
-				{
-					continue;
-				}
-
-				// all other existing results should be checking for ownership
-				if (pair.Value <= 0)
-				{
-					Delegate.Execute(false);
-					return;
-				}
-			}
+		bLocalPlatformsDirty = false;
+	}
 
-			Delegate.Execute(true);
-		});
-	
-	Helper->StartCheck();
-}
-
-void URHJsonDataFactory::CheckShouldShowForPlayer(TArray<URHJsonData*> pData, URH_PlayerInfo* PlayerInfo, FOnGetShouldShowPanels Delegate, bool bCheckPlatform /*= true*/)
-{
-	URH_PlayerShouldShowPanelsHelper* Helper = NewObject<URH_PlayerShouldShowPanelsHelper>();
-	Helper->PlayerInfo = PlayerInfo;
-	Helper->JsonDataFactory = this;
-	Helper->Event = Delegate;
-	Helper->PanelsToCheck = pData;
-	Helper->StartCheck();
+	return CachedLocalPlatforms;
 }
 
 void URHJsonDataFactory::TryLoadLandingPanels()
@@ -638,52 +815,37 @@ void URHJsonDataFactory::TryLoadLandingPanels()
 
 void URHJsonDataFactory::OnLocalPlayerLoginChanged(ULocalPlayer* LocalPlayer)
 {
-	if (URH_LocalPlayerSubsystem* LPSS = LocalPlayer->GetSubsystem<URH_LocalPlayerSubsystem>())
+	bLocalPlatformsDirty = true;
+
+	if (!bLoadLandingPanelsOnLogin || LocalPlayer == nullptr)
 	{
-		if (LPSS->IsLoggedIn())
-		{
-			TryLoadLandingPanels();
-		}
+		return;
 	}
-}
 
-void URH_PlayerShouldShowPanelsHelper::StartCheck()
-{
-	if (PanelsToCheck.Num() > 0)
+	if (URH_LocalPlayerSubsystem* LPSS = LocalPlayer->GetSubsystem<URH_LocalPlayerSubsystem>())
 	{
-		for (URHJsonData* Panel : PanelsToCheck)
+		if (LPSS->IsLoggedIn())
 		{
-			JsonDataFactory->CheckShouldShowForPlayer(Panel, PlayerInfo, FOnShouldShow::CreateUObject(this, &URH_PlayerShouldShowPanelsHelper::OnGetShouldShowResponse, Panel));
+			TryLoadLandingPanels();
 		}
 	}
-	else
-	{
-		Event.Execute(Results);
-		bComplete = true;
-	}
 }
 
-void URH_PlayerShouldShowPanelsHelper::OnGetShouldShowResponse(bool bShouldShow, URHJsonData* JsonData)
+void URH_PlayerInventoryCountHelper::StartCheck()
 {
-	Responses++;
-
-	Results.ShouldShowByPanel.Add(JsonData, bShouldShow);
+	URH_PlayerInventory* PlayerInventory = PlayerInfo != nullptr ? PlayerInfo->GetPlayerInventory() : nullptr;
 
-	if (Responses == PanelsToCheck.Num())
+	// Nothing to wait on, report the (empty) results right away so callers are never left hanging
+	if (PlayerInventory == nullptr || ItemIdsToCheck.Num() == 0)
 	{
-		Event.Execute(Results);
 		bComplete = true;
+		Event.ExecuteIfBound(Results);
+		return;
 	}
-}
 
-void URH_PlayerInventoryCountHelper::StartCheck()
-{
-	if (URH_PlayerInventory* PlayerInventory = PlayerInfo->GetPlayerInventory())
+	for (const auto& ItemId : ItemIdsToCheck)
 	{
-		for (const auto& ItemId : ItemIdsToCheck)
-		{
-			PlayerInventory->GetInventoryCount(ItemId, FRH_GetInventoryCountDelegate::CreateUObject(this, &URH_PlayerInventoryCountHelper::OnGetCountResponse, ItemId));
-		}
+		PlayerInventory->GetInventoryCount(ItemId, FRH_GetInventoryCountDelegate::CreateUObject(this, &URH_PlayerInventoryCountHelper::OnGetCountResponse, ItemId));
 	}
 }
 
@@ -6,10 +6,13 @@
 #include "PlatformInventoryItem/PlatformInventoryItem.h"
 #include "Managers/RHStoreItemHelper.h"
 #include "Managers/RHLootBoxManager.h"
+#include "PlatformInventoryItem/PInv_AssetManager.h"
+#include "Async/Async.h"
 
 void URHLootBoxManager::Initialize(URHGameInstance* InGameInstance, class URHStoreItemHelper* InStoreItemHelper)
 {
 	HasRequestedVendors = false;
+	ContentsIndexGeneration = 0;
 	GameInstance = InGameInstance;
 
 	if (GameInstance)
@@ -46,6 +49,83 @@ void URHLootBoxManager::OnLoginPlayerChanged(ULocalPlayer* LocalPlayer)
 	}
 }
 
+// Catalog and asset data captured on the game thread for building a FRHLootBoxContentsIndex on a worker
+struct FRHLootBoxContentsIndexSource
+{
+	// Loot boxes on sale, with the loot table ids of the drop tables they exchange for
+	TArray<TPair<FRH_LootId, TArray<int32>>> LootBoxLootTableIds;
+	TMap<int32, FRHAPI_Vendor> LootTableVendors;
+
+	// Asset ids of the drop table loot only, resolved on the game thread
+	TMap<FRH_ItemId, FPrimaryAssetId> ItemIdToAssetId;
+	TMap<FRH_LootId, FPrimaryAssetId> LootIdToAssetId;
+	// Items in each collection we split contents by, in the order they are checked
+	TArray<TPair<ELootBoxContentsCategories, TSet<FPrimaryAssetId>>> CategoryAssetIds;
+};
+
+static ELootBoxContentsCategories GetContentsCategory(const FRHLootBoxContentsIndexSource& Source, const FRHAPI_Loot& LootItem)
+{
+	// Match the store item's inventory item lookup, by item id and then by loot id
+	const FPrimaryAssetId* AssetId = nullptr;
+	if (LootItem.GetItemId(0) != 0)
+	{
+		AssetId = Source.ItemIdToAssetId.Find(LootItem.GetItemId(0));
+	}
+	else if (LootItem.GetLootId() != 0)
+	{
+		AssetId = Source.LootIdToAssetId.Find(LootItem.GetLootId());
+	}
+
+	if (AssetId != nullptr)
+	{
+		for (const TPair<ELootBoxContentsCategories, TSet<FPrimaryAssetId>>& Category : Source.CategoryAssetIds)
+		{
+			if (Category.Value.Contains(*AssetId))
+			{
+				return Category.Key;
+			}
+		}
+	}
+
+	return ELootBoxContentsCategories::LootBoxContents_Other;
+}
+
+static TSharedPtr<const FRHLootBoxContentsIndex> BuildLootBoxContentsIndex(const FRHLootBoxContentsIndexSource& Source)
+{
+	TSharedPtr<FRHLootBoxContentsIndex> NewIndex = MakeShared<FRHLootBoxContentsIndex>();
+
+	for (const TPair<FRH_LootId, TArray<int32>>& LootBox : Source.LootBoxLootTableIds)
+	{
+		TArray<FRHLootBoxContentsIndex::FLootTable>& LootTables = NewIndex->LootTablesByLootBox.Add(LootBox.Key);
+
+		for (const int32 LootTableId : LootBox.Value)
+		{
+			FRHLootBoxContentsIndex::FLootTable& LootTable = LootTables.AddDefaulted_GetRef();
+			LootTable.LootTableId = LootTableId;
+
+			const FRHAPI_Vendor* LootTableVendor = Source.LootTableVendors.Find(LootTableId);
+			if (LootTableVendor == nullptr)
+			{
+				continue;
+			}
+
+			if (const auto& LootItems = LootTableVendor->GetLootOrNull())
+			{
+				for (const auto& pItemPair : (*LootItems))
+				{
+					if (pItemPair.Value.GetActive(false))
+					{
+						LootTable.LootIds.Add(pItemPair.Value.GetLootId());
+						LootTable.Categories.Add(GetContentsCategory(Source, pItemPair.Value));
+					}
+				}
+			}
+		}
+	}
+
+	return NewIndex;
+}
+
 void URHLootBoxManager::OnStoreVendorsLoaded(bool bSuccess)
 {
 	if (StoreItemHelper)
@@ -54,128 +134,170 @@ void URHLootBoxManager::OnStoreVendorsLoaded(bool bSuccess)
 		LootBoxLootIds.Empty();
 		LootBoxLootIds.Append(StoreItemHelper->GetLootIdsForVendor(LootBoxsRedemptionVendorId, false, true));
 
-		// Fill out a contents table of unopened loot boxes for quick grabbing if multiple screens may need this info
+		// Any details handed out so far belong to the previous vendor data
 		UnopenedLootBoxIdToContents.Empty();
+		ContentsIndex.Reset();
+		++ContentsIndexGeneration;
 
+		URH_CatalogSubsystem* CatalogSubsystem = nullptr;
 		if (GameInstance != nullptr)
 		{
 			if (auto pGISubsystem = GameInstance->GetSubsystem<URH_GameInstanceSubsystem>())
 			{
-				if (URH_CatalogSubsystem* CatalogSubsystem = pGISubsystem->GetCatalogSubsystem())
+				CatalogSubsystem = pGISubsystem->GetCatalogSubsystem();
+			}
+		}
+
+		UPInv_AssetManager* pManager = Cast<UPInv_AssetManager>(UAssetManager::GetIfValid());
+
+		if (CatalogSubsystem == nullptr || pManager == nullptr)
+		{
+			return;
+		}
+
+		// Only capture the catalog data here, categorizing the contents of every drop table happens on a worker
+		TSharedRef<FRHLootBoxContentsIndexSource> Source = MakeShared<FRHLootBoxContentsIndexSource>();
+
+		FRHAPI_Vendor LootBoxVendor;
+		FRHAPI_Vendor RedemptionVendor;
+		if (CatalogSubsystem->GetVendorById(LootBoxsVendorId, LootBoxVendor) && CatalogSubsystem->GetVendorById(LootBoxsRedemptionVendorId, RedemptionVendor))
+		{
+			if (const auto& LootBoxItems = LootBoxVendor.GetLootOrNull())
+			{
+				for (const auto& LootBoxPair : (*LootBoxItems))
 				{
-					TArray<URHStoreItem*> LootBoxs = StoreItemHelper->GetStoreItemsForVendor(LootBoxsVendorId, false, false);
+					const FRHAPI_Loot& LootBoxLoot = LootBoxPair.Value;
+					if (!LootBoxLoot.GetActive(false))
+					{
+						continue;
+					}
 
-					FRHAPI_Vendor RedemptionVendor;
-					if (CatalogSubsystem->GetVendorById(LootBoxsRedemptionVendorId, RedemptionVendor))
+					const TSoftObjectPtr<URHLootBox> LootBoxAsset = LootBoxLoot.GetItemId(0) != 0 ? pManager->GetSoftPrimaryAssetByItemId<URHLootBox>(LootBoxLoot.GetItemId(0)) : pManager->GetSoftPrimaryAssetByLootId<URHLootBox>(LootBoxLoot.GetLootId());
+					const URHLootBox* LootBoxItem = LootBoxAsset.Get();
+					if (LootBoxItem == nullptr)
 					{
-						for (URHStoreItem* LootBox : LootBoxs)
+						continue;
+					}
+
+					FRHAPI_Loot LootBoxTableItem;
+					if (!URH_CatalogBlueprintLibrary::GetVendorItemById(RedemptionVendor, LootBoxItem->LootBoxVendorId, LootBoxTableItem))
+					{
+						continue;
+					}
+
+					const auto* SubVendorId = LootBoxTableItem.GetSubVendorIdOrNull();
+					FRHAPI_Vendor SubVendor;
+					if (SubVendorId == nullptr || !CatalogSubsystem->GetVendorById(*SubVendorId, SubVendor))
+					{
+						continue;
+					}
+
+					TArray<int32> LootTableIds;
+					if (const auto& LootItems = SubVendor.GetLootOrNull())
+					{
+						for (const auto& pItemPair : (*LootItems))
 						{
-							if (URHLootBox* LootBoxItem = Cast<URHLootBox>(LootBox->GetInventoryItem().Get()))
+							const auto* ContentsVendorId = pItemPair.Value.GetSubVendorIdOrNull();
+							if (ContentsVendorId == nullptr || !pItemPair.Value.GetActive(false))
+							{
+								continue;
+							}
+
+							LootTableIds.Add(*ContentsVendorId);
+
+							if (!Source->LootTableVendors.Contains(*ContentsVendorId))
 							{
-								if (URHLootBoxDetails* DropDetails = NewObject<URHLootBoxDetails>())
+								FRHAPI_Vendor& LootTableVendor = Source->LootTableVendors.Add(*ContentsVendorId);
+								if (!CatalogSubsystem->GetVendorById(*ContentsVendorId, LootTableVendor))
 								{
-									DropDetails->LootBox = LootBox;
-									FRHAPI_Loot LootBoxTableItem;
-									if (URH_CatalogBlueprintLibrary::GetVendorItemById(RedemptionVendor, LootBoxItem->LootBoxVendorId, LootBoxTableItem))
-									{
-										const auto* SubVendorId = LootBoxTableItem.GetSubVendorIdOrNull();
-
-										if (SubVendorId == nullptr)
-										{
-											continue;
-										}
-
-										FRHAPI_Vendor SubVendor;
-										if (CatalogSubsystem->GetVendorById(*SubVendorId, SubVendor))
-										{
-											if (const auto& LootItems = SubVendor.GetLootOrNull())
-											{
-												for (const auto& pItemPair : (*LootItems))
-												{
-													FRHAPI_Loot SubVendorItem = pItemPair.Value;
-
-													const auto* ContentsVendorId = SubVendorItem.GetSubVendorIdOrNull();
-													const auto* IsActive = SubVendorItem.GetActiveOrNull();
-
-													if (ContentsVendorId == nullptr || IsActive == nullptr || !*IsActive)
-													{
-														continue;
-													}
-
-													if (URHLootBoxContents* Contents = NewObject<URHLootBoxContents>())
-													{
-														Contents->LootTableId = *ContentsVendorId;
-														Contents->BundleContents.Append(StoreItemHelper->GetStoreItemsForVendor(Contents->LootTableId, false, false));
-
-														for (TSoftObjectPtr<URHStoreItem> ContentItem : Contents->BundleContents)
-														{
-															ELootBoxContentsCategories TargetCategory = GetSubCategoryForItem(ContentItem.Get());
-
-															TArray<TSoftObjectPtr<URHStoreItem>>* pContentsArray = Contents->ContentsBySubcategory.Find(TargetCategory);
-															if (pContentsArray)
-															{
-																pContentsArray->Add(ContentItem);
-															}
-															else
-															{
-																TArray<TSoftObjectPtr<URHStoreItem>> NewContentCategory;
-																NewContentCategory.Add(ContentItem);
-																Contents->ContentsBySubcategory.Add(TargetCategory, NewContentCategory);
-															}
-														}
-
-														DropDetails->Contents.Add(Contents);
-													}
-												}
-											}
-
-											UnopenedLootBoxIdToContents.Add(LootBox->GetLootId(), DropDetails);
-										}
-									}
+									Source->LootTableVendors.Remove(*ContentsVendorId);
 								}
 							}
 						}
 					}
+
+					Source->LootBoxLootTableIds.Emplace(LootBoxLoot.GetLootId(), MoveTemp(LootTableIds));
 				}
 			}
 		}
-	}
-}
 
-ELootBoxContentsCategories URHLootBoxManager::GetSubCategoryForItem(URHStoreItem* StoreItem) const
-{
-	static const FGameplayTag AvatarCollectionTag = FGameplayTag::RequestGameplayTag(CollectionNames::AvatarCollectionName);
-	static const FGameplayTag BannerCollectionTag = FGameplayTag::RequestGameplayTag(CollectionNames::BannerCollectionName);
-	static const FGameplayTag BorderCollectionTag = FGameplayTag::RequestGameplayTag(CollectionNames::BorderCollectionName);
-	static const FGameplayTag TitleCollectionTag = FGameplayTag::RequestGameplayTag(CollectionNames::TitleCollectionName);
+		const int32 Generation = ContentsIndexGeneration;
 
-	if (StoreItem && StoreItem->GetInventoryItem().IsValid())
-	{
-		if (UPlatformInventoryItem* Item = StoreItem->GetInventoryItem().Get())
+		if (Source->LootBoxLootTableIds.Num() == 0)
 		{
-			if (Item->GetCollectionContainer().HasTag(AvatarCollectionTag))
-			{
-				return ELootBoxContentsCategories::LootBoxContents_Avatars;
-			}
+			SetContentsIndex(MakeShared<const FRHLootBoxContentsIndex>(), Generation);
+			return;
+		}
 
-			if (Item->GetCollectionContainer().HasTag(BannerCollectionTag))
-			{
-				return ELootBoxContentsCategories::LootBoxContents_Banners;
-			}
+		// Resolve asset ids for just the drop table contents rather than copying the asset manager's full id maps
+		const TMap<FRH_ItemId, FPrimaryAssetId>& ItemIdMap = pManager->GetItemIdMap();
+		const TMap<FRH_LootId, FPrimaryAssetId>& LootIdMap = pManager->GetLootIdMap();
 
-			if (Item->GetCollectionContainer().HasTag(TitleCollectionTag))
+		for (const TPair<int32, FRHAPI_Vendor>& LootTableVendor : Source->LootTableVendors)
+		{
+			if (const auto& LootItems = LootTableVendor.Value.GetLootOrNull())
 			{
-				return ELootBoxContentsCategories::LootBoxContents_Titles;
+				for (const auto& pItemPair : (*LootItems))
+				{
+					const FRHAPI_Loot& LootItem = pItemPair.Value;
+					if (LootItem.GetItemId(0) != 0)
+					{
+						if (const FPrimaryAssetId* AssetId = ItemIdMap.Find(LootItem.GetItemId(0)))
+						{
+							Source->ItemIdToAssetId.Add(LootItem.GetItemId(0), *AssetId);
+						}
+					}
+					else if (LootItem.GetLootId() != 0)
+					{
+						if (const FPrimaryAssetId* AssetId = LootIdMap.Find(LootItem.GetLootId()))
+						{
+							Source->LootIdToAssetId.Add(LootItem.GetLootId(), *AssetId);
+						}
+					}
+				}
 			}
+		}
 
-			if (Item->GetCollectionContainer().HasTag(BorderCollectionTag))
-			{
-				return ELootBoxContentsCategories::LootBoxContents_Borders;
-			}
+		const TPair<ELootBoxContentsCategories, FName> CategoryCollections[] =
+		{
+			{ ELootBoxContentsCategories::LootBoxContents_Avatars, CollectionNames::AvatarCollectionName },
+			{ ELootBoxContentsCategories::LootBoxContents_Banners, CollectionNames::BannerCollectionName },
+			{ ELootBoxContentsCategories::LootBoxContents_Titles, CollectionNames::TitleCollectionName },
+			{ ELootBoxContentsCategories::LootBoxContents_Borders, CollectionNames::BorderCollectionName },
+		};
+
+		for (const TPair<ELootBoxContentsCategories, FName>& CategoryCollection : CategoryCollections)
+		{
+			TArray<FPrimaryAssetId> CollectionAssetIds;
+			pManager->GetPrimaryAssetIdListByCollectionQuery(FGameplayTagQuery::MakeQuery_MatchTag(FGameplayTag::RequestGameplayTag(CategoryCollection.Value)), CollectionAssetIds);
+			Source->CategoryAssetIds.Emplace(CategoryCollection.Key, TSet<FPrimaryAssetId>(CollectionAssetIds));
 		}
+
+		TWeakObjectPtr<URHLootBoxManager> WeakThis(this);
+
+		Async(EAsyncExecution::TaskGraph, [Source, Generation, WeakThis]()
+			{
+				TSharedPtr<const FRHLootBoxContentsIndex> NewContentsIndex = BuildLootBoxContentsIndex(*Source);
+
+				AsyncTask(ENamedThreads::GameThread, [NewContentsIndex, Generation, WeakThis]()
+					{
+						if (URHLootBoxManager* LootBoxManager = WeakThis.Get())
+						{
+							LootBoxManager->SetContentsIndex(NewContentsIndex, Generation);
+						}
+					});
+			});
 	}
+}
 
-	return ELootBoxContentsCategories::LootBoxContents_Other;
+void URHLootBoxManager::SetContentsIndex(const TSharedPtr<const FRHLootBoxContentsIndex>& NewContentsIndex, int32 Generation)
+{
+	if (Generation == ContentsIndexGeneration)
+	{
+		ContentsIndex = NewContentsIndex;
+		UnopenedLootBoxIdToContents.Empty();
+		OnLootBoxContentsReady.Broadcast();
+	}
 }
 
 FText URHLootBoxManager::GetContentCategoryName(ELootBoxContentsCategories Category)
@@ -201,12 +323,46 @@ FText URHLootBoxManager::GetContentCategoryName(ELootBoxContentsCategories Categ
 
 URHLootBoxDetails* URHLootBoxManager::GetLootBoxDetails(URHStoreItem* LootBox)
 {
-	if (LootBox)
+	if (LootBox == nullptr || StoreItemHelper == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (URHLootBoxDetails* DropDetails = UnopenedLootBoxIdToContents.FindRef(LootBox->GetLootId()))
 	{
-		return *UnopenedLootBoxIdToContents.Find(LootBox->GetLootId());
+		return DropDetails;
+	}
+
+	const TArray<FRHLootBoxContentsIndex::FLootTable>* LootTables = ContentsIndex.IsValid() ? ContentsIndex->LootTablesByLootBox.Find(LootBox->GetLootId()) : nullptr;
+	if (LootTables == nullptr)
+	{
+		return nullptr;
+	}
+
+	URHLootBoxDetails* DropDetails = NewObject<URHLootBoxDetails>();
+	DropDetails->LootBox = LootBox;
+
+	for (const FRHLootBoxContentsIndex::FLootTable& LootTable : *LootTables)
+	{
+		if (URHLootBoxContents* Contents = NewObject<URHLootBoxContents>())
+		{
+			Contents->LootTableId = LootTable.LootTableId;
+
+			for (int32 i = 0; i < LootTable.LootIds.Num(); ++i)
+			{
+				if (URHStoreItem* ContentItem = StoreItemHelper->GetStoreItem(LootTable.LootIds[i]))
+				{
+					Contents->BundleContents.Add(ContentItem);
+					Contents->ContentsBySubcategory.FindOrAdd(LootTable.Categories[i]).Add(ContentItem);
+				}
+			}
+
+			DropDetails->Contents.Add(Contents);
+		}
 	}
 
-	return nullptr;
+	UnopenedLootBoxIdToContents.Add(LootBox->GetLootId(), DropDetails);
+	return DropDetails;
 }
 
 void URHLootBoxManager::CallOnLootBoxOpenStarted()
@@ -1,27 +1,70 @@
 #include "RallyHereStart.h"
 #include "Managers/RHPopupManager.h"
 
+namespace
+{
+    // Puts the highest priority, most recently queued popup at the top of the heap
+    struct FRHPopupQueuePredicate
+    {
+        bool operator()(const FRHPopupConfig& A, const FRHPopupConfig& B) const
+        {
+            return A.Priority != B.Priority ? A.Priority > B.Priority : A.QueueOrder > B.QueueOrder;
+        }
+    };
+}
+
 URHPopupManager::URHPopupManager(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
     m_nPopupId = 0;
+    m_nQueueOrder = 0;
     bUsesPopupQueue = false;
     bNewPopupsShowOverCurrent = true;
+    MaxQueuedPopups = 16;
 }
 
 int32 URHPopupManager::AddPopup(const FRHPopupConfig &popupData)
 {
+    const uint32 ContentHash = GetPopupContentHash(popupData);
+
+    // Collapse repeats of a popup that is already up or waiting, rather than stacking another copy
+    if (popupData.CanBeCoalesced)
+    {
+        if (CurrentPopup.IsValid() && CurrentPopup.CanBeCoalesced && CurrentPopup.ContentHash == ContentHash && HasSamePopupContent(CurrentPopup, popupData))
+        {
+            ++CurrentPopup.RepeatCount;
+            OnPopupRepeated(CurrentPopup.PopupId, CurrentPopup.RepeatCount);
+            return CurrentPopup.PopupId;
+        }
+
+        if (const int32* QueuedPopupId = QueuedPopupIdsByHash.Find(ContentHash))
+        {
+            const int32 MatchingPopupId = *QueuedPopupId;
+            const FRHPopupConfig* QueuedPopup = PopupQueue.FindByPredicate([MatchingPopupId](const FRHPopupConfig& Popup) { return Popup.PopupId == MatchingPopupId; });
+            if (QueuedPopup != nullptr && HasSamePopupContent(*QueuedPopup, popupData))
+            {
+                ++QueuedPopupStates[MatchingPopupId].RepeatCount;
+                return MatchingPopupId;
+            }
+        }
+    }
+
     if (bUsesPopupQueue)
     {
         // Return the current popup to the queue, to open the new one over the top
         if (bNewPopupsShowOverCurrent && CurrentPopup.IsValid() && CurrentPopup.CanBeShownOver)
         {
-            PopupQueue.Add(CurrentPopup);
+            EnqueuePopup(CurrentPopup);
             CurrentPopup.PopupId = INDEX_NONE;
         }
 
-        PopupQueue.Push(popupData);
-        PopupQueue[PopupQueue.Num() - 1].PopupId = ++m_nPopupId;
+        FRHPopupConfig NewPopup = popupData;
+        NewPopup.PopupId = ++m_nPopupId;
+        NewPopup.ContentHash = ContentHash;
+        NewPopup.RepeatCount = 1;
+        EnqueuePopup(NewPopup);
+
+        TrimPopupQueue();
         NextPopup();
     }
     else
@@ -31,6 +74,8 @@ int32 URHPopupManager::AddPopup(const FRHPopupConfig &popupData)
         {
             CurrentPopup = popupData;
             CurrentPopup.PopupId = ++m_nPopupId;
+            CurrentPopup.ContentHash = ContentHash;
+            CurrentPopup.RepeatCount = 1;
 
             SetUsesBlocker(CurrentPopup.TreatAsBlocker);
             ShowPopup(CurrentPopup);
@@ -45,22 +90,110 @@ int32 URHPopupManager::AddPopup(const FRHPopupConfig &popupData)
     return m_nPopupId;
 }
 
-void URHPopupManager::RemovePopup(int32 popupId)
+uint32 URHPopupManager::GetPopupContentHash(const FRHPopupConfig& popupData)
 {
-    if (CurrentPopup.PopupId == popupId)
+    uint32 Hash = HashCombine(GetTypeHash(popupData.Header.ToString()), GetTypeHash(popupData.Description.ToString()));
+    for (const FRHPopupButtonConfig& Button : popupData.Buttons)
     {
-        OnPopupCanceled();
+        Hash = HashCombine(Hash, HashCombine(GetTypeHash(Button.Label.ToString()), GetTypeHash((uint8)Button.Type)));
     }
-    else
+    return Hash;
+}
+
+bool URHPopupManager::HasSamePopupContent(const FRHPopupConfig& A, const FRHPopupConfig& B)
+{
+    if (!A.Header.ToString().Equals(B.Header.ToString(), ESearchCase::CaseSensitive) ||
+        !A.Description.ToString().Equals(B.Description.ToString(), ESearchCase::CaseSensitive) ||
+        A.Buttons.Num() != B.Buttons.Num())
+    {
+        return false;
+    }
+
+    for (int32 i = 0; i < A.Buttons.Num(); i++)
+    {
+        if (A.Buttons[i].Type != B.Buttons[i].Type || !A.Buttons[i].Label.ToString().Equals(B.Buttons[i].Label.ToString(), ESearchCase::CaseSensitive))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void URHPopupManager::EnqueuePopup(const FRHPopupConfig& popupData)
+{
+    FRHPopupConfig QueuedPopup = popupData;
+    QueuedPopup.QueueOrder = ++m_nQueueOrder;
+    PopupQueue.HeapPush(QueuedPopup, FRHPopupQueuePredicate());
+
+    QueuedPopupStates.Add(QueuedPopup.PopupId, { QueuedPopup.ContentHash, QueuedPopup.RepeatCount });
+    if (QueuedPopup.CanBeCoalesced)
+    {
+        QueuedPopupIdsByHash.Add(QueuedPopup.ContentHash, QueuedPopup.PopupId);
+    }
+}
+
+void URHPopupManager::TrimPopupQueue()
+{
+    while (MaxQueuedPopups > 0 && QueuedPopupStates.Num() > MaxQueuedPopups)
     {
+        // Find the lowest ranked popup that is still queued and allowed to be dropped
+        int32 DropIndex = INDEX_NONE;
         for (int32 i = 0; i < PopupQueue.Num(); i++)
         {
-            if (PopupQueue[i].PopupId == popupId)
+            const FRHPopupConfig& QueuedPopup = PopupQueue[i];
+            if (!QueuedPopup.IsImportant && QueuedPopupStates.Contains(QueuedPopup.PopupId) &&
+                (DropIndex == INDEX_NONE || FRHPopupQueuePredicate()(PopupQueue[DropIndex], QueuedPopup)))
             {
-                PopupQueue.RemoveAt(i);
-                break;
+                DropIndex = i;
             }
         }
+
+        if (DropIndex == INDEX_NONE)
+        {
+            break;
+        }
+
+        UE_LOG(RallyHereStart, Log, TEXT("URHPopupManager::TrimPopupQueue dropping popup %d, queue is over its limit of %d"), PopupQueue[DropIndex].PopupId, MaxQueuedPopups);
+        ForgetQueuedPopup(PopupQueue[DropIndex].PopupId, PopupQueue[DropIndex].ContentHash);
+        PopupQueue.HeapRemoveAt(DropIndex, FRHPopupQueuePredicate());
+    }
+}
+
+void URHPopupManager::CompactPopupQueue()
+{
+    // Clear out popups that were removed while queued once they make up most of the heap
+    if (PopupQueue.Num() > QueuedPopupStates.Num() * 2 + 8)
+    {
+        PopupQueue.RemoveAll([this](const FRHPopupConfig& QueuedPopup) { return !QueuedPopupStates.Contains(QueuedPopup.PopupId); });
+        PopupQueue.Heapify(FRHPopupQueuePredicate());
+    }
+}
+
+void URHPopupManager::ForgetQueuedPopup(int32 popupId, uint32 contentHash)
+{
+    QueuedPopupStates.Remove(popupId);
+
+    if (const int32* QueuedPopupId = QueuedPopupIdsByHash.Find(contentHash))
+    {
+        if (*QueuedPopupId == popupId)
+        {
+            QueuedPopupIdsByHash.Remove(contentHash);
+        }
+    }
+}
+
+void URHPopupManager::RemovePopup(int32 popupId)
+{
+    if (CurrentPopup.PopupId == popupId)
+    {
+        OnPopupCanceled();
+    }
+    else if (const FRHQueuedPopupState* QueuedState = QueuedPopupStates.Find(popupId))
+    {
+        // The entry is skipped when it reaches the top of the queue
+        ForgetQueuedPopup(popupId, QueuedState->ContentHash);
+        CompactPopupQueue();
     }
 }
 
@@ -68,18 +201,46 @@ void URHPopupManager::NextPopup()
 {
     if (bUsesPopupQueue)
     {
-        if (!CurrentPopup.IsValid() && PopupQueue.Num() > 0)
+        while (!CurrentPopup.IsValid() && PopupQueue.Num() > 0)
         {
-		    CurrentPopup = PopupQueue[PopupQueue.Num() - 1];
+            FRHPopupConfig NextPopupData;
+            PopupQueue.HeapPop(NextPopupData, FRHPopupQueuePredicate());
+
+            const FRHQueuedPopupState* QueuedState = QueuedPopupStates.Find(NextPopupData.PopupId);
+            if (QueuedState == nullptr)
+            {
+                // Removed while it was queued
+                continue;
+            }
+
+            NextPopupData.RepeatCount = QueuedState->RepeatCount;
+            ForgetQueuedPopup(NextPopupData.PopupId, NextPopupData.ContentHash);
+
+		    CurrentPopup = MoveTemp(NextPopupData);
 		    SetUsesBlocker(CurrentPopup.TreatAsBlocker);
 		    ShowPopup(CurrentPopup);
 		    OnShowPopup.Broadcast();
-
-            PopupQueue.RemoveAt(PopupQueue.Num() - 1);
 	    }
     }
 }
 
+TArray<FRHPopupConfig> URHPopupManager::GetQueuedPopups() const
+{
+    TArray<FRHPopupConfig> QueuedPopups;
+    QueuedPopups.Reserve(QueuedPopupStates.Num());
+    for (const FRHPopupConfig& QueuedPopup : PopupQueue)
+    {
+        if (const FRHQueuedPopupState* QueuedState = QueuedPopupStates.Find(QueuedPopup.PopupId))
+        {
+            FRHPopupConfig& LivePopup = QueuedPopups.Add_GetRef(QueuedPopup);
+            LivePopup.RepeatCount = QueuedState->RepeatCount;
+        }
+    }
+
+    QueuedPopups.Sort(FRHPopupQueuePredicate());
+    return QueuedPopups;
+}
+
 void URHPopupManager::CloseAllPopups()
 {
     if (CurrentPopup.IsValid())
@@ -90,6 +251,8 @@ void URHPopupManager::CloseAllPopups()
     }
 
 	PopupQueue.Empty();
+	QueuedPopupStates.Empty();
+	QueuedPopupIdsByHash.Empty();
 	SetUsesBlocker(false);
 }
 
@@ -130,10 +293,11 @@ void URHPopupManager::CloseUnimportantPopups()
     {
         if (!PopupQueue[i].IsImportant)
         {
-            PopupQueue.RemoveAt(i);
-            i--;
+            ForgetQueuedPopup(PopupQueue[i].PopupId, PopupQueue[i].ContentHash);
         }
     }
+    PopupQueue.RemoveAll([this](const FRHPopupConfig& QueuedPopup) { return !QueuedPopupStates.Contains(QueuedPopup.PopupId); });
+    PopupQueue.Heapify(FRHPopupQueuePredicate());
 
     if (CurrentPopup.IsValid() && !CurrentPopup.IsImportant)
     {
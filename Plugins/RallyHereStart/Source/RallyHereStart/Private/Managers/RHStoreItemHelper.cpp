@@ -83,6 +83,8 @@ void URHStoreItemHelper::Uninitialize()
 
 void URHStoreItemHelper::OnLoginPlayerChanged(ULocalPlayer* LocalPlayer)
 {
+	InvalidateVendorClosures();
+
 	if (URH_CatalogSubsystem* CatalogSubsystem = GetRH_CatalogSubsystem())
 	{
 		// Don't re-request if we have the data
@@ -267,6 +269,14 @@ TArray<URHStoreItem*> URHStoreItemHelper::GetStoreItemsAndQuantitiesForVendor(in
 
 TArray<FRH_LootId> URHStoreItemHelper::GetLootIdsForVendor(int32 nVendorId, bool bIncludeInactiveItems, bool bSearchSubContainers)
 {
+	if (!bIncludeInactiveItems && bSearchSubContainers)
+	{
+		if (const FRHVendorClosure* Closure = GetVendorClosure(nVendorId))
+		{
+			return Closure->LootIds.Array();
+		}
+	}
+
 	TArray<FRH_LootId> StoreItemsOut;
 
 	if (URH_CatalogSubsystem* CatalogSubsystem = GetRH_CatalogSubsystem())
@@ -302,13 +312,256 @@ TArray<FRH_LootId> URHStoreItemHelper::GetLootIdsForVendor(int32 nVendorId, bool
 	return StoreItemsOut;
 }
 
+namespace
+{
+	// Active loot of a vendor, reduced to what the vendor closure needs
+	struct FVendorClosureLoot
+	{
+		FRH_LootId LootId;
+		FRH_ItemId ItemId;
+		int32 SubVendorId = 0;
+		bool bGrantsItem = false;
+	};
+
+	bool GetVendorClosureLoot(FRHVendorClosureLookup GetVendor, int32 VendorId, TArray<FVendorClosureLoot>& OutLoot)
+	{
+		FRHAPI_Vendor Vendor;
+		if (!GetVendor(VendorId, Vendor))
+		{
+			return false;
+		}
+
+		if (const auto& LootItems = Vendor.GetLootOrNull())
+		{
+			OutLoot.Reserve(LootItems->Num());
+			for (const auto& pItemPair : (*LootItems))
+			{
+				if (pItemPair.Value.GetActive(false))
+				{
+					FVendorClosureLoot& Loot = OutLoot.AddDefaulted_GetRef();
+					Loot.LootId = pItemPair.Value.GetLootId();
+					Loot.ItemId = FRH_ItemId(pItemPair.Value.GetItemId(0));
+					Loot.SubVendorId = pItemPair.Value.GetSubVendorId(0);
+
+					const ERHAPI_InventoryOperation InventoryOperation = pItemPair.Value.GetInventoryOperation(ERHAPI_InventoryOperation::Invalid);
+					Loot.bGrantsItem = pItemPair.Value.GetItemId(0) != 0 &&
+						(InventoryOperation == ERHAPI_InventoryOperation::Add || (InventoryOperation == ERHAPI_InventoryOperation::Set && pItemPair.Value.GetQuantity(0) > 0));
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+const FRHVendorClosure* URHStoreItemHelper::GetVendorClosure(int32 nVendorId)
+{
+	if (const FRHVendorClosure* Closure = VendorClosures.Find(nVendorId))
+	{
+		return Closure;
+	}
+
+	URH_CatalogSubsystem* CatalogSubsystem = GetRH_CatalogSubsystem();
+	if (CatalogSubsystem == nullptr || nVendorId == 0)
+	{
+		return nullptr;
+	}
+
+	return FRHVendorClosure::Build(nVendorId, [CatalogSubsystem](int32 VendorId, FRHAPI_Vendor& OutVendor)
+		{
+			return CatalogSubsystem->GetVendorById(VendorId, OutVendor);
+		}, VendorClosures, UncachedVendorClosure);
+}
+
+const FRHVendorClosure* FRHVendorClosure::Build(int32 nVendorId, FRHVendorClosureLookup GetVendor, TMap<int32, FRHVendorClosure>& InOutClosures, FRHVendorClosure& OutUncachedClosure)
+{
+	struct FClosureFrame
+	{
+		int32 VendorId = 0;
+		int32 NextLoot = 0;
+		// Shallowest stack depth of a vendor whose cycle was broken below this one, the closure is only right while that vendor is on the stack
+		int32 CycleDepth = MAX_int32;
+		// An unloaded vendor was treated as empty somewhere below this one
+		bool bDependsOnUnloadedVendor = false;
+	};
+
+	struct FPartialClosure
+	{
+		FRHVendorClosure Closure;
+		int32 CycleDepth = MAX_int32;
+		bool bDependsOnUnloadedVendor = false;
+	};
+
+	// Walk the sub vendors depth first with an explicit stack, closing each vendor once all of its sub vendors are closed.
+	// Every vendor is copied out of the catalog once, and vendors already closed by earlier queries are reused as is.
+	// Closures that depend on an unloaded vendor, or on where a cycle was broken, are only kept for this walk, so they are rebuilt once the data is in.
+	TMap<int32, TArray<FVendorClosureLoot>> LootByVendor;
+	TMap<int32, FPartialClosure> PartialClosures;
+	TArray<FClosureFrame> Stack;
+	TMap<int32, int32> StackDepthByVendor;
+
+	Stack.AddDefaulted_GetRef().VendorId = nVendorId;
+	StackDepthByVendor.Add(nVendorId, 0);
+
+	while (Stack.Num() > 0)
+	{
+		const int32 Depth = Stack.Num() - 1;
+		const int32 VendorId = Stack[Depth].VendorId;
+
+		if (!LootByVendor.Contains(VendorId))
+		{
+			TArray<FVendorClosureLoot> VendorLoot;
+			if (!GetVendorClosureLoot(GetVendor, VendorId, VendorLoot))
+			{
+				UE_LOG(RallyHereStart, Verbose, TEXT("FRHVendorClosure::Build vendor %d is not loaded, treating it as empty until it is"), VendorId);
+				Stack[Depth].bDependsOnUnloadedVendor = true;
+			}
+			LootByVendor.Add(VendorId, MoveTemp(VendorLoot));
+		}
+
+		const TArray<FVendorClosureLoot>& VendorLoot = LootByVendor.FindChecked(VendorId);
+
+		bool bPushedSubVendor = false;
+		while (Stack[Depth].NextLoot < VendorLoot.Num())
+		{
+			const int32 SubVendorId = VendorLoot[Stack[Depth].NextLoot++].SubVendorId;
+			if (SubVendorId == 0 || InOutClosures.Contains(SubVendorId))
+			{
+				continue;
+			}
+
+			if (const FPartialClosure* PartialClosure = PartialClosures.Find(SubVendorId))
+			{
+				Stack[Depth].CycleDepth = FMath::Min(Stack[Depth].CycleDepth, PartialClosure->CycleDepth);
+				Stack[Depth].bDependsOnUnloadedVendor |= PartialClosure->bDependsOnUnloadedVendor;
+				continue;
+			}
+
+			if (const int32* SubVendorDepth = StackDepthByVendor.Find(SubVendorId))
+			{
+				UE_LOG(RallyHereStart, Warning, TEXT("FRHVendorClosure::Build vendor %d contains itself through sub vendor %d, ignoring the cycle"), VendorId, SubVendorId);
+				Stack[Depth].CycleDepth = FMath::Min(Stack[Depth].CycleDepth, *SubVendorDepth);
+				continue;
+			}
+
+			Stack.AddDefaulted_GetRef().VendorId = SubVendorId;
+			StackDepthByVendor.Add(SubVendorId, Depth + 1);
+			bPushedSubVendor = true;
+			break;
+		}
+
+		if (bPushedSubVendor)
+		{
+			continue;
+		}
+
+		FRHVendorClosure Closure;
+		for (const FVendorClosureLoot& Loot : VendorLoot)
+		{
+			if (Loot.bGrantsItem)
+			{
+				Closure.DirectGrantedItemIds.Add(Loot.ItemId);
+			}
+
+			if (Loot.SubVendorId != 0)
+			{
+				// Missing only when the sub vendor closes a cycle
+				const FRHVendorClosure* SubClosure = InOutClosures.Find(Loot.SubVendorId);
+				if (SubClosure == nullptr)
+				{
+					const FPartialClosure* PartialClosure = PartialClosures.Find(Loot.SubVendorId);
+					SubClosure = PartialClosure != nullptr ? &PartialClosure->Closure : nullptr;
+				}
+
+				if (SubClosure != nullptr)
+				{
+					Closure.LootIds.Append(SubClosure->LootIds);
+					Closure.GrantedItemIds.Append(SubClosure->GrantedItemIds);
+				}
+			}
+			else
+			{
+				Closure.LootIds.Add(Loot.LootId);
+
+				if (Loot.bGrantsItem)
+				{
+					Closure.GrantedItemIds.Add(Loot.ItemId);
+				}
+			}
+		}
+
+		const FClosureFrame Frame = Stack.Pop();
+		StackDepthByVendor.Remove(VendorId);
+
+		// A cycle broken back at this vendor leaves out nothing, this vendor's own loot is already in the closure
+		const int32 CycleDepth = Frame.CycleDepth < Depth ? Frame.CycleDepth : MAX_int32;
+
+		if (!Frame.bDependsOnUnloadedVendor && CycleDepth == MAX_int32)
+		{
+			InOutClosures.Add(VendorId, MoveTemp(Closure));
+		}
+		else
+		{
+			FPartialClosure& PartialClosure = PartialClosures.Add(VendorId);
+			PartialClosure.Closure = MoveTemp(Closure);
+			PartialClosure.CycleDepth = CycleDepth;
+			PartialClosure.bDependsOnUnloadedVendor = Frame.bDependsOnUnloadedVendor;
+		}
+
+		// Closures that left out this vendor's contents to break a cycle are wrong anywhere but below it
+		for (auto It = PartialClosures.CreateIterator(); It; ++It)
+		{
+			if (It->Value.CycleDepth != MAX_int32 && It->Value.CycleDepth >= Depth)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (Stack.Num() > 0)
+		{
+			FClosureFrame& Parent = Stack.Last();
+			Parent.CycleDepth = FMath::Min(Parent.CycleDepth, CycleDepth);
+			Parent.bDependsOnUnloadedVendor |= Frame.bDependsOnUnloadedVendor;
+		}
+	}
+
+	if (const FRHVendorClosure* Closure = InOutClosures.Find(nVendorId))
+	{
+		return Closure;
+	}
+
+	// The requested vendor always closes without a cycle above it, so only an unloaded vendor keeps it out of the cache
+	if (FPartialClosure* PartialClosure = PartialClosures.Find(nVendorId))
+	{
+		OutUncachedClosure = MoveTemp(PartialClosure->Closure);
+		return &OutUncachedClosure;
+	}
+
+	return nullptr;
+}
+
+bool URHStoreItemHelper::VendorGrantsItemId(int32 nVendorId, const FRH_ItemId& nItemId, bool bSearchSubContainers)
+{
+	if (const FRHVendorClosure* Closure = GetVendorClosure(nVendorId))
+	{
+		return bSearchSubContainers ? Closure->GrantedItemIds.Contains(nItemId) : Closure->DirectGrantedItemIds.Contains(nItemId);
+	}
+
+	return false;
+}
+
 void URHStoreItemHelper::RequestVendorData(TArray<int32> VendorIds, FRH_CatalogCallBlock Delegate)
 {
 	if (VendorIds.Num() > 0)
 	{
 		if (URH_CatalogSubsystem* CatalogSubsystem = GetRH_CatalogSubsystem())
 		{
-			FRHVendorGetRequest Request = FRHVendorGetRequest(Delegate, VendorIds);
+			// Vendor contents may have changed, so the flattened vendor closures are rebuilt on next use
+			FRHVendorGetRequest Request = FRHVendorGetRequest(FRH_CatalogCallDelegate::CreateWeakLambda(this, [this, Delegate](bool bSuccess)
+				{
+					InvalidateVendorClosures();
+					Delegate.ExecuteIfBound(bSuccess);
+				}), VendorIds);
 			CatalogSubsystem->GetCatalogVendor(Request);
 		}
 	}
@@ -1667,19 +1920,7 @@ bool URHStoreItem::BundleContainsItemId(const FRH_ItemId& nItemId, bool bSearchS
 		{
 			if (pItemHelper.IsValid())
 			{
-				TArray<URHStoreItem*> ContainedItems = pItemHelper.Get()->GetStoreItemsForVendor(*SubVendorId, false, bSearchSubContainers);
-
-				for (URHStoreItem* ContainedItem : ContainedItems)
-				{
-					if (ContainedItem->GetItemId() == nItemId)
-					{
-						if (ContainedItem->GetInventoryOperation() == ERHAPI_InventoryOperation::Add ||
-							(ContainedItem->GetInventoryOperation() == ERHAPI_InventoryOperation::Set && ContainedItem->GetLootQuantity() > 0))
-						{
-							return true;
-						}
-					}
-				}
+				return pItemHelper.Get()->VendorGrantsItemId(*SubVendorId, nItemId, bSearchSubContainers);
 			}
 		}
 	}
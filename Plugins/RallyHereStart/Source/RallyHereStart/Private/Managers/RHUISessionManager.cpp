@@ -8,6 +8,7 @@
 #include "RH_MatchmakingBrowser.h"
 #include "RH_EntitlementSubsystem.h"
 #include "Managers/RHStoreItemHelper.h"
+#include "Managers/RHJsonDataFactory.h"
 #include "Managers/RHUISessionManager.h"
 
 void URHUISessionManager::Initialize(URHGameInstance* InGameInstance)
@@ -70,6 +71,9 @@ void URHUISessionManager::OnLoginPlayerChanged(ULocalPlayer* LocalPlayer)
 									{
 										StoreItemHelper->RequestVendorData(VendorIds, FRH_CatalogCallDelegate::CreateLambda([this, PlayerInfo](bool bSuccess)
 											{
+												// Fresh vendor data means the redemption recipes need to be compiled again
+												++RedemptionVendorDataGeneration;
+
 												if (PlayerInfo != nullptr)
 												{
 													ProcessRedemptionRewards(PlayerInfo);
@@ -184,156 +188,298 @@ void URHUISessionManager::ProcessRedemptionRewards(URH_PlayerInfo* PlayerInfo)
 		}
 	}
 
-	if (CatalogSubsystem != nullptr)
-	{		
-		FRHAPI_Vendor Vendor;
-		if (CatalogSubsystem->GetVendorById(RewardRedemptionVendorId, Vendor))
+	if (CatalogSubsystem == nullptr || PlayerInfo == nullptr || PlayerInfo->GetPlayerInventory() == nullptr)
+	{
+		return;
+	}
+
+	if (!CompiledRedemptionRecipes.IsValid() || CompiledRedemptionVendorDataGeneration != RedemptionVendorDataGeneration)
+	{
+		CompileRedemptionRecipes(CatalogSubsystem);
+	}
+
+	// Hold onto the recipes we started with, in case they get recompiled before the counts come back
+	TSharedPtr<const FRHCompiledRedemptionRecipes> CompiledRecipes = CompiledRedemptionRecipes;
+
+	if (!CompiledRecipes.IsValid() || CompiledRecipes->Recipes.Num() == 0)
+	{
+		return;
+	}
+
+	if (CompiledRecipes->ItemIds.Num() == 0)
+	{
+		RedeemRewards(PlayerInfo, *CompiledRecipes, TMap<FRH_ItemId, int32>());
+		return;
+	}
+
+	// Fetch every count the recipes need in one batch, then evaluate them all synchronously
+	URH_PlayerInventoryCountHelper* Helper = NewObject<URH_PlayerInventoryCountHelper>();
+	Helper->PlayerInfo = PlayerInfo;
+
+	for (const int32 ItemId : CompiledRecipes->ItemIds)
+	{
+		Helper->ItemIdsToCheck.Add(ItemId);
+	}
+
+	Helper->Event = FOnGetInventoryCounts::CreateWeakLambda(this, [this, PlayerInfo, CompiledRecipes, Helper](FRHInventoryCountWrapper CountWrapper)
 		{
-			if (const auto& LootItems = Vendor.GetLootOrNull())
+			PendingInventoryCountHelpers.Remove(Helper);
+			RedeemRewards(PlayerInfo, *CompiledRecipes, CountWrapper.InventoryCountsById);
+		});
+
+	PendingInventoryCountHelpers.Add(Helper);
+	Helper->StartCheck();
+}
+
+void URHUISessionManager::RedeemRewards(URH_PlayerInfo* PlayerInfo, const FRHCompiledRedemptionRecipes& CompiledRecipes, const TMap<FRH_ItemId, int32>& InventoryCounts)
+{
+	URH_PlayerInventory* PlayerInventory = PlayerInfo != nullptr ? PlayerInfo->GetPlayerInventory() : nullptr;
+	if (PlayerInventory == nullptr)
+	{
+		return;
+	}
+
+	TArray<URH_PlayerOrderEntry*> PlayerOrderEntries;
+
+	for (const FRHRedemptionRecipe& Recipe : CompiledRecipes.Recipes)
+	{
+		const int32 QuantityToRedeem = Recipe.Evaluate(InventoryCounts);
+
+		if (QuantityToRedeem > 0)
+		{
+			URH_PlayerOrderEntry* NewPlayerOrderEntry = NewObject<URH_PlayerOrderEntry>();
+			NewPlayerOrderEntry->FillType = ERHAPI_PlayerOrderEntryType::PurchaseLoot;
+			NewPlayerOrderEntry->LootId = Recipe.LootItem.GetLootId();
+			NewPlayerOrderEntry->Quantity = QuantityToRedeem;
+			NewPlayerOrderEntry->ExternalTransactionId = "Reward Redemption During Login";
+			PlayerOrderEntries.Push(NewPlayerOrderEntry);
+		}
+	}
+
+	if (PlayerOrderEntries.Num() > 0)
+	{
+		PlayerInventory->CreateNewPlayerOrder(ERHAPI_Source::Client, false, PlayerOrderEntries, FRH_OrderResultDelegate::CreateWeakLambda(this, [this](const URH_PlayerInfo* PlayerInfo, TArray<URH_PlayerOrderEntry*> OrderEntries, const FRHAPI_PlayerOrder& PlayerOrder)
 			{
-				for (const auto& VendorItemPair : (*LootItems))
+				if (URHOrderManager* OrderManager = GameInstance->GetOrderManager())
 				{
-					const FRHAPI_Loot& LootItem = VendorItemPair.Value;
-					
-					if (LootItem.GetActive(false) && LootItem.GetIsClaimableByClient(false) && LootItem.GetSubVendorId(0) != 0)
-					{
-						GetClaimableQuantity(LootItem, CatalogSubsystem, PlayerInfo, 0, 0, FRH_GetInventoryCountDelegate::CreateWeakLambda(this, [this, LootItem, PlayerInfo](int32 QuantityToRedeem)
-							{
-								if (QuantityToRedeem > 0)
-								{
-									TArray<URH_PlayerOrderEntry*> PlayerOrderEntries;
-
-									URH_PlayerOrderEntry* NewPlayerOrderEntry = NewObject<URH_PlayerOrderEntry>();
-									NewPlayerOrderEntry->FillType = ERHAPI_PlayerOrderEntryType::PurchaseLoot;
-									NewPlayerOrderEntry->LootId = LootItem.GetLootId();
-									NewPlayerOrderEntry->Quantity = QuantityToRedeem;
-									NewPlayerOrderEntry->ExternalTransactionId = "Reward Redemption During Login";
-									PlayerOrderEntries.Push(NewPlayerOrderEntry);
-
-									PlayerInfo->GetPlayerInventory()->CreateNewPlayerOrder(ERHAPI_Source::Client, false, PlayerOrderEntries, FRH_OrderResultDelegate::CreateLambda([this](const URH_PlayerInfo* PlayerInfo, TArray<URH_PlayerOrderEntry*> OrderEntries, const FRHAPI_PlayerOrder& PlayerOrder)
-										{
-											if (URHOrderManager* OrderManager = GameInstance->GetOrderManager())
-											{
-												TArray<FRHAPI_PlayerOrder> OrderResults;
-												OrderResults.Push(PlayerOrder);
-												OrderManager->OnPlayerOrder(OrderResults, PlayerInfo);
-											}
-										}));
-								}
-							}));
-					}
+					TArray<FRHAPI_PlayerOrder> OrderResults;
+					OrderResults.Push(PlayerOrder);
+					OrderManager->OnPlayerOrder(OrderResults, PlayerInfo);
 				}
-			}
-		}
+			}));
 	}
 }
 
-void URHUISessionManager::GetClaimableQuantity(FRHAPI_Loot LootItem, URH_CatalogSubsystem* CatalogSubsystem, URH_PlayerInfo* PlayerInfo, int32 LootIndex, int32 Quantity, const FRH_GetInventoryCountBlock& Delegate)
+void URHUISessionManager::CompileRedemptionRecipes(URH_CatalogSubsystem* CatalogSubsystem)
 {
-	int32 QuantityToRedeem = Quantity;
+	TSharedPtr<FRHCompiledRedemptionRecipes> NewRecipes = MakeShared<FRHCompiledRedemptionRecipes>();
+	TSet<int32> ItemIds;
 
-	if (CatalogSubsystem != nullptr)
+	FRHAPI_Vendor Vendor;
+	if (CatalogSubsystem->GetVendorById(RewardRedemptionVendorId, Vendor))
 	{
-		FRHAPI_Vendor Vendor;
-		if (CatalogSubsystem->GetVendorById(LootItem.GetSubVendorId(0), Vendor))
+		if (const auto& LootItems = Vendor.GetLootOrNull())
 		{
-			TArray<FRHAPI_Loot> RedemptionVendorRecipeItems;
-
-			if (const auto& LootItems = Vendor.GetLootOrNull())
+			for (const auto& VendorItemPair : (*LootItems))
 			{
-				for (const auto& VendorItemPair : (*LootItems))
-				{
-					// Build out and sort the items from the given vendor so we can evaluate the recipe
-					const FRHAPI_Loot& RedemptionItem = VendorItemPair.Value;
+				const FRHAPI_Loot& LootItem = VendorItemPair.Value;
 
-					if (RedemptionItem.GetActive(false))
-					{
-						RedemptionVendorRecipeItems.Add(RedemptionItem);
-					}
+				if (LootItem.GetActive(false) && LootItem.GetIsClaimableByClient(false) && LootItem.GetSubVendorId(0) != 0)
+				{
+					FRHRedemptionRecipe& Recipe = NewRecipes->Recipes.AddDefaulted_GetRef();
+					Recipe.LootItem = LootItem;
+					Recipe.Compile(LootItem.GetSubVendorId(0), [CatalogSubsystem](int32 VendorId, FRHAPI_Vendor& OutVendor) { return CatalogSubsystem->GetVendorById(VendorId, OutVendor); }, ItemIds);
 				}
 			}
+		}
+	}
+
+	NewRecipes->ItemIds = ItemIds.Array();
+
+	CompiledRedemptionRecipes = NewRecipes;
+	CompiledRedemptionVendorDataGeneration = RedemptionVendorDataGeneration;
+}
+
+void FRHRedemptionRecipe::Compile(int32 SubVendorId, FRHRedemptionVendorLookup GetVendor, TSet<int32>& OutItemIds)
+{
+	Ops.Reset();
 
-			RedemptionVendorRecipeItems.Sort([](const FRHAPI_Loot& A, const FRHAPI_Loot& B) { return (A.GetSortOrder(0) < B.GetSortOrder(0)); });
+	TArray<int32> VendorStack;
+	CompileBlock(SubVendorId, GetVendor, Ops, OutItemIds, VendorStack);
 
-			for (int32 i = LootIndex; i < RedemptionVendorRecipeItems.Num(); ++i)
+	// Early outs in the outermost block finish the evaluation
+	for (FRHRedemptionRecipeOp& Op : Ops)
+	{
+		if (Op.BlockEnd == INDEX_NONE)
+		{
+			Op.BlockEnd = Ops.Num();
+		}
+	}
+}
+
+void FRHRedemptionRecipe::CompileBlock(int32 VendorId, FRHRedemptionVendorLookup GetVendor, TArray<FRHRedemptionRecipeOp>& OutOps, TSet<int32>& OutItemIds, TArray<int32>& VendorStack)
+{
+	if (VendorStack.Contains(VendorId))
+	{
+		UE_LOG(RallyHereStart, Warning, TEXT("FRHRedemptionRecipe::CompileBlock -- Vendor %d references itself through its sub vendors, skipping"), VendorId);
+		return;
+	}
+
+	FRHAPI_Vendor Vendor;
+	if (!GetVendor(VendorId, Vendor))
+	{
+		return;
+	}
+
+	TArray<FRHAPI_Loot> RedemptionVendorRecipeItems;
+
+	if (const auto& LootItems = Vendor.GetLootOrNull())
+	{
+		for (const auto& VendorItemPair : (*LootItems))
+		{
+			// Build out and sort the items from the given vendor so we can evaluate the recipe
+			const FRHAPI_Loot& RedemptionItem = VendorItemPair.Value;
+
+			if (RedemptionItem.GetActive(false))
 			{
-				const FRHAPI_Loot& RecipeItem = RedemptionVendorRecipeItems[i];
+				RedemptionVendorRecipeItems.Add(RedemptionItem);
+			}
+		}
+	}
+
+	RedemptionVendorRecipeItems.Sort([](const FRHAPI_Loot& A, const FRHAPI_Loot& B) { return (A.GetSortOrder(0) < B.GetSortOrder(0)); });
+
+	VendorStack.Push(VendorId);
 
-				int32 InternalRedeemCount = 0;
+	for (const FRHAPI_Loot& RecipeItem : RedemptionVendorRecipeItems)
+	{
+		if (RecipeItem.GetSubVendorId(0) != 0)
+		{
+			// Inline the sub recipe as its own block, early outs inside it only end that block
+			const int32 BlockStart = OutOps.Num();
+
+			FRHRedemptionRecipeOp& BeginOp = OutOps.AddDefaulted_GetRef();
+			BeginOp.Type = FRHRedemptionRecipeOp::EType::BeginBlock;
+
+			CompileBlock(RecipeItem.GetSubVendorId(0), GetVendor, OutOps, OutItemIds, VendorStack);
 
-				if (RecipeItem.GetSubVendorId(0) != 0)
+			const int32 BlockEnd = OutOps.Num();
+			FRHRedemptionRecipeOp& EndOp = OutOps.AddDefaulted_GetRef();
+			EndOp.Type = FRHRedemptionRecipeOp::EType::EndBlock;
+
+			// Ops of nested blocks were already resolved to their own end, begin and end ops never early out
+			for (int32 i = BlockStart + 1; i < BlockEnd; ++i)
+			{
+				if (OutOps[i].BlockEnd == INDEX_NONE)
 				{
-					// Create a sub thread for this recipe item, then when it completes continue where we left off.
-					GetClaimableQuantity(RecipeItem, CatalogSubsystem, PlayerInfo, 0, 0, FRH_GetInventoryCountDelegate::CreateWeakLambda(this, [this, LootItem, PlayerInfo, CatalogSubsystem, QuantityToRedeem, i, Delegate](int32 InternalRedeemCount)
-						{
-							// If an internal bundle has more redeem counts than we have externally redeem this multiple times
-							int32 NewQty = QuantityToRedeem;
-							if (InternalRedeemCount > QuantityToRedeem)
-							{
-								NewQty = InternalRedeemCount;
-							}
+					OutOps[i].BlockEnd = BlockEnd;
+				}
+			}
+		}
+		else if (RecipeItem.GetItemId(0) != 0)
+		{
+			const ERHAPI_InventoryOperation Operation = RecipeItem.GetInventoryOperation(ERHAPI_InventoryOperation::Invalid);
 
-							GetClaimableQuantity(LootItem, CatalogSubsystem, PlayerInfo, i + 1, NewQty, Delegate);
-						}));
-					return;
+			switch (Operation)
+			{
+				case ERHAPI_InventoryOperation::CheckLessThan:
+				case ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract:
+				case ERHAPI_InventoryOperation::CheckGreaterThanOrEqual:
+				{
+					FRHRedemptionRecipeOp& CheckOp = OutOps.AddDefaulted_GetRef();
+					CheckOp.Type = FRHRedemptionRecipeOp::EType::CheckItem;
+					CheckOp.Operation = Operation;
+					CheckOp.ItemId = RecipeItem.GetItemId(0);
+					CheckOp.Quantity = RecipeItem.GetQuantity();
+					OutItemIds.Add(CheckOp.ItemId);
+					break;
 				}
-				else if (RecipeItem.GetItemId(0) != 0)
+				case ERHAPI_InventoryOperation::Subtract:
+				case ERHAPI_InventoryOperation::Set:
+				case ERHAPI_InventoryOperation::Add:
 				{
-					if (URH_PlayerInventory* PlayerInventory = PlayerInfo->GetPlayerInventory())
-					{
-						PlayerInventory->GetInventoryCount(RecipeItem.GetItemId(0), FRH_GetInventoryCountDelegate::CreateWeakLambda(this, [this, RecipeItem, LootItem, PlayerInfo, CatalogSubsystem, QuantityToRedeem, i, Delegate](int32 InventoryCount)
-							{
-								int32 NewQty = QuantityToRedeem;
+					FRHRedemptionRecipeOp& GrantOp = OutOps.AddDefaulted_GetRef();
+					GrantOp.Type = FRHRedemptionRecipeOp::EType::Grant;
+					GrantOp.Operation = Operation;
+					GrantOp.ItemId = RecipeItem.GetItemId(0);
+					GrantOp.Quantity = RecipeItem.GetQuantity();
+					break;
+				}
+				case ERHAPI_InventoryOperation::Invalid:
+				default:
+					// Do nothing in these cases with evaluating the item
+					break;
+			}
+		}
+	}
 
-								switch (RecipeItem.GetInventoryOperation(ERHAPI_InventoryOperation::Invalid))
-								{
-									case ERHAPI_InventoryOperation::CheckLessThan:
-										if (InventoryCount >= RecipeItem.GetQuantity())
-										{
-											// Early out, redeem whatever amount we have calculated up to this point
-											Delegate.ExecuteIfBound(QuantityToRedeem);
-											return;
-										}
-										break;
-									case ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract:
-										// If we are going to start consuming something of yours, count how many times we can consume it
-										if (InventoryCount > 0)
-										{
-											int32 InternalRedeemCount = InventoryCount / RecipeItem.GetQuantity();
-
-											if (InternalRedeemCount > QuantityToRedeem)
-											{
-												NewQty = InternalRedeemCount;
-											}
-										}
-										// FALLTHOUGH
-									case ERHAPI_InventoryOperation::CheckGreaterThanOrEqual:
-										if (InventoryCount < RecipeItem.GetQuantity())
-										{
-											// Early out, redeem whatever amount we have calculated up to this point
-											Delegate.ExecuteIfBound(QuantityToRedeem);
-											return;
-										}
-										break;
-									case ERHAPI_InventoryOperation::Subtract:
-									case ERHAPI_InventoryOperation::Set:
-									case ERHAPI_InventoryOperation::Add:
-										// If we make it to this level of item type then we have are actually getting something, claim this LTI
-										Delegate.ExecuteIfBound(QuantityToRedeem > 0 ? QuantityToRedeem : 1);
-										return;
-										break;
-									case ERHAPI_InventoryOperation::Invalid:
-									default:
-										// Do nothing in these cases with evaluating the item
-										break;
-								}
-								GetClaimableQuantity(LootItem, CatalogSubsystem, PlayerInfo, i + 1, NewQty, Delegate);
-							}));
-						return;
-					}
+	VendorStack.Pop();
+}
+
+int32 FRHRedemptionRecipe::Evaluate(const TMap<FRH_ItemId, int32>& InventoryCounts) const
+{
+	// Claim quantities of the blocks enclosing the one currently being evaluated
+	TArray<int32, TInlineAllocator<8>> OuterQuantities;
+	int32 QuantityToRedeem = 0;
+
+	for (int32 i = 0; i < Ops.Num(); ++i)
+	{
+		const FRHRedemptionRecipeOp& Op = Ops[i];
+		bool bEndBlock = false;
+
+		switch (Op.Type)
+		{
+			case FRHRedemptionRecipeOp::EType::BeginBlock:
+				OuterQuantities.Push(QuantityToRedeem);
+				QuantityToRedeem = 0;
+				break;
+			case FRHRedemptionRecipeOp::EType::EndBlock:
+				// If an internal bundle has more redeem counts than we have externally redeem this multiple times
+				QuantityToRedeem = FMath::Max(OuterQuantities.Pop(false), QuantityToRedeem);
+				break;
+			case FRHRedemptionRecipeOp::EType::Grant:
+				// If we make it to this level of item type then we have are actually getting something, claim this LTI
+				QuantityToRedeem = QuantityToRedeem > 0 ? QuantityToRedeem : 1;
+				bEndBlock = true;
+				break;
+			case FRHRedemptionRecipeOp::EType::CheckItem:
+			{
+				const int32* FoundCount = InventoryCounts.Find(FRH_ItemId(Op.ItemId));
+				const int32 InventoryCount = FoundCount != nullptr ? *FoundCount : 0;
+
+				switch (Op.Operation)
+				{
+					case ERHAPI_InventoryOperation::CheckLessThan:
+						// Early out, redeem whatever amount we have calculated up to this point
+						bEndBlock = InventoryCount >= Op.Quantity;
+						break;
+					case ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract:
+						if (InventoryCount < Op.Quantity)
+						{
+							bEndBlock = true;
+						}
+						else if (Op.Quantity > 0)
+						{
+							// If we are going to start consuming something of yours, count how many times we can consume it
+							QuantityToRedeem = FMath::Max(QuantityToRedeem, InventoryCount / Op.Quantity);
+						}
+						break;
+					case ERHAPI_InventoryOperation::CheckGreaterThanOrEqual:
+						bEndBlock = InventoryCount < Op.Quantity;
+						break;
+					default:
+						break;
 				}
+				break;
 			}
 		}
+
+		if (bEndBlock)
+		{
+			// Resume on the block's end op, or finish if this is the outermost block
+			i = Op.BlockEnd - 1;
+		}
 	}
-	Delegate.ExecuteIfBound(QuantityToRedeem);
-}
\ No newline at end of file
+
+	return QuantityToRedeem;
+}
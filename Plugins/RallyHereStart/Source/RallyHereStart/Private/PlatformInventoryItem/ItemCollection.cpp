@@ -61,16 +61,14 @@ void UItemCollection::UpdateCollection()
 		return;
 	}
 
-	const TMap<FPrimaryAssetId, FGameplayTagContainer>& CollectionMap = pAssetManager->GetItemCollectionMap();
-	for (const TPair<FPrimaryAssetId, FGameplayTagContainer>& Pair : CollectionMap)
+	TArray<FPrimaryAssetId> MatchingAssetIds;
+	pAssetManager->GetPrimaryAssetIdListByCollectionQuery(CollectionQuery, MatchingAssetIds);
+	for (const FPrimaryAssetId& MatchingAssetId : MatchingAssetIds)
 	{
-		if (Pair.Value.MatchesQuery(CollectionQuery))
+		FAssetData Data;
+		if (pAssetManager->GetPrimaryAssetData(MatchingAssetId, Data))
 		{
-			FAssetData Data;
-			if (pAssetManager->GetPrimaryAssetData(Pair.Key, Data))
-			{
-				TryToAddAsset(Data);
-			}
+			TryToAddAsset(Data);
 		}
 	}
 }
@@ -2,12 +2,16 @@
 #include "PlatformInventoryItem/PInv_AssetManager.h"
 #include "PlatformInventoryItem/PInv_Delegates.h"
 #include "PlatformInventoryItem/PInv_AssetManagerSettings.h"
+#include "Misc/Paths.h"
+#include "Algo/Unique.h"
 
 #if WITH_EDITOR
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Parse.h"
+#include "Misc/App.h"
+#include "Interfaces/ITargetPlatform.h"
 #include "PlatformInventoryItem/PlatformInventoryItem.h"
 #endif
 
@@ -19,10 +23,102 @@ const FPrimaryAssetType UPInv_AssetManager::PlatformInventoryItemType = FName(TE
 const FPrimaryAssetType UPInv_AssetManager::PlatformStoreAssetType = FName(TEXT("PlatformStoreAsset"));
 const FPrimaryAssetType UPInv_AssetManager::ItemCollectionType = FName(TEXT("ItemCollection"));
 
+namespace PInv_CollectionIndex
+{
+    // All index sets are sorted ascending and unique, so the set operations below are linear merges.
+    void Union(const TArray<int32>& A, const TArray<int32>& B, TArray<int32>& Out)
+    {
+        Out.Reset(A.Num() + B.Num());
+        int32 i = 0, j = 0;
+        while (i < A.Num() && j < B.Num())
+        {
+            if (A[i] < B[j])
+            {
+                Out.Add(A[i++]);
+            }
+            else if (B[j] < A[i])
+            {
+                Out.Add(B[j++]);
+            }
+            else
+            {
+                Out.Add(A[i++]);
+                ++j;
+            }
+        }
+        Out.Append(A.GetData() + i, A.Num() - i);
+        Out.Append(B.GetData() + j, B.Num() - j);
+    }
+
+    void Intersect(const TArray<int32>& A, const TArray<int32>& B, TArray<int32>& Out)
+    {
+        Out.Reset(FMath::Min(A.Num(), B.Num()));
+        int32 i = 0, j = 0;
+        while (i < A.Num() && j < B.Num())
+        {
+            if (A[i] < B[j])
+            {
+                ++i;
+            }
+            else if (B[j] < A[i])
+            {
+                ++j;
+            }
+            else
+            {
+                Out.Add(A[i++]);
+                ++j;
+            }
+        }
+    }
+
+    // Returns every index in [0, UniverseSize) that is not in A.
+    void Complement(const TArray<int32>& A, int32 UniverseSize, TArray<int32>& Out)
+    {
+        Out.Reset(UniverseSize - A.Num());
+        int32 i = 0;
+        for (int32 Index = 0; Index < UniverseSize; ++Index)
+        {
+            if (i < A.Num() && A[i] == Index)
+            {
+                ++i;
+            }
+            else
+            {
+                Out.Add(Index);
+            }
+        }
+    }
+
+    void Universe(int32 UniverseSize, TArray<int32>& Out)
+    {
+        Out.Reset(UniverseSize);
+        for (int32 Index = 0; Index < UniverseSize; ++Index)
+        {
+            Out.Add(Index);
+        }
+    }
+
+    uint32 HashQueryExpr(const FGameplayTagQueryExpression& QueryExpr)
+    {
+        uint32 Hash = GetTypeHash(static_cast<uint8>(QueryExpr.ExprType));
+        for (const FGameplayTag& Tag : QueryExpr.TagSet)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Tag));
+        }
+        for (const FGameplayTagQueryExpression& SubExpr : QueryExpr.ExprSet)
+        {
+            Hash = HashCombine(Hash, HashQueryExpr(SubExpr));
+        }
+        return Hash;
+    }
+}
+
 UPInv_AssetManager::UPInv_AssetManager()
 	: Super()
 {
 	bHasCompletedInitialAssetScan = false;
+    bCollectionTagIndexDirty = true;
     bIsQuickCook = false;
     CookProfile = TEXT("Default");
 }
@@ -63,8 +159,26 @@ void UPInv_AssetManager::PostInitProperties()
 
 void UPInv_AssetManager::StartInitialLoading()
 {
+	const double StartTime = FPlatformTime::Seconds();
+
+#if WITH_EDITOR
+	// Only the cooker builds a snapshot, it is written into the cook output from ModifyCook. Editor sessions parse every tag directly.
+	RegistrySnapshot.SetRecording(GetPInvSettings().bUseRegistrySnapshot && IsRunningCookCommandlet());
+#else
+	if (GetPInvSettings().bUseRegistrySnapshot)
+	{
+		if (!RegistrySnapshot.LoadFromFile(GetRegistrySnapshotFilePath()))
+		{
+			UE_LOG(LogPInv_AssetManager, Log, TEXT("No valid registry snapshot found at %s, all Item Ids will be parsed from the asset registry"), *GetRegistrySnapshotFilePath());
+		}
+	}
+#endif
+
 	Super::StartInitialLoading();
 
+	UE_LOG(LogPInv_AssetManager, Log, TEXT("Initial asset scan took %.2f ms (registry snapshot entries: %d, hits: %d, parsed: %d)"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0, RegistrySnapshot.Num(), RegistrySnapshot.GetNumHits(), RegistrySnapshot.GetNumMisses());
+
 	PInv_Delegates::OnReadyForBundleData.Broadcast();
 }
 
@@ -74,10 +188,42 @@ void UPInv_AssetManager::PostInitialAssetScan()
 
 	InternalPostInitialAssetScan();
 
+	// Anything scanned after this point is parsed directly, the snapshot is only needed for the initial scan.
+	// While cooking the entries are kept until ModifyCook has written them out.
+	if (!RegistrySnapshot.IsRecording())
+	{
+		RegistrySnapshot.Reset();
+	}
+
 	bHasCompletedInitialAssetScan = true;
 	PInv_Delegates::OnPostInitialAssetScan.Broadcast();
 }
 
+FString UPInv_AssetManager::GetRegistrySnapshotFilePath() const
+{
+	return FPaths::ProjectContentDir() / GetPInvSettings().RegistrySnapshotPath;
+}
+
+#if WITH_EDITOR
+FString UPInv_AssetManager::GetCookedRegistrySnapshotFilePath(const ITargetPlatform* TargetPlatform) const
+{
+	// Mirrors the cooker's output layout so the snapshot is staged with the cooked content and ends up at GetRegistrySnapshotFilePath() in a packaged build
+	const FString PlatformName = TargetPlatform->PlatformName();
+
+	FString CookOutputDir;
+	if (FParse::Value(FCommandLine::Get(), TEXT("OutputDir="), CookOutputDir))
+	{
+		CookOutputDir.ReplaceInline(TEXT("[Platform]"), *PlatformName);
+	}
+	else
+	{
+		CookOutputDir = FPaths::ProjectSavedDir() / TEXT("Cooked") / PlatformName;
+	}
+
+	return CookOutputDir / FApp::GetProjectName() / TEXT("Content") / GetPInvSettings().RegistrySnapshotPath;
+}
+#endif
+
 void UPInv_AssetManager::InitializeDisabledItems(URH_ConfigSubsystem* ConfigSubsystem)
 {
 	if (ConfigSubsystem == nullptr)
@@ -150,23 +296,193 @@ bool UPInv_AssetManager::ShouldScanPrimaryAssetTypeForCollectionContainer(const
 
 bool UPInv_AssetManager::GetPrimaryAssetIdListByCollectionQuery(const FGameplayTagQuery& InCollectionQuery, TArray<FPrimaryAssetId>& OutPrimaryAssetIds) const
 {
-    bool bAnyFound = false;
+    if (InCollectionQuery.IsEmpty())
+    {
+        return false;
+    }
+
+    FGameplayTagQueryExpression QueryExpr;
+    InCollectionQuery.GetQueryExpr(QueryExpr);
+    const uint32 QueryHash = PInv_CollectionIndex::HashQueryExpr(QueryExpr);
+
+    FScopeLock IndexLock(&CollectionTagIndexLock);
+
+    if (bCollectionTagIndexDirty)
+    {
+        RebuildCollectionTagIndex();
+    }
 
-    if (!InCollectionQuery.IsEmpty())
+    TArray<FCollectionQueryCacheEntry*, TInlineAllocator<1>> CachedEntries;
+    CollectionQueryCache.MultiFindPointer(QueryHash, CachedEntries);
+    for (const FCollectionQueryCacheEntry* CachedEntry : CachedEntries)
     {
-        for (const TPair<FPrimaryAssetId, FGameplayTagContainer>& Pair : ItemCollectionMap)
+        if (CachedEntry->Query == InCollectionQuery)
         {
-            if (Pair.Value.MatchesQuery(InCollectionQuery))
+            OutPrimaryAssetIds.Append(CachedEntry->PrimaryAssetIds);
+            return CachedEntry->PrimaryAssetIds.Num() > 0;
+        }
+    }
+
+    FCollectionQueryCacheEntry NewEntry;
+    NewEntry.Query = InCollectionQuery;
+
+    TArray<int32> MatchingIndices;
+    if (EvaluateCollectionQueryExpr(QueryExpr, MatchingIndices))
+    {
+        NewEntry.PrimaryAssetIds.Reserve(MatchingIndices.Num());
+        for (int32 AssetIndex : MatchingIndices)
+        {
+            NewEntry.PrimaryAssetIds.Add(CollectionIndexAssetIds[AssetIndex]);
+        }
+    }
+    else
+    {
+        // The query uses an expression the index can't answer, fall back to matching every container directly.
+        for (const FPrimaryAssetId& PrimaryAssetId : CollectionIndexAssetIds)
+        {
+            if (ItemCollectionMap.FindChecked(PrimaryAssetId).MatchesQuery(InCollectionQuery))
             {
-                OutPrimaryAssetIds.Add(Pair.Key);
-                bAnyFound = true;
+                NewEntry.PrimaryAssetIds.Add(PrimaryAssetId);
             }
         }
     }
 
+    OutPrimaryAssetIds.Append(NewEntry.PrimaryAssetIds);
+    const bool bAnyFound = NewEntry.PrimaryAssetIds.Num() > 0;
+    CollectionQueryCache.Add(QueryHash, MoveTemp(NewEntry));
+
     return bAnyFound;
 }
 
+void UPInv_AssetManager::RebuildCollectionTagIndex() const
+{
+    CollectionIndexAssetIds.Reset(ItemCollectionMap.Num());
+    CollectionAssetIndexById.Reset();
+    CollectionAssetIndicesByTag.Reset();
+    CollectionQueryCache.Reset();
+
+    // Assets are numbered in ItemCollectionMap order, per tag index lists are filled from ItemsByGameplayTagMap as queries need them
+    for (const TPair<FPrimaryAssetId, FGameplayTagContainer>& Pair : ItemCollectionMap)
+    {
+        CollectionAssetIndexById.Add(Pair.Key, CollectionIndexAssetIds.Add(Pair.Key));
+    }
+
+    bCollectionTagIndexDirty = false;
+}
+
+const TArray<int32>& UPInv_AssetManager::GetCollectionAssetIndicesForTag(const FGameplayTag& Tag) const
+{
+    if (const TArray<int32>* FoundIndices = CollectionAssetIndicesByTag.Find(Tag))
+    {
+        return *FoundIndices;
+    }
+
+    // A container matches a tag if it has the tag or any of its children, matching how MatchesQuery treats a container's tags.
+    TArray<FGameplayTag> TagsToFind;
+    UGameplayTagsManager::Get().RequestGameplayTagChildren(Tag).GetGameplayTagArray(TagsToFind);
+    TagsToFind.Add(Tag);
+
+    TArray<int32>& AssetIndices = CollectionAssetIndicesByTag.Add(Tag);
+    TArray<FPrimaryAssetId> AssetIds;
+    for (const FGameplayTag& TagToFind : TagsToFind)
+    {
+        AssetIds.Reset();
+        ItemsByGameplayTagMap.MultiFind(TagToFind, AssetIds);
+
+        for (const FPrimaryAssetId& AssetId : AssetIds)
+        {
+            if (const int32* AssetIndex = CollectionAssetIndexById.Find(AssetId))
+            {
+                AssetIndices.Add(*AssetIndex);
+            }
+        }
+    }
+
+    AssetIndices.Sort();
+    AssetIndices.SetNum(Algo::Unique(AssetIndices));
+    return AssetIndices;
+}
+
+bool UPInv_AssetManager::EvaluateCollectionQueryExpr(const FGameplayTagQueryExpression& QueryExpr, TArray<int32>& OutAssetIndices) const
+{
+    const int32 NumAssets = CollectionIndexAssetIds.Num();
+
+    TArray<int32> Scratch;
+    TArray<int32> Operand;
+
+    switch (QueryExpr.ExprType)
+    {
+    case EGameplayTagQueryExprType::AnyTagsMatch:
+    case EGameplayTagQueryExprType::NoTagsMatch:
+        OutAssetIndices.Reset();
+        for (const FGameplayTag& Tag : QueryExpr.TagSet)
+        {
+            PInv_CollectionIndex::Union(OutAssetIndices, GetCollectionAssetIndicesForTag(Tag), Scratch);
+            Swap(OutAssetIndices, Scratch);
+        }
+        if (QueryExpr.ExprType == EGameplayTagQueryExprType::NoTagsMatch)
+        {
+            PInv_CollectionIndex::Complement(OutAssetIndices, NumAssets, Scratch);
+            Swap(OutAssetIndices, Scratch);
+        }
+        return true;
+
+    case EGameplayTagQueryExprType::AllTagsMatch:
+        PInv_CollectionIndex::Universe(NumAssets, OutAssetIndices);
+        for (const FGameplayTag& Tag : QueryExpr.TagSet)
+        {
+            PInv_CollectionIndex::Intersect(OutAssetIndices, GetCollectionAssetIndicesForTag(Tag), Scratch);
+            Swap(OutAssetIndices, Scratch);
+            if (OutAssetIndices.Num() == 0)
+            {
+                break;
+            }
+        }
+        return true;
+
+    case EGameplayTagQueryExprType::AnyExprMatch:
+    case EGameplayTagQueryExprType::NoExprMatch:
+        OutAssetIndices.Reset();
+        for (const FGameplayTagQueryExpression& SubExpr : QueryExpr.ExprSet)
+        {
+            if (!EvaluateCollectionQueryExpr(SubExpr, Operand))
+            {
+                return false;
+            }
+            PInv_CollectionIndex::Union(OutAssetIndices, Operand, Scratch);
+            Swap(OutAssetIndices, Scratch);
+        }
+        if (QueryExpr.ExprType == EGameplayTagQueryExprType::NoExprMatch)
+        {
+            PInv_CollectionIndex::Complement(OutAssetIndices, NumAssets, Scratch);
+            Swap(OutAssetIndices, Scratch);
+        }
+        return true;
+
+    case EGameplayTagQueryExprType::AllExprMatch:
+        PInv_CollectionIndex::Universe(NumAssets, OutAssetIndices);
+        for (const FGameplayTagQueryExpression& SubExpr : QueryExpr.ExprSet)
+        {
+            if (!EvaluateCollectionQueryExpr(SubExpr, Operand))
+            {
+                return false;
+            }
+            PInv_CollectionIndex::Intersect(OutAssetIndices, Operand, Scratch);
+            Swap(OutAssetIndices, Scratch);
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void UPInv_AssetManager::MarkCollectionTagIndexDirty()
+{
+    FScopeLock IndexLock(&CollectionTagIndexLock);
+    bCollectionTagIndexDirty = true;
+}
+
 #if WITH_EDITOR
 void UPInv_AssetManager::ReinitializeFromConfig()
 {
@@ -228,6 +544,7 @@ void UPInv_AssetManager::RefreshPrimaryAssetDirectory(bool bForceRefresh /*= fal
 		PrimaryAssetIdToLootIdMap.Empty();
 		ItemIdToPrimaryAssetIdMap.Empty();
         LootIdToPrimaryAssetIdMap.Empty();
+        MarkCollectionTagIndexDirty();
 	}
 
 	Super::RefreshPrimaryAssetDirectory(bForceRefresh);
@@ -313,6 +630,25 @@ void UPInv_AssetManager::ModifyCook(TConstArrayView<const ITargetPlatform*> Targ
     }
 
     Super::ModifyCook(TargetPlatforms, PackagesToCook, PackagesToNeverCook);
+
+    if (RegistrySnapshot.IsRecording())
+    {
+        for (const ITargetPlatform* TargetPlatform : TargetPlatforms)
+        {
+            const FString SnapshotFilePath = GetCookedRegistrySnapshotFilePath(TargetPlatform);
+            if (RegistrySnapshot.SaveToFile(SnapshotFilePath))
+            {
+                UE_LOG(LogPInv_AssetManager, Log, TEXT("Wrote registry snapshot with %d entries to %s"), RegistrySnapshot.Num(), *SnapshotFilePath);
+            }
+            else
+            {
+                UE_LOG(LogPInv_AssetManager, Error, TEXT("Failed to write registry snapshot to %s"), *SnapshotFilePath);
+            }
+        }
+
+        RegistrySnapshot.SetRecording(false);
+        RegistrySnapshot.Reset();
+    }
 }
 
 void UPInv_AssetManager::RemovePrimaryAssetId(const FPrimaryAssetId& PrimaryAssetId)
@@ -320,6 +656,7 @@ void UPInv_AssetManager::RemovePrimaryAssetId(const FPrimaryAssetId& PrimaryAsse
 	RemoveFromItemIdMap(PrimaryAssetId);
 	RemoveFromLootIdMap(PrimaryAssetId);
     RemoveFromCollectionContainerMap(PrimaryAssetId);
+    RegistrySnapshot.Remove(PrimaryAssetId);
 
 	Super::RemovePrimaryAssetId(PrimaryAssetId);
 }
@@ -364,27 +701,19 @@ void UPInv_AssetManager::AddOrUpdateItemIdMap(const FPrimaryAssetId& PrimaryAsse
 	FString ItemIdAsString;
 	if (AssetData.GetTagValue(nmItemId, ItemIdAsString))
 	{
-		FRH_ItemId NewItemId;
-
-		if (ItemIdAsString.Contains("Id="))
-		{
-			int32 GuidIndex = ItemIdAsString.Find("Id=");
-			int32 LegacyItemIdIndex = ItemIdAsString.Find("LegacyId=");
-			int32 EndIndex = ItemIdAsString.Find(")");
-			FString GuidAsString = ItemIdAsString.RightChop(GuidIndex + 3).Left(32);
-			FString LegacyItemIdAsString = ItemIdAsString.RightChop(LegacyItemIdIndex + 9).Left(EndIndex - 1);
-			FGuid ItemId;
-			FGuid::Parse(GuidAsString, ItemId);
-			int32 LegacyItemId = FCString::Atoi(*LegacyItemIdAsString);
-			// Id is full struct data
-			NewItemId = FRH_ItemId(ItemId, LegacyItemId);
-		}
-		else
+		const uint32 ItemIdTagHash = RegistrySnapshot.IsActive() ? FPInv_RegistrySnapshot::HashTagString(ItemIdAsString) : 0;
+		const FPInv_RegistrySnapshot::FIdTag* ParsedItemId = RegistrySnapshot.IsEmpty() ? nullptr : RegistrySnapshot.FindItemId(PrimaryAssetId, ItemIdTagHash);
+		FPInv_RegistrySnapshot::FIdTag NewlyParsedItemId;
+		if (ParsedItemId == nullptr)
 		{
-			// Id is just a number, parse it out.
-			NewItemId = FCString::Atoi(*ItemIdAsString);
+			// Asset is missing from the snapshot or its tag has changed since it was written, parse the tag string.
+			NewlyParsedItemId = FPInv_RegistrySnapshot::ParseIdTagString(ItemIdAsString, ItemIdTagHash);
+			ParsedItemId = &NewlyParsedItemId;
+			RegistrySnapshot.SetItemId(PrimaryAssetId, NewlyParsedItemId);
 		}
 
+		const FRH_ItemId NewItemId = ParsedItemId->bHasGuid ? FRH_ItemId(ParsedItemId->Guid, ParsedItemId->LegacyId) : FRH_ItemId(ParsedItemId->LegacyId);
+
 #if WITH_EDITOR
 		if (!NewItemId.IsValid())
 		{
@@ -454,27 +783,19 @@ void UPInv_AssetManager::AddOrUpdateLootIdMap(const FPrimaryAssetId& PrimaryAsse
 	FString LootIdAsString;
 	if (AssetData.GetTagValue(nmLootId, LootIdAsString))
 	{
-		FRH_LootId NewLootId;
-
-		if (LootIdAsString.Contains("Id="))
+		const uint32 LootIdTagHash = RegistrySnapshot.IsActive() ? FPInv_RegistrySnapshot::HashTagString(LootIdAsString) : 0;
+		const FPInv_RegistrySnapshot::FIdTag* ParsedLootId = RegistrySnapshot.IsEmpty() ? nullptr : RegistrySnapshot.FindLootId(PrimaryAssetId, LootIdTagHash);
+		FPInv_RegistrySnapshot::FIdTag NewlyParsedLootId;
+		if (ParsedLootId == nullptr)
 		{
-			int32 GuidIndex = LootIdAsString.Find("Id=");
-			int32 LegacyItemIdIndex = LootIdAsString.Find("LegacyId=");
-			int32 EndIndex = LootIdAsString.Find(")");
-			FString GuidAsString = LootIdAsString.RightChop(GuidIndex + 3).Left(32);
-			FString LegacyIdAsString = LootIdAsString.RightChop(LegacyItemIdIndex + 9).Left(EndIndex - 1);
-			FGuid Id;
-			FGuid::Parse(GuidAsString, Id);
-			int32 LegacyId = FCString::Atoi(*LegacyIdAsString);
-			// Id is full struct data
-			NewLootId = FRH_LootId(Id, LegacyId);
-		}
-		else
-		{
-			// Id is just a number, parse it out.
-			NewLootId = FCString::Atoi(*LootIdAsString);
+			// Asset is missing from the snapshot or its tag has changed since it was written, parse the tag string.
+			NewlyParsedLootId = FPInv_RegistrySnapshot::ParseIdTagString(LootIdAsString, LootIdTagHash);
+			ParsedLootId = &NewlyParsedLootId;
+			RegistrySnapshot.SetLootId(PrimaryAssetId, NewlyParsedLootId);
 		}
 
+		const FRH_LootId NewLootId = ParsedLootId->bHasGuid ? FRH_LootId(ParsedLootId->Guid, ParsedLootId->LegacyId) : FRH_LootId(ParsedLootId->LegacyId);
+
 #if WITH_EDITOR
 		if (!NewLootId.IsValid())
 		{
@@ -549,7 +870,31 @@ void UPInv_AssetManager::AddOrUpdateCollectionContainerMap(const FPrimaryAssetId
     if (AssetData.GetTagValue(nmCollectionContainer, CollectionContainerAsString))
     {
         FGameplayTagContainer NewCollectionContainer;
-        NewCollectionContainer.FromExportString(CollectionContainerAsString);
+
+        const uint32 CollectionTagHash = RegistrySnapshot.IsActive() ? FPInv_RegistrySnapshot::HashTagString(CollectionContainerAsString) : 0;
+        const FPInv_RegistrySnapshot::FCollectionTag* ParsedCollection = RegistrySnapshot.IsEmpty() ? nullptr : RegistrySnapshot.FindCollection(PrimaryAssetId, CollectionTagHash);
+        if (ParsedCollection != nullptr)
+        {
+            for (const FName& TagName : ParsedCollection->TagNames)
+            {
+                NewCollectionContainer.AddTag(FGameplayTag::RequestGameplayTag(TagName, false));
+            }
+        }
+        else
+        {
+            NewCollectionContainer.FromExportString(CollectionContainerAsString);
+            if (RegistrySnapshot.IsRecording())
+            {
+                FPInv_RegistrySnapshot::FCollectionTag NewlyParsedCollection;
+                NewlyParsedCollection.TagHash = CollectionTagHash;
+                NewlyParsedCollection.bIsSet = true;
+                for (const FGameplayTag& Tag : NewCollectionContainer)
+                {
+                    NewlyParsedCollection.TagNames.Add(Tag.GetTagName());
+                }
+                RegistrySnapshot.SetCollection(PrimaryAssetId, NewlyParsedCollection);
+            }
+        }
 
 #if WITH_EDITOR
         if (NewCollectionContainer.IsEmpty())
@@ -577,6 +922,7 @@ void UPInv_AssetManager::AddOrUpdateCollectionContainerMap(const FPrimaryAssetId
             }
 
             ExistingCollectionContainer = MoveTemp(NewCollectionContainer);
+            MarkCollectionTagIndexDirty();
 
             for( const FGameplayTag& NewTag : ExistingCollectionContainer )
             {
@@ -609,6 +955,7 @@ void UPInv_AssetManager::RemoveFromCollectionContainerMap(const FPrimaryAssetId&
         {
             ItemsByGameplayTagMap.Remove(RemovedTag, PrimaryAssetId);
         }
+        MarkCollectionTagIndexDirty();
     }
 }
 
@@ -9,6 +9,8 @@ UPInv_AssetManagerSettings::UPInv_AssetManagerSettings(const FObjectInitializer&
 {
     bQuickCook=false;
     CookProfile = TEXT("Default");
+    bUseRegistrySnapshot = true;
+    RegistrySnapshotPath = TEXT("PInv/ItemRegistrySnapshot.bin");
 }
 
 #if WITH_EDITOR
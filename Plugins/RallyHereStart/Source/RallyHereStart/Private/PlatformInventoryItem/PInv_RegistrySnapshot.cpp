@@ -0,0 +1,208 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "PlatformInventoryItem/PInv_RegistrySnapshot.h"
+#include "PlatformInventoryItem/PInv_AssetManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/BufferReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+// 'PINV'
+const uint32 FPInv_RegistrySnapshot::SnapshotMagic = 0x50494E56;
+// Bump whenever the layout of FEntry or the tag parsing rules change
+const int32 FPInv_RegistrySnapshot::SnapshotVersion = 2;
+
+FArchive& operator<<(FArchive& Ar, FPInv_RegistrySnapshot::FIdTag& IdTag)
+{
+	Ar << IdTag.bIsSet;
+	if (IdTag.bIsSet)
+	{
+		Ar << IdTag.TagHash;
+		Ar << IdTag.bHasGuid;
+		Ar << IdTag.Guid;
+		Ar << IdTag.LegacyId;
+	}
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPInv_RegistrySnapshot::FCollectionTag& CollectionTag)
+{
+	Ar << CollectionTag.bIsSet;
+	if (CollectionTag.bIsSet)
+	{
+		Ar << CollectionTag.TagHash;
+		Ar << CollectionTag.TagNames;
+	}
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPInv_RegistrySnapshot::FEntry& Entry)
+{
+	Ar << Entry.ItemId;
+	Ar << Entry.LootId;
+	Ar << Entry.Collection;
+	return Ar;
+}
+
+uint32 FPInv_RegistrySnapshot::HashTagString(const FString& TagString)
+{
+	// Runs for every tagged asset during the initial scan, so hash the character buffer in one pass instead of a per character StrCrc32
+	return static_cast<uint32>(CityHash64(reinterpret_cast<const char*>(*TagString), TagString.Len() * sizeof(TCHAR)));
+}
+
+FPInv_RegistrySnapshot::FIdTag FPInv_RegistrySnapshot::ParseIdTagString(const FString& TagString, uint32 TagHash)
+{
+	FIdTag IdTag;
+	IdTag.TagHash = TagHash;
+	IdTag.bIsSet = true;
+
+	if (TagString.Contains("Id="))
+	{
+		int32 GuidIndex = TagString.Find("Id=");
+		int32 LegacyIdIndex = TagString.Find("LegacyId=");
+		int32 EndIndex = TagString.Find(")");
+		FString GuidAsString = TagString.RightChop(GuidIndex + 3).Left(32);
+		FString LegacyIdAsString = TagString.RightChop(LegacyIdIndex + 9).Left(EndIndex - 1);
+		FGuid::Parse(GuidAsString, IdTag.Guid);
+		// Id is full struct data
+		IdTag.LegacyId = FCString::Atoi(*LegacyIdAsString);
+		IdTag.bHasGuid = true;
+	}
+	else
+	{
+		// Id is just a number, parse it out.
+		IdTag.LegacyId = FCString::Atoi(*TagString);
+	}
+
+	return IdTag;
+}
+
+const FPInv_RegistrySnapshot::FIdTag* FPInv_RegistrySnapshot::FindItemId(const FPrimaryAssetId& PrimaryAssetId, uint32 TagHash) const
+{
+	const FEntry* Entry = Entries.Find(PrimaryAssetId);
+	if (Entry != nullptr && Entry->ItemId.bIsSet && Entry->ItemId.TagHash == TagHash)
+	{
+		++NumHits;
+		return &Entry->ItemId;
+	}
+
+	++NumMisses;
+	return nullptr;
+}
+
+const FPInv_RegistrySnapshot::FIdTag* FPInv_RegistrySnapshot::FindLootId(const FPrimaryAssetId& PrimaryAssetId, uint32 TagHash) const
+{
+	const FEntry* Entry = Entries.Find(PrimaryAssetId);
+	if (Entry != nullptr && Entry->LootId.bIsSet && Entry->LootId.TagHash == TagHash)
+	{
+		++NumHits;
+		return &Entry->LootId;
+	}
+
+	++NumMisses;
+	return nullptr;
+}
+
+const FPInv_RegistrySnapshot::FCollectionTag* FPInv_RegistrySnapshot::FindCollection(const FPrimaryAssetId& PrimaryAssetId, uint32 TagHash) const
+{
+	const FEntry* Entry = Entries.Find(PrimaryAssetId);
+	if (Entry != nullptr && Entry->Collection.bIsSet && Entry->Collection.TagHash == TagHash)
+	{
+		++NumHits;
+		return &Entry->Collection;
+	}
+
+	++NumMisses;
+	return nullptr;
+}
+
+bool FPInv_RegistrySnapshot::LoadFromFile(const FString& FilePath)
+{
+	Reset();
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FBufferReader Reader(FileData.GetData(), FileData.Num(), false);
+	FNameAsStringProxyArchive ProxyReader(Reader);
+	return Serialize(ProxyReader);
+}
+
+bool FPInv_RegistrySnapshot::SaveToFile(const FString& FilePath) const
+{
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData, true);
+	FNameAsStringProxyArchive ProxyWriter(Writer);
+
+	if (!const_cast<FPInv_RegistrySnapshot*>(this)->Serialize(ProxyWriter))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveArrayToFile(FileData, *FilePath);
+}
+
+bool FPInv_RegistrySnapshot::Serialize(FArchive& Ar)
+{
+	uint32 Magic = SnapshotMagic;
+	int32 Version = SnapshotVersion;
+	Ar << Magic;
+	Ar << Version;
+
+	if (Ar.IsError() || Magic != SnapshotMagic || Version != SnapshotVersion)
+	{
+		UE_LOG(LogPInv_AssetManager, Warning, TEXT("Ignoring registry snapshot with unexpected header (Magic=%08x, Version=%d)"), Magic, Version);
+		return false;
+	}
+
+	int32 NumEntries = Entries.Num();
+	Ar << NumEntries;
+
+	if (Ar.IsLoading())
+	{
+		if (NumEntries < 0)
+		{
+			return false;
+		}
+
+		Entries.Empty(NumEntries);
+		for (int32 i = 0; i < NumEntries && !Ar.IsError(); ++i)
+		{
+			FName PrimaryAssetType;
+			FName PrimaryAssetName;
+			Ar << PrimaryAssetType;
+			Ar << PrimaryAssetName;
+			Ar << Entries.Add(FPrimaryAssetId(PrimaryAssetType, PrimaryAssetName));
+		}
+	}
+	else
+	{
+		for (TPair<FPrimaryAssetId, FEntry>& Pair : Entries)
+		{
+			FName PrimaryAssetType = Pair.Key.PrimaryAssetType.GetName();
+			FName PrimaryAssetName = Pair.Key.PrimaryAssetName;
+			Ar << PrimaryAssetType;
+			Ar << PrimaryAssetName;
+			Ar << Pair.Value;
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FPInv_RegistrySnapshot::Reset()
+{
+	Entries.Empty();
+	NumHits = 0;
+	NumMisses = 0;
+}
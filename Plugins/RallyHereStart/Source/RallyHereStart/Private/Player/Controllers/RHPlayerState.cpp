@@ -7,12 +7,24 @@
 #include "Managers/RHStoreItemHelper.h"
 #include "RHUIBlueprintFunctionLibrary.h"
 #include "Player/Controllers/RHPlayerController.h"
+#include "GameFramework/RHGameState.h"
 #include "RH_LocalPlayer.h"
 #include "RH_FriendSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
+static bool PlatformUsesMultiplayerFeaturesForOSS()
+{
+	static const bool bIsSonyPlatform = []()
+	{
+		const FString PlatformName = UGameplayStatics::GetPlatformName();
+		return PlatformName == TEXT("PS4") || PlatformName == TEXT("PS5");
+	}();
+	return bIsSonyPlatform;
+}
+
 ARHPlayerState::ARHPlayerState(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+	, bUsingMultiplayerFeaturesForOSS(false)
 {
 	RHPlayerId = 0;
 }
@@ -48,6 +60,41 @@ void ARHPlayerState::BeginPlay()
 */
 }
 
+void ARHPlayerState::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// The authority only sets the bot flag after the game state has added this player state
+	RefreshHumanPlayerOnGameState();
+}
+
+void ARHPlayerState::PostNetInit()
+{
+	Super::PostNetInit();
+
+	// Clients add the player state before the initial replication carries the bot and inactive flags
+	RefreshHumanPlayerOnGameState();
+}
+
+void ARHPlayerState::PostRepNotifies()
+{
+	Super::PostRepNotifies();
+
+	// The bot flag has no rep notify, so pick up any later change to it here
+	RefreshHumanPlayerOnGameState();
+}
+
+void ARHPlayerState::RefreshHumanPlayerOnGameState()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (ARHGameState* GameState = World->GetGameState<ARHGameState>())
+		{
+			GameState->RefreshHumanPlayer(this);
+		}
+	}
+}
+
 void ARHPlayerState::OnRep_UniqueId()
 {
 	Super::OnRep_UniqueId();
@@ -90,9 +137,7 @@ void ARHPlayerState::HandleWelcomeMessage()
 
 void ARHPlayerState::UpdateMultiplayerFeaturesForOSS()
 {
-	const FString PlatformName = UGameplayStatics::GetPlatformName();
-	const bool bIsSonyPlatform = PlatformName == TEXT("PS4") || PlatformName == TEXT("PS5");
-	if (!bIsSonyPlatform)
+	if (!PlatformUsesMultiplayerFeaturesForOSS())
 	{
 		return;
 	}
@@ -127,31 +172,36 @@ void ARHPlayerState::UpdateMultiplayerFeaturesForOSS()
 		return;
 	}
 
-	// Determine:
-	// - If local player exists, mark if they are a spectator
-	// - Determine if there are multiple live players in the match - to classify as
-	//   truly using multiplayer features.
-	int32 LivePlayerCount = 0;
-	for (TActorIterator<APlayerState> It(MyWorld); It; ++It)
+	// The match is only truly using multiplayer features with multiple live players in it.
+	// The game state keeps that count as player states come and go, and calls back here when it crosses the threshold.
+	if (ARHGameState* GameState = MyWorld->GetGameState<ARHGameState>())
 	{
-		APlayerState* PlayerState = *It;
-		if (!PlayerState)
-		{
-			continue;
-		}
-
-		if (!PlayerState->IsABot())
+		bIsUsingMultiplayerFeatures = GameState->IsUsingMultiplayerFeatures();
+	}
+	else if (AGameStateBase* GameStateBase = MyWorld->GetGameState())
+	{
+		int32 LivePlayerCount = 0;
+		for (APlayerState* PlayerState : GameStateBase->PlayerArray)
 		{
-			LivePlayerCount++;
+			if (PlayerState != nullptr && !PlayerState->IsABot())
+			{
+				LivePlayerCount++;
+			}
 		}
+		bIsUsingMultiplayerFeatures = LivePlayerCount >= ARHGameState::MultiplayerFeaturesPlayerCount;
+	}
+	else
+	{
+		return;
 	}
 
-	if (LivePlayerCount < 2)
+	if (bIsUsingMultiplayerFeatures == bUsingMultiplayerFeaturesForOSS)
 	{
 		return;
 	}
 
-	OSS->SetUsingMultiplayerFeatures(*LocalPlayerUniqueId, true);
+	bUsingMultiplayerFeaturesForOSS = bIsUsingMultiplayerFeatures;
+	OSS->SetUsingMultiplayerFeatures(*LocalPlayerUniqueId, bIsUsingMultiplayerFeatures);
 }
 
 void ARHPlayerState::GetLifetimeReplicatedProps(TArray< FLifetimeProperty >& OutLifetimeProps) const
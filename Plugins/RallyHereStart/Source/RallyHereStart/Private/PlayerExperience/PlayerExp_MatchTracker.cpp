@@ -30,11 +30,12 @@
 #include "RH_GameInstanceSessionSubsystem.h"
 
 #include "GameFramework/RHGameModeBase.h"
+#include "GameFramework/RHGameEngine.h"
 
 //============================================================================
 // THIS VERSION NUMBER MUST BE UPDATED WHEN THE JSON SCHEMA CHANGES.
 // That means all name changes, deletions, or additions of fields of any sort.
-const int32 UPlayerExp_MatchTracker::SchemaVersionNumber = 6;
+const int32 UPlayerExp_MatchTracker::SchemaVersionNumber = 8;
 //============================================================================
 
 UPlayerExp_MatchTracker::UPlayerExp_MatchTracker(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
@@ -194,6 +195,11 @@ TSharedPtr<FJsonObject> UPlayerExp_MatchTracker::CreateReport()
         FullReportJson->SetField(TEXT("MatchInfo"), MatchInfoJson);
     }
 
+    if (TSharedPtr<FJsonValue> MapLoadJson = CreateReport_MapLoad())
+    {
+        FullReportJson->SetField(TEXT("MapLoad"), MapLoadJson);
+    }
+
 #if WITH_PERFCOUNTERS
     if (IPerfCounters* pPerfCounters = IPerfCountersModule::Get().GetPerformanceCounters())
     {
@@ -627,6 +633,39 @@ TSharedPtr<FJsonValue> UPlayerExp_MatchTracker::CreateReport_MatchInfo()
     return MakeShared<FJsonValueObject>(MatchInfoObject);
 }
 
+TSharedPtr<FJsonValue> UPlayerExp_MatchTracker::CreateReport_MapLoad()
+{
+    const URHGameEngine* pEngine = Cast<URHGameEngine>(GEngine);
+    if (pEngine == nullptr)
+    {
+        return nullptr;
+    }
+
+    const FRHMapLoadTimeline& Timeline = pEngine->GetMapLoadTimeline();
+    if (!Timeline.HasReachedPhase(ERHMapLoadPhase::TravelStart))
+    {
+        return nullptr;
+    }
+
+    TSharedRef<FJsonObject> MapLoadObject = MakeShared<FJsonObject>();
+    MapLoadObject->SetStringField(TEXT("MapName"), Timeline.MapName);
+
+    TSharedRef<FJsonObject> PhasesObject = MakeShared<FJsonObject>();
+    for (int32 PhaseIndex = 0; PhaseIndex < (int32)ERHMapLoadPhase::MAX; ++PhaseIndex)
+    {
+        const ERHMapLoadPhase Phase = (ERHMapLoadPhase)PhaseIndex;
+        PhasesObject->SetNumberField(FRHMapLoadTimeline::GetPhaseName(Phase), Timeline.GetPhaseTime(Phase));
+    }
+    MapLoadObject->SetObjectField(TEXT("PhaseSeconds"), PhasesObject);
+
+    MapLoadObject->SetNumberField(TEXT("PeakMemoryMB"), (double)(Timeline.PeakMemoryBytes >> 20));
+    MapLoadObject->SetNumberField(TEXT("MemoryGrowthMB"), (double)(((int64)Timeline.PeakMemoryBytes - (int64)Timeline.StartMemoryBytes) >> 20));
+    MapLoadObject->SetNumberField(TEXT("PackagesLoaded"), Timeline.PackagesLoaded);
+    MapLoadObject->SetNumberField(TEXT("PackagesLoadedMB"), Timeline.PackageBytesLoaded / (1024.0 * 1024.0));
+
+    return MakeShared<FJsonValueObject>(MapLoadObject);
+}
+
 void UPlayerExp_MatchTracker::SendMatchReport(bool bForceRecache /*= false*/)
 {
     if (bForceRecache || !CachedMatchReport.IsValid())
@@ -7,6 +7,15 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/NetConnection.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// Number of applied uploads the server keeps around as delta baselines.
+static const int32 MaxRetainedStatBaselines = 4;
+// Most unacknowledged periods the client keeps before discarding the oldest.
+static const int32 MaxPendingStatPeriods = 32;
+// Largest upload payload the server will decode, a full histogram is well below this.
+static const int32 MaxStatUploadPayloadBytes = 2048;
 
 UPlayerExp_PlayerComponent::UPlayerExp_PlayerComponent(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
     : Super(ObjectInitializer)
@@ -22,6 +31,9 @@ UPlayerExp_PlayerComponent::UPlayerExp_PlayerComponent(const FObjectInitializer&
     NumHitchesDetected = 0;
     NumHitchesDetected_Period = 0;
     NumServerCorrections = 0;
+    StatUploadBytes = 0;
+    StatUploadCount = 0;
+    StatUploadsRejected = 0;
 
     StatUpdateTime = 0.0;
 
@@ -38,6 +50,14 @@ UPlayerExp_PlayerComponent::UPlayerExp_PlayerComponent(const FObjectInitializer&
 
     RequiredNumSamplesForHitchDetection = 1000;
     HitchDetectionThreshold = 2.0;
+
+    MaxUpdateToServerBackoff = 4;
+    MaxUnackedUploadsBeforeFullUpdate = 3;
+    AckedStatSequence = 0;
+    bSendFullStatUpdate = false;
+    NextStatSequence = 1;
+    ConsecutiveUnackedUploads = 0;
+    LastAppliedStatSequence = 0;
 }
 
 void UPlayerExp_PlayerComponent::OnRegister()
@@ -135,7 +155,25 @@ void UPlayerExp_PlayerComponent::CallSendStatsToServer()
 {
     if (GetOwnerRole() != ROLE_Authority)
     {
-        ServerFrameTimeUpdate(FrameTimeStats_Period, NumHitchesDetected_Period);
+        if (FrameTimeStats_Period.GetTotalSamples() > 0 || NumHitchesDetected_Period > 0)
+        {
+            FPlayerExp_PendingStatPeriod& NewPeriod = PendingStatPeriods.AddDefaulted_GetRef();
+            NewPeriod.Sequence = NextStatSequence++;
+            NewPeriod.FrameTimeStats = FrameTimeStats_Period;
+            NewPeriod.NumHitchesDetected = NumHitchesDetected_Period;
+
+            // If the server has stopped acknowledging entirely, give up on the oldest periods rather than growing forever.
+            if (PendingStatPeriods.Num() > MaxPendingStatPeriods)
+            {
+                PendingStatPeriods.RemoveAt(0, PendingStatPeriods.Num() - MaxPendingStatPeriods);
+            }
+        }
+
+        // Nothing new and nothing unacknowledged, skip the upload entirely.
+        if (PendingStatPeriods.Num() > 0)
+        {
+            SendPendingStatsToServer();
+        }
     }
 
     FrameTimeStats += FrameTimeStats_Period;
@@ -144,6 +182,59 @@ void UPlayerExp_PlayerComponent::CallSendStatsToServer()
     NumHitchesDetected_Period = 0;
 }
 
+void UPlayerExp_PlayerComponent::SendPendingStatsToServer()
+{
+    FPlayerExp_StatAccumulator CombinedStats;
+    int32 CombinedHitches = 0;
+    for (const FPlayerExp_PendingStatPeriod& PendingPeriod : PendingStatPeriods)
+    {
+        CombinedStats += PendingPeriod.FrameTimeStats;
+        CombinedHitches += PendingPeriod.NumHitchesDetected;
+    }
+
+    // Delta encode against the last upload the server acknowledged, unless uploads keep getting lost and the server may no longer have it.
+    const bool bUseBaseline = AckedStatSequence != 0 && !bSendFullStatUpdate && ConsecutiveUnackedUploads < MaxUnackedUploadsBeforeFullUpdate;
+
+    uint32 FirstSequence = PendingStatPeriods[0].Sequence;
+    uint32 LastSequence = PendingStatPeriods.Last().Sequence;
+    uint32 BaselineSequence = bUseBaseline ? AckedStatSequence : 0;
+    uint32 PackedHitches = (uint32)FMath::Max(CombinedHitches, 0);
+
+    TArray<uint8> Payload;
+    FMemoryWriter Writer(Payload);
+    Writer.SerializeIntPacked(FirstSequence);
+    Writer.SerializeIntPacked(LastSequence);
+    Writer.SerializeIntPacked(BaselineSequence);
+    Writer.SerializeIntPacked(PackedHitches);
+
+    FPlayerExp_StatAccumulator PayloadStats = CombinedStats;
+    PayloadStats.SerializeCompact(Writer, bUseBaseline ? &AckedStatPayload : nullptr);
+
+    ServerCompactStatsUpdate(Payload);
+
+    // Keep what the server will decode (after quantization) so it can become the next baseline once acknowledged.
+    FMemoryReader Reader(Payload);
+    Reader.SerializeIntPacked(FirstSequence);
+    Reader.SerializeIntPacked(LastSequence);
+    Reader.SerializeIntPacked(BaselineSequence);
+    Reader.SerializeIntPacked(PackedHitches);
+    FPlayerExp_StatAccumulator& SentStats = SentStatPayloads.FindOrAdd(LastSequence);
+    SentStats.SerializeCompact(Reader, bUseBaseline ? &AckedStatPayload : nullptr);
+
+    // Same bound as the pending periods, an ack for anything older falls back to a full update.
+    while (SentStatPayloads.Num() > MaxPendingStatPeriods)
+    {
+        uint32 OldestSequence = MAX_uint32;
+        for (const TPair<uint32, FPlayerExp_StatAccumulator>& Pair : SentStatPayloads)
+        {
+            OldestSequence = FMath::Min(OldestSequence, Pair.Key);
+        }
+        SentStatPayloads.Remove(OldestSequence);
+    }
+
+    ++ConsecutiveUnackedUploads;
+}
+
 void UPlayerExp_PlayerComponent::CollectPerFrameServerStats(float DeltaTime)
 {
     if (bRecordNetCorrections)
@@ -196,16 +287,119 @@ void UPlayerExp_PlayerComponent::HandleUpdatePing(float InPing)
 
 void UPlayerExp_PlayerComponent::ResetTimeUntilNextAccumulation()
 {
-    TimeUntilNextAccumulation = FMath::Max(UpdateToServerPeriod + FMath::RandRange(-0.5f, 0.5f), 1.0f);
+    // Back off while uploads go unacknowledged, pending periods are combined so nothing is lost by sending less often.
+    const int32 Backoff = FMath::Clamp(1 << FMath::Min(ConsecutiveUnackedUploads, 8), 1, FMath::Max(MaxUpdateToServerBackoff, 1));
+    TimeUntilNextAccumulation = FMath::Max(UpdateToServerPeriod * Backoff + FMath::RandRange(-0.5f, 0.5f), 1.0f);
 }
 
-void UPlayerExp_PlayerComponent::ServerFrameTimeUpdate_Implementation(const FPlayerExp_StatAccumulator& InFrameTimeStats, int32 InHitchesDetected)
+void UPlayerExp_PlayerComponent::ServerCompactStatsUpdate_Implementation(const TArray<uint8>& InPayload)
 {
-    FrameTimeStats += InFrameTimeStats;
-    NumHitchesDetected += InHitchesDetected;
+    StatUploadBytes += InPayload.Num();
+    ++StatUploadCount;
+
+    if (InPayload.Num() > MaxStatUploadPayloadBytes)
+    {
+        ++StatUploadsRejected;
+        return;
+    }
+
+    uint32 FirstSequence = 0;
+    uint32 LastSequence = 0;
+    uint32 BaselineSequence = 0;
+    uint32 PackedHitches = 0;
+
+    FMemoryReader Reader(InPayload);
+    Reader.SerializeIntPacked(FirstSequence);
+    Reader.SerializeIntPacked(LastSequence);
+    Reader.SerializeIntPacked(BaselineSequence);
+    Reader.SerializeIntPacked(PackedHitches);
+
+    if (Reader.IsError() || LastSequence < FirstSequence)
+    {
+        ++StatUploadsRejected;
+        return;
+    }
+
+    // Some of these periods were already applied (our ack was lost), re-acknowledge so the client drops them.
+    if (FirstSequence <= LastAppliedStatSequence)
+    {
+        ++StatUploadsRejected;
+        ClientAckStatsUpdate(LastAppliedStatSequence);
+        return;
+    }
+
+    const FPlayerExp_StatAccumulator* Baseline = nullptr;
+    if (BaselineSequence != 0)
+    {
+        Baseline = AppliedStatPayloads.Find(BaselineSequence);
+        if (Baseline == nullptr)
+        {
+            // The client will fall back to a full update after a few unacknowledged uploads.
+            ++StatUploadsRejected;
+            return;
+        }
+    }
+
+    FPlayerExp_StatAccumulator ReceivedStats;
+    ReceivedStats.SerializeCompact(Reader, Baseline);
+    if (Reader.IsError())
+    {
+        ++StatUploadsRejected;
+        return;
+    }
+
+    FrameTimeStats += ReceivedStats;
+    NumHitchesDetected += (int32)FMath::Min<uint32>(PackedHitches, MAX_int32);
+    LastAppliedStatSequence = LastSequence;
+
+    AppliedStatPayloads.Add(LastSequence, MoveTemp(ReceivedStats));
+    while (AppliedStatPayloads.Num() > MaxRetainedStatBaselines)
+    {
+        uint32 OldestSequence = MAX_uint32;
+        for (const TPair<uint32, FPlayerExp_StatAccumulator>& Pair : AppliedStatPayloads)
+        {
+            OldestSequence = FMath::Min(OldestSequence, Pair.Key);
+        }
+        AppliedStatPayloads.Remove(OldestSequence);
+    }
+
+    ClientAckStatsUpdate(LastSequence);
 }
 
-bool UPlayerExp_PlayerComponent::ServerFrameTimeUpdate_Validate(const FPlayerExp_StatAccumulator& InFrameTimeStats, int32 InHitchesDetected)
+bool UPlayerExp_PlayerComponent::ServerCompactStatsUpdate_Validate(const TArray<uint8>& InPayload)
 {
     return true;
 }
+
+void UPlayerExp_PlayerComponent::ClientAckStatsUpdate_Implementation(uint32 InSequence)
+{
+    if (InSequence <= AckedStatSequence)
+    {
+        return;
+    }
+
+    AckedStatSequence = InSequence;
+
+    if (FPlayerExp_StatAccumulator* SentStats = SentStatPayloads.Find(InSequence))
+    {
+        AckedStatPayload = *SentStats;
+        bSendFullStatUpdate = false;
+    }
+    else
+    {
+        // We no longer know what the server decoded for this sequence, the next upload is sent in full.
+        // AckedStatSequence still advances so older acks arriving out of order stay ignored.
+        bSendFullStatUpdate = true;
+    }
+
+    PendingStatPeriods.RemoveAll([InSequence](const FPlayerExp_PendingStatPeriod& PendingPeriod) { return PendingPeriod.Sequence <= InSequence; });
+    for (auto It = SentStatPayloads.CreateIterator(); It; ++It)
+    {
+        if (It.Key() <= InSequence)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    ConsecutiveUnackedUploads = 0;
+}
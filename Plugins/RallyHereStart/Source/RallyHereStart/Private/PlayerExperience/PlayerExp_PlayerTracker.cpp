@@ -29,6 +29,9 @@ UPlayerExp_PlayerTracker::UPlayerExp_PlayerTracker(const FObjectInitializer& Obj
     FrameTimeStats = FPlayerExp_StatAccumulator();
     NumHitchesDetected = 0;
     NumServerCorrections = 0;
+    StatUploadBytes = 0;
+    StatUploadCount = 0;
+    StatUploadsRejected = 0;
 
     PlayerComponentClass = nullptr;
     ActivePlayerComponent = nullptr;
@@ -221,6 +224,9 @@ void UPlayerExp_PlayerTracker::RecordPlayerComponentData(UPlayerExp_PlayerCompon
     FrameTimeStats += InPlayerComponent->FrameTimeStats;
     NumHitchesDetected += InPlayerComponent->NumHitchesDetected;
     NumServerCorrections += InPlayerComponent->NumServerCorrections;
+    StatUploadBytes += InPlayerComponent->StatUploadBytes;
+    StatUploadCount += InPlayerComponent->StatUploadCount;
+    StatUploadsRejected += InPlayerComponent->StatUploadsRejected;
 
     InTotalPackets += InPlayerComponent->InTotalPackets;
     InTotalPacketsLost += InPlayerComponent->InTotalPacketsLost;
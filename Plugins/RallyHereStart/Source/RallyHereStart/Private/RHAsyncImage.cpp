@@ -2,9 +2,289 @@
 
 #include "RallyHereStart.h"
 #include "RHAsyncImage.h"
+#include "Engine/AssetManager.h"
 #include "Widgets/Images/SImage.h"
 #include "Inventory/IconInfo.h"
 
+DECLARE_STATS_GROUP(TEXT("RHAsyncImage"), STATGROUP_RHAsyncImage, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Shared Loads"), STAT_RHAsyncImage_PendingLoads, STATGROUP_RHAsyncImage);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Waiting Images"), STAT_RHAsyncImage_WaitingImages, STATGROUP_RHAsyncImage);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Deduplicated Requests"), STAT_RHAsyncImage_DeduplicatedRequests, STATGROUP_RHAsyncImage);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Canceled Loads"), STAT_RHAsyncImage_CanceledLoads, STATGROUP_RHAsyncImage);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Resident UI Textures"), STAT_RHAsyncImage_ResidentTextures, STATGROUP_RHAsyncImage);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Released UI Textures"), STAT_RHAsyncImage_ReleasedTextures, STATGROUP_RHAsyncImage);
+DECLARE_MEMORY_STAT(TEXT("Resident UI Texture Memory"), STAT_RHAsyncImage_ResidentMemory, STATGROUP_RHAsyncImage);
+DECLARE_MEMORY_STAT(TEXT("Resident UI Texture Budget"), STAT_RHAsyncImage_ResidentBudget, STATGROUP_RHAsyncImage);
+
+static int32 GAsyncImageResidentTextureBudgetMB = 256;
+
+/*
+* Shares one streamable handle between every URHAsyncImage waiting on the same soft path, and fans the completion out to all of them.
+* A load is canceled once the last image waiting on it is canceled or destroyed.
+* Also tracks the UI textures the images force fully resident, counting the images displaying each one. When over budget the least recently
+* displayed textures no image is showing anymore are released back to the texture streamer.
+*/
+class FRHAsyncImageRequestBroker
+{
+public:
+	static FRHAsyncImageRequestBroker& Get()
+	{
+		static FRHAsyncImageRequestBroker Broker;
+		return Broker;
+	}
+
+	// Adds the image as a waiter on the load of SoftPath, starting the load if no other image is waiting on it. Returns the shared handle.
+	TSharedPtr<FStreamableHandle> AddRequest(URHAsyncImage* Image, const FSoftObjectPath& SoftPath, TFunction<void(UObject*)>&& OnLoaded)
+	{
+		FPendingLoad* PendingLoad = PendingLoads.Find(SoftPath);
+		if (PendingLoad != nullptr && PendingLoad->Handle.IsValid())
+		{
+			PendingLoad->Requesters.Add({ Image, MoveTemp(OnLoaded) });
+			++NumDeduplicatedRequests;
+			UpdateRequestStats();
+			return PendingLoad->Handle;
+		}
+
+		PendingLoads.FindOrAdd(SoftPath).Requesters.Add({ Image, MoveTemp(OnLoaded) });
+
+		TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftPath,
+			FStreamableDelegate::CreateRaw(this, &FRHAsyncImageRequestBroker::HandleLoadComplete, SoftPath),
+			FStreamableManager::AsyncLoadHighPriority);
+
+		if (!Handle.IsValid())
+		{
+			// Nothing to stream, let the waiters resolve whatever they can right away
+			HandleLoadComplete(SoftPath);
+			return nullptr;
+		}
+
+		// The completion may already have run if the handle finished synchronously
+		if (FPendingLoad* StartedLoad = PendingLoads.Find(SoftPath))
+		{
+			StartedLoad->Handle = Handle;
+		}
+
+		UpdateRequestStats();
+		return Handle;
+	}
+
+	// Removes the image as a waiter on SoftPath, canceling the load if nobody else is waiting on it
+	void RemoveRequest(URHAsyncImage* Image, const FSoftObjectPath& SoftPath)
+	{
+		FPendingLoad* PendingLoad = PendingLoads.Find(SoftPath);
+		if (PendingLoad == nullptr)
+		{
+			return;
+		}
+
+		PendingLoad->Requesters.RemoveAllSwap([Image](const FRequester& Requester)
+		{
+			return Requester.Image == Image || !Requester.Image.IsValid();
+		});
+
+		if (PendingLoad->Requesters.Num() == 0)
+		{
+			TSharedPtr<FStreamableHandle> Handle = PendingLoad->Handle;
+			PendingLoads.Remove(SoftPath);
+
+			if (Handle.IsValid())
+			{
+				Handle->CancelHandle();
+				++NumCanceledLoads;
+			}
+		}
+
+		UpdateRequestStats();
+	}
+
+	// Adds an image displaying the texture, forcing its mips resident for UI display and releasing textures no longer displayed if over budget
+	void AddTextureRef(UTexture2D* Texture)
+	{
+		if (Texture == nullptr)
+		{
+			return;
+		}
+
+		FResidentTexture* ResidentTexture = ResidentTextures.Find(Texture);
+		if (ResidentTexture == nullptr)
+		{
+			// Textures already forced resident by their asset settings are not ours to release
+			if (Texture->bForceMiplevelsToBeResident)
+			{
+				return;
+			}
+
+			ResidentTexture = &ResidentTextures.Add(Texture);
+			ResidentTexture->SizeBytes = (int64)Texture->CalcTextureMemorySizeEnum(TMC_AllMips);
+			ResidentTextureBytes += ResidentTexture->SizeBytes;
+		}
+
+		++ResidentTexture->NumRefs;
+		ResidentTexture->LastUseSerial = ++UseSerial;
+		Texture->bForceMiplevelsToBeResident = true;
+		Texture->bIgnoreStreamingMipBias = true;
+
+		EnforceResidentBudget();
+	}
+
+	// Removes an image displaying the texture, once no image displays it the texture may be released when over budget
+	void RemoveTextureRef(const TWeakObjectPtr<UTexture2D>& WeakTexture, bool bEnforceBudget)
+	{
+		FResidentTexture* ResidentTexture = ResidentTextures.Find(WeakTexture);
+		if (ResidentTexture == nullptr || ResidentTexture->NumRefs <= 0)
+		{
+			return;
+		}
+
+		// Least recently used counts from when the last image stopped displaying it
+		ResidentTexture->LastUseSerial = ++UseSerial;
+		if (--ResidentTexture->NumRefs == 0 && bEnforceBudget)
+		{
+			EnforceResidentBudget();
+		}
+	}
+
+	void EnforceResidentBudget()
+	{
+		const int64 BudgetBytes = (int64)GAsyncImageResidentTextureBudgetMB * 1024 * 1024;
+		if (BudgetBytes > 0 && ResidentTextureBytes > BudgetBytes)
+		{
+			// A texture an image is still displaying stays resident even over budget
+			TArray<TPair<uint64, TWeakObjectPtr<UTexture2D>>> ByLastUse;
+			ByLastUse.Reserve(ResidentTextures.Num());
+			for (const TPair<TWeakObjectPtr<UTexture2D>, FResidentTexture>& Pair : ResidentTextures)
+			{
+				if (Pair.Value.NumRefs == 0 || !Pair.Key.IsValid())
+				{
+					ByLastUse.Emplace(Pair.Value.LastUseSerial, Pair.Key);
+				}
+			}
+			ByLastUse.Sort([](const TPair<uint64, TWeakObjectPtr<UTexture2D>>& A, const TPair<uint64, TWeakObjectPtr<UTexture2D>>& B) { return A.Key < B.Key; });
+
+			for (const TPair<uint64, TWeakObjectPtr<UTexture2D>>& Entry : ByLastUse)
+			{
+				// Textures that have been garbage collected are dropped regardless of the budget
+				if (Entry.Value.IsValid() && ResidentTextureBytes <= BudgetBytes)
+				{
+					continue;
+				}
+
+				ReleaseResidentTexture(Entry.Value);
+			}
+		}
+
+		UpdateResidentStats();
+	}
+
+private:
+	struct FRequester
+	{
+		TWeakObjectPtr<URHAsyncImage> Image;
+		TFunction<void(UObject*)> OnLoaded;
+	};
+
+	struct FPendingLoad
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<FRequester> Requesters;
+	};
+
+	struct FResidentTexture
+	{
+		int64 SizeBytes = 0;
+		uint64 LastUseSerial = 0;
+		// Number of images currently displaying the texture
+		int32 NumRefs = 0;
+	};
+
+	void HandleLoadComplete(FSoftObjectPath SoftPath)
+	{
+		FPendingLoad PendingLoad;
+		if (!PendingLoads.RemoveAndCopyValue(SoftPath, PendingLoad))
+		{
+			return;
+		}
+
+		UObject* LoadedObject = SoftPath.ResolveObject();
+		for (const FRequester& Requester : PendingLoad.Requesters)
+		{
+			// Only images still waiting on this path, anything since superseded has already removed itself
+			URHAsyncImage* Image = Requester.Image.Get();
+			if (Image != nullptr && Image->SharedLoadPath == SoftPath)
+			{
+				Image->CompleteSharedAsyncLoad(LoadedObject, Requester.OnLoaded);
+			}
+		}
+
+		UpdateRequestStats();
+	}
+
+	void ReleaseResidentTexture(const TWeakObjectPtr<UTexture2D>& WeakTexture)
+	{
+		FResidentTexture ResidentTexture;
+		if (!ResidentTextures.RemoveAndCopyValue(WeakTexture, ResidentTexture))
+		{
+			return;
+		}
+
+		ResidentTextureBytes -= ResidentTexture.SizeBytes;
+
+		if (UTexture2D* Texture = WeakTexture.Get())
+		{
+			// The texture stays loaded while referenced, the streamer is just free to drop its mips again
+			Texture->bForceMiplevelsToBeResident = false;
+			Texture->bIgnoreStreamingMipBias = false;
+			++NumReleasedTextures;
+		}
+	}
+
+	int32 GetNumWaitingImages() const
+	{
+		int32 NumWaitingImages = 0;
+		for (const TPair<FSoftObjectPath, FPendingLoad>& Pair : PendingLoads)
+		{
+			NumWaitingImages += Pair.Value.Requesters.Num();
+		}
+		return NumWaitingImages;
+	}
+
+	void UpdateRequestStats() const
+	{
+		SET_DWORD_STAT(STAT_RHAsyncImage_PendingLoads, PendingLoads.Num());
+		SET_DWORD_STAT(STAT_RHAsyncImage_WaitingImages, GetNumWaitingImages());
+		SET_DWORD_STAT(STAT_RHAsyncImage_DeduplicatedRequests, NumDeduplicatedRequests);
+		SET_DWORD_STAT(STAT_RHAsyncImage_CanceledLoads, NumCanceledLoads);
+	}
+
+	void UpdateResidentStats() const
+	{
+		SET_DWORD_STAT(STAT_RHAsyncImage_ResidentTextures, ResidentTextures.Num());
+		SET_DWORD_STAT(STAT_RHAsyncImage_ReleasedTextures, NumReleasedTextures);
+		SET_MEMORY_STAT(STAT_RHAsyncImage_ResidentMemory, ResidentTextureBytes);
+		SET_MEMORY_STAT(STAT_RHAsyncImage_ResidentBudget, (int64)GAsyncImageResidentTextureBudgetMB * 1024 * 1024);
+	}
+
+	TMap<FSoftObjectPath, FPendingLoad> PendingLoads;
+	TMap<TWeakObjectPtr<UTexture2D>, FResidentTexture> ResidentTextures;
+
+	int64 ResidentTextureBytes = 0;
+	uint64 UseSerial = 0;
+	int32 NumDeduplicatedRequests = 0;
+	int32 NumCanceledLoads = 0;
+	int32 NumReleasedTextures = 0;
+};
+
+static FAutoConsoleVariableRef CVarAsyncImageResidentTextureBudgetMB(
+	TEXT("rh.AsyncImage.ResidentTextureBudgetMB"),
+	GAsyncImageResidentTextureBudgetMB,
+	TEXT("Memory budget in MB for the UI textures URHAsyncImage forces fully resident. Once over budget the least recently displayed textures no image is showing are handed back to the texture streamer. 0 disables the budget."),
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* InConsoleVariable)
+	{
+		FRHAsyncImageRequestBroker::Get().EnforceResidentBudget();
+	}),
+	ECVF_Default
+);
+
 const FName URHAsyncImage::DefaultTextureParameterName("Texture");
 
 URHAsyncImage::URHAsyncImage(const FObjectInitializer& ObjectInitializer)
@@ -57,24 +337,23 @@ void URHAsyncImage::SetWaitingWidget(UWidget* InWaitingWidget)
 void URHAsyncImage::SetBrushFromSoftPath(const FSoftObjectPath& SoftPath, bool bMatchSize)
 {
 	TWeakObjectPtr<UImage> WeakThis(this); // using weak ptr in case 'this' has gone out of scope by the time this lambda is called
-	TSoftObjectPtr<UObject> SoftObject(SoftPath);
 
-	RequestAsyncLoad(SoftObject,
-		[WeakThis, SoftObject, bMatchSize]() {
+	RequestSharedAsyncLoad(SoftPath,
+		[WeakThis, SoftPath, bMatchSize](UObject* StrongObject) {
 			if (UImage* StrongThis = WeakThis.Get())
 			{
-				ensureMsgf(SoftObject.Get(), TEXT("Failed to load %s"), *SoftObject.ToSoftObjectPath().ToString());
-				if (UTexture2D* AsTexture = Cast<UTexture2D>(SoftObject.Get()))
+				ensureMsgf(StrongObject, TEXT("Failed to load %s"), *SoftPath.ToString());
+				if (UTexture2D* AsTexture = Cast<UTexture2D>(StrongObject))
 				{
 					StrongThis->SetBrushFromTexture(AsTexture, bMatchSize);
 				}
-				else if (UMaterialInterface* AsMaterialInterface = Cast<UMaterialInterface>(SoftObject.Get()))
+				else if (UMaterialInterface* AsMaterialInterface = Cast<UMaterialInterface>(StrongObject))
 				{
 					StrongThis->SetBrushFromMaterial(AsMaterialInterface);
 				}
 				else
 				{
-					ensureMsgf(false, TEXT("Object %s is not a valid object type. Must be Texture2D or MaterialInterface."), *GetNameSafe(SoftObject.Get()));
+					ensureMsgf(false, TEXT("Object %s is not a valid object type. Must be Texture2D or MaterialInterface."), *GetNameSafe(StrongObject));
 					StrongThis->SetBrushFromTexture(nullptr, bMatchSize);
 				}
 
@@ -100,11 +379,8 @@ void URHAsyncImage::InternalSetBrushFromItemTexture(UTexture2D* StrongTexture, b
 		///////////////////////////////////////////////////////////////////////////////////////////////////////
 		// This section is copied from "void UImage::SetBrushFromTexture(UTexture2D* Texture, bool bMatchSize)"
 		///////////////////////////////////////////////////////////////////////////////////////////////////////
-		if (StrongTexture) // Since this texture is used as UI, don't allow it affected by budget.
-		{
-			StrongTexture->bForceMiplevelsToBeResident = true;
-			StrongTexture->bIgnoreStreamingMipBias = true;
-		}
+		// Since this texture is used as UI, don't allow it affected by the streaming budget, the broker keeps UI textures under their own budget instead.
+		SetDisplayedTexture(StrongTexture);
 
 		if (bMatchSize)
 		{
@@ -139,6 +415,7 @@ void URHAsyncImage::InternalSetBrushFromItemTexture(UTexture2D* StrongTexture, b
 #endif
 			}
 
+			RefreshDisplayedTexture();
 			HideWaitingWidget();
 			OnAsyncImageBrushChanged.Broadcast(this);
 		}
@@ -231,6 +508,7 @@ void URHAsyncImage::SetBrushFromItemIcon(const UPlatformInventoryItem* Item, boo
 #endif
 		}
 
+		RefreshDisplayedTexture();
 		HideWaitingWidget();
 		OnAsyncImageBrushChanged.Broadcast(this);
     }
@@ -243,13 +521,14 @@ void URHAsyncImage::SetBrushFromItemIcon(const UPlatformInventoryItem* Item, boo
 void URHAsyncImage::SetBrushFromTextureOnItem(const UPlatformInventoryItem* Item, TSoftObjectPtr<UTexture2D> Texture, bool bMatchSize/* = false*/)
 {
 	TWeakObjectPtr<URHAsyncImage> WeakThis(this); // using weak ptr in case 'this' has gone out of scope by the time this lambda is called
+	const FSoftObjectPath TexturePath = Texture.ToSoftObjectPath();
 
-	RequestAsyncLoad(Texture,
-		[WeakThis, Texture, bMatchSize]() {
+	RequestSharedAsyncLoad(TexturePath,
+		[WeakThis, TexturePath, bMatchSize](UObject* StrongObject) {
 			if (URHAsyncImage* StrongThis = WeakThis.Get())
 			{
-				UTexture2D* StrongTexture = Texture.Get();
-				ensureMsgf(StrongTexture, TEXT("Failed to load %s"), *Texture.ToSoftObjectPath().ToString());
+				UTexture2D* StrongTexture = Cast<UTexture2D>(StrongObject);
+				ensureMsgf(StrongTexture, TEXT("Failed to load %s"), *TexturePath.ToString());
 				StrongThis->InternalSetBrushFromItemTexture(StrongTexture, bMatchSize);
 			}
 		});
@@ -258,27 +537,147 @@ void URHAsyncImage::SetBrushFromTextureOnItem(const UPlatformInventoryItem* Item
 void URHAsyncImage::SetBrushFromPathOnItem(const UPlatformInventoryItem* Item, const FSoftObjectPath& Path, bool bMatchSize /*= false*/)
 {
 	TWeakObjectPtr<URHAsyncImage> WeakThis(this); // using weak ptr in case 'this' has gone out of scope by the time this lambda is called
-	TSoftObjectPtr<UObject> SoftObject(Path);
 
-	RequestAsyncLoad(SoftObject,
-		[WeakThis, SoftObject, bMatchSize]() {
+	RequestSharedAsyncLoad(Path,
+		[WeakThis, Path, bMatchSize](UObject* StrongObject) {
 		if (URHAsyncImage* StrongThis = WeakThis.Get())
 		{
-			UObject* StrongObject = SoftObject.Get();
-			ensureMsgf(StrongObject, TEXT("Failed to load %s"), *SoftObject.ToSoftObjectPath().ToString());
-			if(UTexture2D* StrongTexture = Cast<UTexture2D>(StrongObject))
-			{
-				StrongThis->InternalSetBrushFromItemTexture(StrongTexture, bMatchSize);
-			}
-			else if (UMaterialInterface* StrongMI = Cast<UMaterialInterface>(StrongObject))
-			{
-				StrongThis->SetBrushFromMaterial(StrongMI);
-			}
-			else
-			{
-				ensureMsgf(false, TEXT("Object %s is not a valid object type. Must be Texture2D or MaterialInterface."), *GetNameSafe(StrongObject));
-				StrongThis->InternalSetBrushFromItemTexture(nullptr, bMatchSize);
-			}
+			ensureMsgf(StrongObject, TEXT("Failed to load %s"), *Path.ToString());
+			StrongThis->InternalSetBrushFromItemObject(StrongObject, bMatchSize);
 		}
 	});
-}
\ No newline at end of file
+}
+
+void URHAsyncImage::InternalSetBrushFromItemObject(UObject* StrongObject, bool bMatchSize)
+{
+	if (UTexture2D* StrongTexture = Cast<UTexture2D>(StrongObject))
+	{
+		InternalSetBrushFromItemTexture(StrongTexture, bMatchSize);
+	}
+	else if (UMaterialInterface* StrongMI = Cast<UMaterialInterface>(StrongObject))
+	{
+		SetBrushFromMaterial(StrongMI);
+	}
+	else
+	{
+		ensureMsgf(false, TEXT("Object %s is not a valid object type. Must be Texture2D or MaterialInterface."), *GetNameSafe(StrongObject));
+		InternalSetBrushFromItemTexture(nullptr, bMatchSize);
+	}
+}
+
+void URHAsyncImage::SetBrushFromTexture(UTexture2D* Texture, bool bMatchSize)
+{
+	// UImage forces UI textures resident, track it first so the broker knows the texture wasn't resident by its own settings
+	SetDisplayedTexture(Texture);
+
+	Super::SetBrushFromTexture(Texture, bMatchSize);
+	HideWaitingWidget();
+	OnAsyncImageBrushChanged.Broadcast(this);
+}
+
+void URHAsyncImage::SetDisplayedTexture(UTexture2D* Texture)
+{
+	if (Texture == DisplayedTexture.Get())
+	{
+		return;
+	}
+
+	FRHAsyncImageRequestBroker& Broker = FRHAsyncImageRequestBroker::Get();
+
+	// Take the new reference first, so going back to a texture another image let go of doesn't release it on the way
+	Broker.AddTextureRef(Texture);
+	Broker.RemoveTextureRef(DisplayedTexture, true);
+	DisplayedTexture = Texture;
+}
+
+void URHAsyncImage::RefreshDisplayedTexture()
+{
+	UObject* ResourceObject = GetBrush().GetResourceObject();
+	UTexture2D* Texture = Cast<UTexture2D>(ResourceObject);
+
+	// Textures applied through the filter material are displayed just the same
+	if (Texture == nullptr && ResourceObject != nullptr && ResourceObject == MaterialToUse)
+	{
+		UTexture* MaterialTexture = nullptr;
+		MaterialToUse->GetTextureParameterValue(MaterialParameter, MaterialTexture, true);
+		Texture = Cast<UTexture2D>(MaterialTexture);
+	}
+
+	SetDisplayedTexture(Texture);
+}
+
+void URHAsyncImage::RequestSharedAsyncLoad(const FSoftObjectPath& SoftPath, TFunction<void(UObject*)>&& OnLoaded)
+{
+	CancelImageStreaming();
+
+	if (UObject* StrongObject = SoftPath.ResolveObject())
+	{
+		// No streaming needed, complete immediately
+		OnLoaded(StrongObject);
+		return;
+	}
+
+	OnImageStreamingStarted(TSoftObjectPtr<UObject>(SoftPath));
+
+	SharedLoadPath = SoftPath;
+	StreamingObjectPath = SoftPath;
+
+	TSharedPtr<FStreamableHandle> Handle = FRHAsyncImageRequestBroker::Get().AddRequest(this, SoftPath, MoveTemp(OnLoaded));
+
+	// The load may have completed synchronously, in which case this image is no longer waiting on it
+	if (SharedLoadPath == SoftPath)
+	{
+		StreamingHandle = Handle;
+	}
+}
+
+void URHAsyncImage::CompleteSharedAsyncLoad(UObject* LoadedObject, const TFunction<void(UObject*)>& OnLoaded)
+{
+	const FSoftObjectPath LoadedPath = SharedLoadPath;
+
+	// Clear the waiting state first so setting the brush doesn't treat the finished load as canceled
+	SharedLoadPath.Reset();
+	StreamingHandle.Reset();
+	StreamingObjectPath.Reset();
+
+	OnLoaded(LoadedObject);
+	OnImageStreamingComplete(TSoftObjectPtr<UObject>(LoadedPath));
+}
+
+void URHAsyncImage::CancelImageStreaming()
+{
+	if (!SharedLoadPath.IsNull())
+	{
+		// The handle is shared with other images, only let go of this image's interest in it
+		const FSoftObjectPath CanceledPath = SharedLoadPath;
+		SharedLoadPath.Reset();
+		StreamingHandle.Reset();
+		StreamingObjectPath.Reset();
+
+		FRHAsyncImageRequestBroker::Get().RemoveRequest(this, CanceledPath);
+
+		OnAsyncImageLoadCanceled.Broadcast(this);
+		HideWaitingWidget();
+	}
+	else if (StreamingHandle.IsValid())
+	{
+		Super::CancelImageStreaming();
+		OnAsyncImageLoadCanceled.Broadcast(this);
+		HideWaitingWidget();
+	}
+}
+
+void URHAsyncImage::BeginDestroy()
+{
+	if (!SharedLoadPath.IsNull())
+	{
+		FRHAsyncImageRequestBroker::Get().RemoveRequest(this, SharedLoadPath);
+		SharedLoadPath.Reset();
+	}
+
+	// No budget enforcement while garbage collecting, the next texture displayed catches up on it
+	FRHAsyncImageRequestBroker::Get().RemoveTextureRef(DisplayedTexture, false);
+	DisplayedTexture.Reset();
+
+	Super::BeginDestroy();
+}
@@ -14,11 +14,34 @@
 #include "RH_GameInstanceSubsystem.h"
 #include "RH_MatchmakingBrowser.h"
 
+namespace
+{
+	// Fixed mapping of known regions - uses translated region names instead of non translated off the region data from API
+	const TMap<FString, FText>& GetReferenceRegionNames()
+	{
+		static const TMap<FString, FText> ReferenceRegionsAndNames =
+		{
+			{ TEXT("1"), NSLOCTEXT("RHRegionSelect", "NorthAmerica", "N. America - East") },
+			{ TEXT("9"), NSLOCTEXT("RHRegionSelect", "NorthAmericaWest", "N. America - West") },
+			{ TEXT("2"), NSLOCTEXT("RHRegionSelect", "Europe", "Europe") },
+			{ TEXT("8"), NSLOCTEXT("RHRegionSelect", "Russia", "Russia") },
+			{ TEXT("4"), NSLOCTEXT("RHRegionSelect", "Brazil", "Brazil") },
+			{ TEXT("5"), NSLOCTEXT("RHRegionSelect", "LatinAmericaNorth", "Latin Amer North") },
+			{ TEXT("6"), NSLOCTEXT("RHRegionSelect", "LatinAmericaSouth", "Latin Amer South") },
+			{ TEXT("10"), NSLOCTEXT("RHRegionSelect", "Japan", "Asia") },
+			{ TEXT("7"), NSLOCTEXT("RHRegionSelect", "SoutheastAsia", "SE Asia") },
+			{ TEXT("3"), NSLOCTEXT("RHRegionSelect", "Oceania", "Oceania") },
+		};
+		return ReferenceRegionsAndNames;
+	}
+}
+
 ARHHUDCommon::ARHHUDCommon(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , LoginDataFactory(nullptr)
     , SettingsFactory(nullptr)
     , PartyManager(nullptr)
+	, bRegionCacheDirty(true)
 	, HasHUDBeenDrawn(false)
 {
     InputManagerClass = URHInputManager::StaticClass();
@@ -44,6 +67,11 @@ void ARHHUDCommon::BeginPlay()
 
 	CreateInputManager();
 
+	if (URHGameInstance* pGameInstance = Cast<URHGameInstance>(GetGameInstance()))
+	{
+		pGameInstance->OnLocalPlayerLoginChanged.AddUObject(this, &ARHHUDCommon::OnLocalPlayerLoginChanged);
+	}
+
 	Super::BeginPlay();
 
 	float OutFloat;
@@ -128,6 +156,13 @@ void ARHHUDCommon::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		}
 	}
 
+	if (URHGameInstance* pGameInstance = Cast<URHGameInstance>(GetGameInstance()))
+	{
+		pGameInstance->OnLocalPlayerLoginChanged.RemoveAll(this);
+	}
+
+	InvalidateLocalPlayerIdentity();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -227,6 +262,9 @@ bool ARHHUDCommon::ShouldShowCrossplayIconForPlayerState(ARHPlayerState* PlayerS
 
 void ARHHUDCommon::OnRegionsUpdated(URH_MatchmakingBrowserCache* MatchingBrowserCache)
 {
+	bRegionCacheDirty = true;
+	RebuildRegionCache();
+
 	OnPreferredRegionUpdated.Broadcast();
 }
 
@@ -252,58 +290,143 @@ void ARHHUDCommon::SetPreferredRegionId(const FString& RegionId)
 
 void ARHHUDCommon::GetRegionList(TMap<FString, FText>& OutRegionIdToNameMap) const
 {
-	// Fixed mapping of known regions here - uses translated region names instead of non translated off the region data from API
-	TMap<FString, FText> ReferenceRegionsAndNames;
-	ReferenceRegionsAndNames.Emplace(TEXT("1"), NSLOCTEXT("RHRegionSelect", "NorthAmerica", "N. America - East"));
-	ReferenceRegionsAndNames.Emplace(TEXT("9"), NSLOCTEXT("RHRegionSelect", "NorthAmericaWest", "N. America - West"));
-	ReferenceRegionsAndNames.Emplace(TEXT("2"), NSLOCTEXT("RHRegionSelect", "Europe", "Europe"));
-	ReferenceRegionsAndNames.Emplace(TEXT("8"), NSLOCTEXT("RHRegionSelect", "Russia", "Russia"));
-	ReferenceRegionsAndNames.Emplace(TEXT("4"), NSLOCTEXT("RHRegionSelect", "Brazil", "Brazil"));
-	ReferenceRegionsAndNames.Emplace(TEXT("5"), NSLOCTEXT("RHRegionSelect", "LatinAmericaNorth", "Latin Amer North"));
-	ReferenceRegionsAndNames.Emplace(TEXT("6"), NSLOCTEXT("RHRegionSelect", "LatinAmericaSouth", "Latin Amer South"));
-	ReferenceRegionsAndNames.Emplace(TEXT("10"), NSLOCTEXT("RHRegionSelect", "Japan", "Asia"));
-	ReferenceRegionsAndNames.Emplace(TEXT("7"), NSLOCTEXT("RHRegionSelect", "SoutheastAsia", "SE Asia"));
-	ReferenceRegionsAndNames.Emplace(TEXT("3"), NSLOCTEXT("RHRegionSelect", "Oceania", "Oceania"));
+	RebuildRegionCache();
+
+	if (CachedRegionIdToNameMap.Num() > 0)
+	{
+		OutRegionIdToNameMap = CachedRegionIdToNameMap;
+	}
+}
+
+const TArray<FRHRegionInfo>& ARHHUDCommon::GetSortedRegions() const
+{
+	RebuildRegionCache();
+	return CachedRegions;
+}
+
+void ARHHUDCommon::GetRegionsSortedByPing(TArray<FRHRegionInfo>& OutRegions) const
+{
+	RebuildRegionCache();
 
+	OutRegions = CachedRegions;
+
+	// Stable so regions with equal or unknown ping keep their configured order
+	OutRegions.StableSort([](const FRHRegionInfo& A, const FRHRegionInfo& B) -> bool
+	{
+		if (A.PingMs == INDEX_NONE || B.PingMs == INDEX_NONE)
+		{
+			return A.PingMs != INDEX_NONE && B.PingMs == INDEX_NONE;
+		}
+		return A.PingMs < B.PingMs;
+	});
+}
+
+bool ARHHUDCommon::GetRegionInfo(const FString& RegionId, FRHRegionInfo& OutRegionInfo) const
+{
+	if (const FRHRegionInfo* pRegionInfo = FindCachedRegion(RegionId))
+	{
+		OutRegionInfo = *pRegionInfo;
+		return true;
+	}
+	return false;
+}
+
+bool ARHHUDCommon::GetRegionName(const FString& RegionId, FText& OutRegionName) const
+{
+	if (const FRHRegionInfo* pRegionInfo = FindCachedRegion(RegionId))
+	{
+		OutRegionName = pRegionInfo->Name;
+		return true;
+	}
+	return false;
+}
+
+void ARHHUDCommon::SetRegionPing(const FString& RegionId, int32 PingMs)
+{
+	RegionPingsById.Add(RegionId, PingMs);
+
+	// Patch the cached entry in place, a pending rebuild will pick the ping up on its own
+	if (!bRegionCacheDirty)
+	{
+		if (const int32* pIndex = CachedRegionIndexById.Find(RegionId))
+		{
+			CachedRegions[*pIndex].PingMs = PingMs;
+		}
+	}
+}
+
+const FRHRegionInfo* ARHHUDCommon::FindCachedRegion(const FString& RegionId) const
+{
+	RebuildRegionCache();
+
+	if (const int32* pIndex = CachedRegionIndexById.Find(RegionId))
+	{
+		return &CachedRegions[*pIndex];
+	}
+	return nullptr;
+}
+
+void ARHHUDCommon::RebuildRegionCache() const
+{
+	if (!bRegionCacheDirty)
+	{
+		return;
+	}
+
+	URH_MatchmakingBrowserCache* pMMCache = nullptr;
 	if (UGameInstance* pGameInstance = GetGameInstance())
 	{
 		if (URH_GameInstanceSubsystem* pGISS = pGameInstance->GetSubsystem<URH_GameInstanceSubsystem>())
 		{
-			if (URH_MatchmakingBrowserCache* pMMCache = pGISS->GetMatchmakingCache())
-			{
-				auto& Regions = pMMCache->GetAllRegions();
-
-				TArray<FRHAPI_SiteSettings> RegionList;
-				RegionList.Append(Regions);
-
-				RegionList.Sort([](const FRHAPI_SiteSettings& A, const FRHAPI_SiteSettings& B) -> bool
-				{
-					return A.GetSortOrder() < B.GetSortOrder();
-				});
-
-				if (RegionList.Num() > 0)
-				{
-					// prepare for return
-					OutRegionIdToNameMap.Empty();
-					OutRegionIdToNameMap.Reserve(RegionList.Num());
-
-					for (const auto& Region : RegionList)
-					{
-						const FString RegionId = FString::Printf(TEXT("%d"), Region.SiteId);
-						FString RegionName;
-						if (ReferenceRegionsAndNames.Contains(RegionId))
-						{
-							OutRegionIdToNameMap.Add(RegionId, ReferenceRegionsAndNames[RegionId]);
-						}
-						else
-						{
-							OutRegionIdToNameMap.Add(RegionId, FText::FromString(RegionId));
-						}
-					}
-				}
-			}
+			pMMCache = pGISS->GetMatchmakingCache();
 		}
 	}
+
+	// Stay dirty until the cache is reachable so the first call after it comes up still builds the list
+	if (pMMCache == nullptr)
+	{
+		return;
+	}
+
+	bRegionCacheDirty = false;
+
+	const TMap<FString, FText>& ReferenceRegionsAndNames = GetReferenceRegionNames();
+	const auto& Regions = pMMCache->GetAllRegions();
+
+	CachedRegions.Reset(Regions.Num());
+	for (const FRHAPI_SiteSettings& Region : Regions)
+	{
+		FRHRegionInfo& RegionInfo = CachedRegions.AddDefaulted_GetRef();
+		RegionInfo.RegionId = FString::Printf(TEXT("%d"), Region.SiteId);
+		RegionInfo.SortOrder = Region.GetSortOrder();
+
+		if (const FText* pReferenceName = ReferenceRegionsAndNames.Find(RegionInfo.RegionId))
+		{
+			RegionInfo.Name = *pReferenceName;
+		}
+		else
+		{
+			RegionInfo.Name = FText::FromString(RegionInfo.RegionId);
+		}
+
+		if (const int32* pPingMs = RegionPingsById.Find(RegionInfo.RegionId))
+		{
+			RegionInfo.PingMs = *pPingMs;
+		}
+	}
+
+	CachedRegions.Sort([](const FRHRegionInfo& A, const FRHRegionInfo& B) -> bool
+	{
+		return A.SortOrder < B.SortOrder;
+	});
+
+	CachedRegionIndexById.Empty(CachedRegions.Num());
+	CachedRegionIdToNameMap.Empty(CachedRegions.Num());
+	for (int32 i = 0; i < CachedRegions.Num(); ++i)
+	{
+		CachedRegionIndexById.Add(CachedRegions[i].RegionId, i);
+		CachedRegionIdToNameMap.Add(CachedRegions[i].RegionId, CachedRegions[i].Name);
+	}
 }
 
 void ARHHUDCommon::OnQuit()
@@ -418,6 +541,7 @@ void ARHHUDCommon::ShowErrorPopup(FText ErrorMsg)
         popupParams.Header = NSLOCTEXT("General", "Error", "Error");
         popupParams.Description = ErrorMsg;
         popupParams.IsImportant = true;
+        popupParams.CanBeCoalesced = true;
         popupParams.CancelAction.AddDynamic(popup, &URHPopupManager::OnPopupCanceled);
 
         FRHPopupButtonConfig& cancelBtn = (popupParams.Buttons[popupParams.Buttons.Add(FRHPopupButtonConfig())]);
@@ -633,6 +757,7 @@ void ARHHUDCommon::DisplayGenericPopup(const FString& sTitle, const FString& sDe
 		FRHPopupConfig popupData;
 		popupData.Header = FText::FromString(sTitle);
 		popupData.Description = FText::FromString(sDesc);
+		popupData.CanBeCoalesced = true;
 		popupData.CancelAction.AddDynamic(popupManager, &URHPopupManager::OnPopupCanceled);
 
 		popupData.Buttons.AddDefaulted();
@@ -722,18 +847,48 @@ FUniqueNetIdWrapper ARHHUDCommon::GetOSSUniqueId() const
 
 URH_LocalPlayerSubsystem* ARHHUDCommon::GetLocalPlayerSubsystem() const
 {
+	return GetLocalPlayerIdentity().LocalPlayerSubsystem.Get();
+}
+
+const FRHHUDLocalPlayerIdentity& ARHHUDCommon::GetLocalPlayerIdentity() const
+{
+	if (LocalPlayerIdentity.bIsValid && LocalPlayerIdentity.LocalPlayerSubsystem.IsValid())
+	{
+		return LocalPlayerIdentity;
+	}
+
+	LocalPlayerIdentity = FRHHUDLocalPlayerIdentity();
+
 	auto* PC = GetOwningPlayerController();
-	if (PC != nullptr)
+	auto* LP = PC != nullptr ? PC->GetLocalPlayer() : nullptr;
+	auto* RHLP = LP != nullptr ? LP->GetSubsystem<URH_LocalPlayerSubsystem>() : nullptr;
+
+	// Leave the identity unresolved so it is retried once the local player is available
+	if (RHLP != nullptr)
 	{
-		auto* LP = PC->GetLocalPlayer();
-		if (LP != nullptr)
-		{
-			auto* RHLP = LP->GetSubsystem<URH_LocalPlayerSubsystem>();
-			return RHLP;
-		}
+		LocalPlayerIdentity.LocalPlayerSubsystem = RHLP;
+		LocalPlayerIdentity.PlayerInfoSubsystem = RHLP->GetPlayerInfoSubsystem();
+		LocalPlayerIdentity.LocalPlayerInfo = RHLP->GetLocalPlayerInfo();
+		LocalPlayerIdentity.PlayerUuid = RHLP->GetPlayerUuid();
+		LocalPlayerIdentity.PlayerPlatformId = RHLP->GetPlayerPlatformId();
+		LocalPlayerIdentity.bIsValid = true;
 	}
 
-	return nullptr;
+	return LocalPlayerIdentity;
+}
+
+void ARHHUDCommon::InvalidateLocalPlayerIdentity()
+{
+	LocalPlayerIdentity = FRHHUDLocalPlayerIdentity();
+}
+
+void ARHHUDCommon::OnLocalPlayerLoginChanged(ULocalPlayer* LocalPlayer)
+{
+	const APlayerController* PC = GetOwningPlayerController();
+	if (PC == nullptr || LocalPlayer == nullptr || PC->GetLocalPlayer() == LocalPlayer)
+	{
+		InvalidateLocalPlayerIdentity();
+	}
 }
 
 URH_GameInstanceSubsystem* ARHHUDCommon::GetGameInstanceSubsystem() const
@@ -752,12 +907,7 @@ URH_GameInstanceSubsystem* ARHHUDCommon::GetGameInstanceSubsystem() const
 
 URH_PlayerInfoSubsystem* ARHHUDCommon::GetPlayerInfoSubsystem() const
 {
-	auto* RHLP = GetLocalPlayerSubsystem();
-	if (RHLP != nullptr)
-	{
-		return RHLP->GetPlayerInfoSubsystem();
-	}
-	return nullptr;
+	return GetLocalPlayerIdentity().PlayerInfoSubsystem.Get();
 }
 
 URH_PlayerInfo* ARHHUDCommon::GetOrCreatePlayerInfo(const FGuid& PlayerUuid)
@@ -830,34 +980,24 @@ URH_PlayerPlatformInfo* ARHHUDCommon::GetPlayerPlatformInfo(const FRH_PlayerPlat
 
 URH_PlayerInfo* ARHHUDCommon::GetLocalPlayerInfo()
 {
-	auto* pLocalPlayerSubsystem = GetLocalPlayerSubsystem();
-	if (!pLocalPlayerSubsystem)
+	const FRHHUDLocalPlayerIdentity& Identity = GetLocalPlayerIdentity();
+	if (!Identity.LocalPlayerInfo.IsValid() && Identity.LocalPlayerSubsystem.IsValid())
 	{
-		return nullptr;
+		// The player info may not exist yet when the identity is first resolved
+		LocalPlayerIdentity.LocalPlayerInfo = Identity.LocalPlayerSubsystem->GetLocalPlayerInfo();
 	}
 
-	return pLocalPlayerSubsystem->GetLocalPlayerInfo();
+	return LocalPlayerIdentity.LocalPlayerInfo.Get();
 }
 
 FGuid ARHHUDCommon::GetLocalPlayerUuid()
 {
-	auto* pLocalPlayerSubsystem = GetLocalPlayerSubsystem();
-	if (!pLocalPlayerSubsystem)
-	{
-		return FGuid();
-	}
-
-	return pLocalPlayerSubsystem->GetPlayerUuid();
+	return GetLocalPlayerIdentity().PlayerUuid;
 }
 
 FRH_PlayerPlatformId ARHHUDCommon::GetLocalPlayerPlatformId()
 {
-	auto* pLocalPlayerSubsystem = GetLocalPlayerSubsystem();
-	if (!pLocalPlayerSubsystem)
-	{
-		return FRH_PlayerPlatformId();
-	}
-	return pLocalPlayerSubsystem->GetPlayerPlatformId();
+	return GetLocalPlayerIdentity().PlayerPlatformId;
 }
 
 bool ARHHUDCommon::IsCrossplayEnabled() const
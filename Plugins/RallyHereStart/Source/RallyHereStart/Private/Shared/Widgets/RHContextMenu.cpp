@@ -92,6 +92,49 @@ void URHContextMenu::InitializeWidget_Implementation()
 	{
 		QueueDataFactory->OnQueueStatusChange.AddDynamic(this, &URHContextMenu::HandleOnQueueStatusChange);
 	}
+
+	// Anything that can change the target's relationship to us invalidates the cached state
+	if (URH_FriendSubsystem* FriendSubsystem = GetRHFriendSubsystem())
+	{
+		FriendSubsystem->FriendUpdatedDelegate.AddUObject(this, &URHContextMenu::HandleFriendUpdated);
+		FriendSubsystem->FriendListUpdatedDelegate.AddUObject(this, &URHContextMenu::HandleFriendListUpdated);
+		FriendSubsystem->BlockedPlayerUpdatedDelegate.AddUObject(this, &URHContextMenu::HandleBlockedPlayerUpdated);
+	}
+
+	if (URHPartyManager* PartyManager = GetPartyManager())
+	{
+		PartyManager->OnPartyDataUpdated.AddDynamic(this, &URHContextMenu::HandlePartyUpdated);
+		PartyManager->OnPartyDisbanded.AddDynamic(this, &URHContextMenu::HandlePartyUpdated);
+		PartyManager->OnPartyLocalPlayerLeft.AddDynamic(this, &URHContextMenu::HandlePartyUpdated);
+		PartyManager->OnPartyMemberStatusChanged.AddDynamic(this, &URHContextMenu::HandlePartyMemberStatusChanged);
+		PartyManager->OnPartyInvitationReceived.AddDynamic(this, &URHContextMenu::HandlePartyInvitationReceived);
+	}
+}
+
+void URHContextMenu::UninitializeWidget_Implementation()
+{
+	Super::UninitializeWidget_Implementation();
+
+	if (!MyHud.IsValid())
+	{
+		return;
+	}
+
+	if (URH_FriendSubsystem* FriendSubsystem = GetRHFriendSubsystem())
+	{
+		FriendSubsystem->FriendUpdatedDelegate.RemoveAll(this);
+		FriendSubsystem->FriendListUpdatedDelegate.RemoveAll(this);
+		FriendSubsystem->BlockedPlayerUpdatedDelegate.RemoveAll(this);
+	}
+
+	if (URHPartyManager* PartyManager = GetPartyManager())
+	{
+		PartyManager->OnPartyDataUpdated.RemoveAll(this);
+		PartyManager->OnPartyDisbanded.RemoveAll(this);
+		PartyManager->OnPartyLocalPlayerLeft.RemoveAll(this);
+		PartyManager->OnPartyMemberStatusChanged.RemoveAll(this);
+		PartyManager->OnPartyInvitationReceived.RemoveAll(this);
+	}
 }
 
 void URHContextMenu::HandleOnQueueStatusChange(ERH_MatchStatus QueueStatus)
@@ -99,11 +142,131 @@ void URHContextMenu::HandleOnQueueStatusChange(ERH_MatchStatus QueueStatus)
 	SetOptionsActive();
 }
 
+void URHContextMenu::HandleFriendUpdated(URH_RHFriendAndPlatformFriend* UpdatedFriend)
+{
+	if (UpdatedFriend != nullptr && UpdatedFriend == CurrentFriend)
+	{
+		InvalidateTargetState();
+	}
+}
+
+void URHContextMenu::HandleFriendListUpdated(const TArray<URH_RHFriendAndPlatformFriend*>& UpdatedFriends)
+{
+	if (CurrentFriend != nullptr && UpdatedFriends.Contains(CurrentFriend))
+	{
+		InvalidateTargetState();
+	}
+}
+
+void URHContextMenu::HandleBlockedPlayerUpdated(const FGuid& PlayerUuid, bool bBlocked)
+{
+	if (CurrentFriend != nullptr && CurrentFriend->GetRHPlayerUuid() == PlayerUuid)
+	{
+		InvalidateTargetState();
+	}
+}
+
+void URHContextMenu::HandlePartyUpdated()
+{
+	InvalidateTargetState();
+}
+
+void URHContextMenu::HandlePartyMemberStatusChanged(const FGuid& PlayerId)
+{
+	InvalidateTargetState();
+}
+
+void URHContextMenu::HandlePartyInvitationReceived(URH_PlayerInfo* Inviter)
+{
+	InvalidateTargetState();
+}
+
+void URHContextMenu::InvalidateTargetState()
+{
+	if (TargetState.bIsValid)
+	{
+		TargetState.bIsValid = false;
+
+		// Refresh an open menu straight away, otherwise the state is resolved again the next time it is used
+		if (IsVisible() && ContextMenuButtons.Num() > 0)
+		{
+			SetOptionsVisibility();
+		}
+	}
+}
+
+const FRHContextMenuTargetState& URHContextMenu::GetTargetState()
+{
+	if (TargetState.bIsValid)
+	{
+		return TargetState;
+	}
+
+	TargetState = FRHContextMenuTargetState();
+	TargetState.bIsValid = true;
+
+	if (CurrentFriend == nullptr)
+	{
+		return TargetState;
+	}
+
+	const FGuid PlayerUuid = CurrentFriend->GetRHPlayerUuid();
+	const FGuid LocalPlayerUuid = MyHud.IsValid() ? MyHud->GetLocalPlayerUuid() : FGuid();
+
+	TargetState.bIsLocalPlayer = MyHud.IsValid() && LocalPlayerUuid == PlayerUuid;
+	TargetState.bIsCrossplayEnabled = MyHud.IsValid() && MyHud->IsPlatformCrossplayEnabled();
+
+	TargetState.bIsFriend = CurrentFriend->ArePlatformFriends();
+	TargetState.bIsRHFriend = CurrentFriend->AreRHFriends();
+	TargetState.bIsRequestingFriend = CurrentFriend->RhPendingFriendRequest();
+	TargetState.bIsPendingFriend = CurrentFriend->RHFriendRequestSent();
+
+	TargetState.bIsMuted = IsMuted();
+	TargetState.bIsInVoiceChannel = IsInVoiceChannel();
+
+	if (URH_FriendSubsystem* FriendSubsystem = GetRHFriendSubsystem())
+	{
+		TargetState.bIsIgnored = FriendSubsystem->IsPlayerBlocked(PlayerUuid);
+		TargetState.bIsBlockedByRH = FriendSubsystem->IsPlayerRhBlocked(PlayerUuid);
+		TargetState.bIsBlockedByPlatform = FriendSubsystem->IsPlayerPlatformBlocked(PlayerUuid);
+	}
+
+	URH_PlayerInfo* PlayerInfo = nullptr;
+	if (URH_PlayerInfoSubsystem* PlayerInfoSubsystem = GetRHPlayerInfoSubsystem())
+	{
+		PlayerInfo = PlayerInfoSubsystem->GetPlayerInfo(PlayerUuid);
+		if (PlayerInfo != nullptr)
+		{
+			TargetState.bIsPlayerOnline = URHUIBlueprintFunctionLibrary::GetFriendOnlineStatus(this, CurrentFriend, MyHud->GetLocalPlayerSubsystem(), false, false) == ERHPlayerOnlineStatus::FGS_Online;
+		}
+	}
+
+	if (URHPartyManager* PartyManager = GetPartyManager())
+	{
+		TargetState.bIsInParty = PartyManager->IsInParty();
+		TargetState.bIsPartyFull = TargetState.bIsInParty && PartyManager->IsPartyMaxed();
+		TargetState.bIsPartyLeader = PartyManager->IsLeader();
+		TargetState.bIsPlayerInParty = PartyManager->IsPlayerInParty(PlayerUuid);
+		TargetState.bHasPlayerInvited = PlayerInfo != nullptr && PartyManager->GetPartyInviter() == PlayerInfo;
+
+		if (MyHud.IsValid())
+		{
+			TargetState.bCanInvitePlayer = PartyManager->HasInvitePrivileges(LocalPlayerUuid);
+			TargetState.bIsPlayerPendingPartyInvite = PartyManager->GetPartyMemberByID(LocalPlayerUuid).IsPending;
+		}
+	}
+
+	return TargetState;
+}
+
 void URHContextMenu::SetCurrentFriend(class URH_RHFriendAndPlatformFriend* Friend)
 {
 	if (Friend != nullptr)
 	{
 		CurrentFriend = Friend;
+
+		// Resolve the relationship state fresh for each target the menu is opened for
+		TargetState.bIsValid = false;
 	}
 }
 
@@ -635,16 +798,17 @@ void URHContextMenu::SetOptionsVisibility()
 {
 	if (ContextMenuButtons.Num() > 0)
 	{
+		const FRHContextMenuTargetState& State = GetTargetState();
 		for (class URHContextMenuButton* const ContextMenuButton : ContextMenuButtons)
 		{
-			SetContextButtonVisibility(ContextMenuButton);
+			SetContextButtonVisibility(ContextMenuButton, State);
 		}
 
 		SetOptionsActive();
 	}
 }
 
-void URHContextMenu::SetContextButtonVisibility(class URHContextMenuButton* ContextButton)
+void URHContextMenu::SetContextButtonVisibility(class URHContextMenuButton* ContextButton, const FRHContextMenuTargetState& State)
 {
 	bool bIsVisible = false;
 	EPlayerContextOptions ContextOption = ContextButton->GetContextOption();
@@ -660,94 +824,94 @@ void URHContextMenu::SetContextButtonVisibility(class URHContextMenuButton* Cont
 		else
 		{
 			// For use in case Mute and Unmute
-			const bool bCanMuteInParty = IsPlayerInParty() && !IsPlayerPendingPartyInvite();
-			const bool bBlockedInPlatform = IsBlockedByPlatform();
+			const bool bCanMuteInParty = State.bIsPlayerInParty && !State.bIsPlayerPendingPartyInvite;
+			const bool bBlockedInPlatform = State.bIsBlockedByPlatform;
 			switch(ContextOption)
 			{
 				case EPlayerContextOptions::PartyInvite:
-					bIsVisible = CanInvitePlayer() &&
-						!IsPlayerInParty() &&
-						IsPlayerOnline() &&
-						!IsPartyFull() &&
-						!IsLocalPlayer() &&
-						!IsIgnored() && 
-						!IsBlockedByRH() &&
+					bIsVisible = State.bCanInvitePlayer &&
+						!State.bIsPlayerInParty &&
+						State.bIsPlayerOnline &&
+						!State.bIsPartyFull &&
+						!State.bIsLocalPlayer &&
+						!State.bIsIgnored && 
+						!State.bIsBlockedByRH &&
 						!bBlockedInPlatform &&
 						MenuContext != EPlayerContextMenuContext::InGame &&
 						MenuContext != EPlayerContextMenuContext::CustomLobby;
 					break;
 				case EPlayerContextOptions::PartyKick:
-					bIsVisible = IsPlayerInParty() &&
-						IsPartyLeader() &&
-						!IsLocalPlayer() &&
+					bIsVisible = State.bIsPlayerInParty &&
+						State.bIsPartyLeader &&
+						!State.bIsLocalPlayer &&
 						MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::AddRHFriend:
-					bIsVisible = IsCrossplayEnabled() &&
-						!IsRHFriend() &&
-						!IsRequestingFriend() &&
-						!IsPendingFriend() &&
-						!IsLocalPlayer() &&
-						!IsIgnored() &&
-						!IsBlockedByRH() &&
+					bIsVisible = State.bIsCrossplayEnabled &&
+						!State.bIsRHFriend &&
+						!State.bIsRequestingFriend &&
+						!State.bIsPendingFriend &&
+						!State.bIsLocalPlayer &&
+						!State.bIsIgnored &&
+						!State.bIsBlockedByRH &&
 						!bBlockedInPlatform &&
 						MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::RemoveFriend:
-					bIsVisible = IsRHFriend() &&
-						IsCrossplayEnabled() &&
-						!IsPendingFriend() &&
-						!IsLocalPlayer() &&
-						!IsIgnored() &&
-						!IsBlockedByRH() &&
+					bIsVisible = State.bIsRHFriend &&
+						State.bIsCrossplayEnabled &&
+						!State.bIsPendingFriend &&
+						!State.bIsLocalPlayer &&
+						!State.bIsIgnored &&
+						!State.bIsBlockedByRH &&
 						!bBlockedInPlatform &&
 						MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::CancelRequest:
-					bIsVisible = IsPendingFriend() && MenuContext != EPlayerContextMenuContext::InGame;
+					bIsVisible = State.bIsPendingFriend && MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::AcceptFriendRequest:
 				case EPlayerContextOptions::RejectFriendRequest:
-					bIsVisible = IsRequestingFriend() && MenuContext != EPlayerContextMenuContext::InGame;
+					bIsVisible = State.bIsRequestingFriend && MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::PromotePartyLeader:
-					bIsVisible = IsPartyLeader() &&
-						IsPlayerInParty() &&
-						!IsPlayerPendingPartyInvite() &&
-						!IsLocalPlayer() &&
+					bIsVisible = State.bIsPartyLeader &&
+						State.bIsPlayerInParty &&
+						!State.bIsPlayerPendingPartyInvite &&
+						!State.bIsLocalPlayer &&
 						MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::LeaveParty:
-					bIsVisible = IsLocalPlayer() && 
-						IsInParty() && 
+					bIsVisible = State.bIsLocalPlayer && 
+						State.bIsInParty && 
 						MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::AcceptPartyInvite:
 				case EPlayerContextOptions::DeclinePartyInvite:
-					bIsVisible = HasPlayerInvited() && MenuContext != EPlayerContextMenuContext::InGame;
+					bIsVisible = State.bHasPlayerInvited && MenuContext != EPlayerContextMenuContext::InGame;
 					break;
 				case EPlayerContextOptions::ViewPlatformProfile:
 					// #RHTODO - Platform Support - Check that this was - bIsVisible = CurrentPlayerInfo->ShouldShowViewGamercardForPlayer();
 					bIsVisible = false;
 					break;
 				case EPlayerContextOptions::Mute:
-					bIsVisible = (((MenuContext == EPlayerContextMenuContext::CustomLobby || MenuContext == EPlayerContextMenuContext::InGame) && IsInVoiceChannel()) || bCanMuteInParty) &&
-						!IsMuted() &&
-						!IsLocalPlayer();
+					bIsVisible = (((MenuContext == EPlayerContextMenuContext::CustomLobby || MenuContext == EPlayerContextMenuContext::InGame) && State.bIsInVoiceChannel) || bCanMuteInParty) &&
+						!State.bIsMuted &&
+						!State.bIsLocalPlayer;
 					break;
 				case EPlayerContextOptions::Unmute:
-					bIsVisible = (((MenuContext == EPlayerContextMenuContext::CustomLobby || MenuContext == EPlayerContextMenuContext::InGame) && IsInVoiceChannel()) || bCanMuteInParty) &&
-						IsMuted() &&
-						!IsLocalPlayer();
+					bIsVisible = (((MenuContext == EPlayerContextMenuContext::CustomLobby || MenuContext == EPlayerContextMenuContext::InGame) && State.bIsInVoiceChannel) || bCanMuteInParty) &&
+						State.bIsMuted &&
+						!State.bIsLocalPlayer;
 					break;
 				case EPlayerContextOptions::ReportPlayer:
-					bIsVisible = bAllowReportPlayer && !IsLocalPlayer();
+					bIsVisible = bAllowReportPlayer && !State.bIsLocalPlayer;
 					break;
 				case EPlayerContextOptions::IgnorePlayer:
-					bIsVisible = !IsIgnored() && !IsBlockedByRH() && !bBlockedInPlatform && !IsLocalPlayer();
+					bIsVisible = !State.bIsIgnored && !State.bIsBlockedByRH && !bBlockedInPlatform && !State.bIsLocalPlayer;
 					break;
 				case EPlayerContextOptions::UnignorePlayer:
-					bIsVisible = IsIgnored() && IsBlockedByRH() && !bBlockedInPlatform && !IsLocalPlayer();
+					bIsVisible = State.bIsIgnored && State.bIsBlockedByRH && !bBlockedInPlatform && !State.bIsLocalPlayer;
 					break;
 				default:
 					break;
@@ -12,41 +12,89 @@ static FAutoConsoleVariableRef CVarSafeZoneDrawBorders(
 	TEXT(" 1: Draw black borders around URHSafeZone widgets (default)"),
 	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* InConsoleVariable)
 	{
-		for (TObjectIterator<URHSafeZone> SafeZoneIt; SafeZoneIt; ++SafeZoneIt)
-		{
-			URHSafeZone* RHSafeZone = *SafeZoneIt;
-			if (RHSafeZone && !RHSafeZone->IsTemplate())
-			{
-				RHSafeZone->SynchronizeProperties();
-			}
-		}
+		URHSafeZone::RefreshAllBorders();
 	}),
 	ECVF_Default
 );
 //$$ BME: END - MaxAspectRatio for CameraComponent
 
-class SRHSafeZone : public SSafeZone
+/*
+* Tracks every URHSafeZone with a live slate widget, so safe frame and border changes are pushed to all of them
+* in a single pass from one delegate binding rather than a subscription per widget or a scan of every UObject.
+*/
+class FRHSafeZoneRegistry
 {
 public:
-	FDelegateHandle OnSafeFrameChangedHandle;
+	static FRHSafeZoneRegistry& Get()
+	{
+		static FRHSafeZoneRegistry Registry;
+		return Registry;
+	}
 
-	const FSlateBrush* BorderImage = FCoreStyle::Get().GetBrush("BlackBrush");
-	bool bBorderLeft = false;
-	bool bBorderRight = false;
-	bool bBorderTop = false;
-	bool bBorderBottom = false;
+	void Register(URHSafeZone* SafeZone)
+	{
+		SafeZones.Add(SafeZone);
 
-	virtual ~SRHSafeZone() override
+		if (!OnSafeFrameChangedHandle.IsValid())
+		{
+			OnSafeFrameChangedHandle = FCoreDelegates::OnSafeFrameChangedEvent.AddRaw(this, &FRHSafeZoneRegistry::OnSafeFrameChanged);
+		}
+	}
+
+	void Unregister(URHSafeZone* SafeZone)
+	{
+		SafeZones.Remove(SafeZone);
+
+		if (SafeZones.Num() == 0 && OnSafeFrameChangedHandle.IsValid())
+		{
+			FCoreDelegates::OnSafeFrameChangedEvent.Remove(OnSafeFrameChangedHandle);
+			OnSafeFrameChangedHandle.Reset();
+		}
+	}
+
+	void RefreshAllBorders()
+	{
+		ForEachSafeZone([](URHSafeZone* SafeZone) { SafeZone->RefreshBorders(); });
+	}
+
+	void OnSafeFrameChanged()
 	{
-		FCoreDelegates::OnSafeFrameChangedEvent.Remove(OnSafeFrameChangedHandle);
+		ForEachSafeZone([](URHSafeZone* SafeZone) { SafeZone->InvalidateSafeArea(); });
 	}
 
-	void Construct(const FArguments& InArgs)
+	int32 Num() const { return SafeZones.Num(); }
+
+private:
+	template<typename FunctorType>
+	void ForEachSafeZone(FunctorType&& Functor)
 	{
-		SSafeZone::Construct(InArgs);
-		OnSafeFrameChangedHandle = FCoreDelegates::OnSafeFrameChangedEvent.AddSP(this, &SRHSafeZone::OnSafeFrameChanged);
+		// Widgets garbage collected without releasing their slate resources are dropped as we go
+		for (auto It = SafeZones.CreateIterator(); It; ++It)
+		{
+			if (URHSafeZone* SafeZone = It->Get())
+			{
+				Functor(SafeZone);
+			}
+			else
+			{
+				It.RemoveCurrent();
+			}
+		}
 	}
 
+	TSet<TWeakObjectPtr<URHSafeZone>> SafeZones;
+	FDelegateHandle OnSafeFrameChangedHandle;
+};
+
+class SRHSafeZone : public SSafeZone
+{
+public:
+	const FSlateBrush* BorderImage = FCoreStyle::Get().GetBrush("BlackBrush");
+	bool bBorderLeft = false;
+	bool bBorderRight = false;
+	bool bBorderTop = false;
+	bool bBorderBottom = false;
+
 	void SetBorderSides(bool bInBorderLeft, bool bInBorderRight, bool bInBorderTop, bool bInBorderBottom, bool bForceDrawBorders)
 	{
 		if (GSafeZoneDrawBorders || bForceDrawBorders)
@@ -67,10 +115,10 @@ public:
 		Invalidate(EInvalidateWidgetReason::Paint);
 	}
 
+	// Called by FRHSafeZoneRegistry when the safe frame changes
 	void OnSafeFrameChanged()
 	{
-		Invalidate(EInvalidateWidgetReason::Layout);
-		Invalidate(EInvalidateWidgetReason::Prepass);
+		Invalidate(EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::Prepass);
 	}
 
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
@@ -178,12 +226,42 @@ void URHSafeZone::SynchronizeProperties()
 {
 	Super::SynchronizeProperties();
 
+	RefreshBorders();
+}
+
+void URHSafeZone::ReleaseSlateResources(bool bReleaseChildren)
+{
+	FRHSafeZoneRegistry::Get().Unregister(this);
+
+	Super::ReleaseSlateResources(bReleaseChildren);
+}
+
+void URHSafeZone::RefreshBorders()
+{
 	if (MySafeZone.IsValid())
 	{
 		static_cast<SRHSafeZone*>(MySafeZone.Get())->SetBorderSides(bBorderLeft, bBorderRight, bBorderTop, bBorderBottom, bForceDrawBorders);
 	}
 }
 
+void URHSafeZone::InvalidateSafeArea()
+{
+	if (MySafeZone.IsValid())
+	{
+		static_cast<SRHSafeZone*>(MySafeZone.Get())->OnSafeFrameChanged();
+	}
+}
+
+void URHSafeZone::RefreshAllBorders()
+{
+	FRHSafeZoneRegistry::Get().RefreshAllBorders();
+}
+
+int32 URHSafeZone::GetNumRegisteredSafeZones()
+{
+	return FRHSafeZoneRegistry::Get().Num();
+}
+
 TSharedRef<SWidget> URHSafeZone::RebuildWidget()
 {
 #if RH_FROM_ENGINE_VERSION(5,2)
@@ -215,6 +293,7 @@ TSharedRef<SWidget> URHSafeZone::RebuildWidget()
 	NewSafeZone->SetBorderSides(bBorderLeft, bBorderRight, bBorderTop, bBorderBottom, bForceDrawBorders);
 
 	MySafeZone = NewSafeZone;
+	FRHSafeZoneRegistry::Get().Register(this);
 
 	return MySafeZone.ToSharedRef();
 #else
@@ -242,6 +321,7 @@ TSharedRef<SWidget> URHSafeZone::RebuildWidget()
 	NewSafeZone->SetBorderSides(bBorderLeft, bBorderRight, bBorderTop, bBorderBottom, bForceDrawBorders);
 
 	MySafeZone = NewSafeZone;
+	FRHSafeZoneRegistry::Get().Register(this);
 
 	return MySafeZone.ToSharedRef();
 #endif
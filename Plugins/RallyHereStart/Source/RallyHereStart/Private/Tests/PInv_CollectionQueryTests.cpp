@@ -0,0 +1,111 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "PlatformInventoryItem/PInv_AssetManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPInv_CollectionQueryBenchmarkTest, "RallyHereStart.PlatformInventory.CollectionQueryBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FPInv_CollectionQueryBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int32 NumItems = 50000;
+
+	// Tags can't be registered once the tag manager is initialized, so the synthetic items are tagged from the project's own tag tree
+	FGameplayTagContainer AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+
+	TArray<FGameplayTag> Tags;
+	AllTags.GetGameplayTagArray(Tags);
+
+	FGameplayTag ChildTag;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (Tag.RequestDirectParent().IsValid())
+		{
+			ChildTag = Tag;
+			break;
+		}
+	}
+
+	if (Tags.Num() < 2 || !ChildTag.IsValid())
+	{
+		AddWarning(TEXT("The project has too few gameplay tags to build a synthetic item registry"));
+		return true;
+	}
+
+	UPInv_AssetManager* AssetManager = NewObject<UPInv_AssetManager>(GetTransientPackage());
+
+	FRandomStream Random(NumItems);
+	for (int32 i = 0; i < NumItems; ++i)
+	{
+		const FPrimaryAssetId PrimaryAssetId(UPInv_AssetManager::PlatformInventoryItemType, *FString::Printf(TEXT("BenchmarkItem_%d"), i));
+
+		FGameplayTagContainer CollectionContainer;
+		const int32 NumItemTags = Random.RandRange(1, 4);
+		for (int32 j = 0; j < NumItemTags; ++j)
+		{
+			CollectionContainer.AddTag(Tags[Random.RandHelper(Tags.Num())]);
+		}
+
+		for (const FGameplayTag& Tag : CollectionContainer)
+		{
+			AssetManager->ItemsByGameplayTagMap.Add(Tag, PrimaryAssetId);
+		}
+		AssetManager->ItemCollectionMap.Add(PrimaryAssetId, MoveTemp(CollectionContainer));
+	}
+
+	FGameplayTagContainer TwoTags;
+	TwoTags.AddTag(Tags[0]);
+	TwoTags.AddTag(Tags[1]);
+
+	FGameplayTagQueryExpression ParentAndNotChildExpr = FGameplayTagQueryExpression()
+		.AllExprMatch()
+		.AddExpr(FGameplayTagQueryExpression().AnyTagsMatch().AddTag(ChildTag.RequestDirectParent()))
+		.AddExpr(FGameplayTagQueryExpression().NoTagsMatch().AddTag(ChildTag));
+	const FGameplayTagQuery ParentAndNotChild = FGameplayTagQuery::BuildQuery(ParentAndNotChildExpr);
+
+	TArray<FGameplayTagQuery> Queries;
+	Queries.Add(FGameplayTagQuery::MakeQuery_MatchAnyTags(FGameplayTagContainer(ChildTag.RequestDirectParent())));
+	Queries.Add(FGameplayTagQuery::MakeQuery_MatchAllTags(TwoTags));
+	Queries.Add(FGameplayTagQuery::MakeQuery_MatchNoTags(TwoTags));
+	Queries.Add(ParentAndNotChild);
+
+	for (const FGameplayTagQuery& Query : Queries)
+	{
+		double StartTime = FPlatformTime::Seconds();
+		TArray<FPrimaryAssetId> ScannedIds;
+		for (const TPair<FPrimaryAssetId, FGameplayTagContainer>& Pair : AssetManager->ItemCollectionMap)
+		{
+			if (Pair.Value.MatchesQuery(Query))
+			{
+				ScannedIds.Add(Pair.Key);
+			}
+		}
+		const double ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// Cold includes renumbering the assets and filling in the tag lists the query needs
+		AssetManager->MarkCollectionTagIndexDirty();
+		StartTime = FPlatformTime::Seconds();
+		TArray<FPrimaryAssetId> IndexedIds;
+		AssetManager->GetPrimaryAssetIdListByCollectionQuery(Query, IndexedIds);
+		const double ColdSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		TArray<FPrimaryAssetId> MemoizedIds;
+		AssetManager->GetPrimaryAssetIdListByCollectionQuery(Query, MemoizedIds);
+		const double WarmSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// Both the scan and the index list assets in ItemCollectionMap order
+		TestTrue(FString::Printf(TEXT("Indexed results match the scan for %s"), *Query.GetDescription()), IndexedIds == ScannedIds);
+		TestTrue(FString::Printf(TEXT("Memoized results match the scan for %s"), *Query.GetDescription()), MemoizedIds == ScannedIds);
+
+		AddInfo(FString::Printf(TEXT("%d items, %d matches: scan %.3fms, indexed %.3fms, memoized %.3fms"),
+			NumItems, ScannedIds.Num(), ScanSeconds * 1000.0, ColdSeconds * 1000.0, WarmSeconds * 1000.0));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
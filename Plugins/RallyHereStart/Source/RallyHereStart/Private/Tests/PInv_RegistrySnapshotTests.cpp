@@ -0,0 +1,120 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "GameplayTagsManager.h"
+#include "PlatformInventoryItem/PInv_RegistrySnapshot.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPInv_RegistrySnapshotStartupTest, "RallyHereStart.PlatformInventory.RegistrySnapshotStartup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FPInv_RegistrySnapshotStartupTest::RunTest(const FString& Parameters)
+{
+	const int32 NumAssets = 50000;
+
+	FGameplayTagContainer AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+
+	TArray<FGameplayTag> Tags;
+	AllTags.GetGameplayTagArray(Tags);
+
+	// Synthetic registry tags in the same export formats the asset registry stores for PlatformInventoryItems
+	TArray<FPrimaryAssetId> AssetIds;
+	TArray<FString> ItemIdTags;
+	TArray<FString> LootIdTags;
+	TArray<FString> CollectionTags;
+	AssetIds.Reserve(NumAssets);
+	ItemIdTags.Reserve(NumAssets);
+	LootIdTags.Reserve(NumAssets);
+	CollectionTags.Reserve(NumAssets);
+
+	FRandomStream Random(NumAssets);
+	for (int32 i = 0; i < NumAssets; ++i)
+	{
+		AssetIds.Add(FPrimaryAssetId(FPrimaryAssetType(TEXT("PlatformInventoryItem")), *FString::Printf(TEXT("SnapshotTestItem_%d"), i)));
+		ItemIdTags.Add(FString::Printf(TEXT("(Id=%s,LegacyId=%d)"), *FGuid::NewGuid().ToString(EGuidFormats::Digits), i + 1));
+		LootIdTags.Add(FString::Printf(TEXT("(Id=%s,LegacyId=%d)"), *FGuid::NewGuid().ToString(EGuidFormats::Digits), i + 1));
+
+		FGameplayTagContainer Collection;
+		for (int32 j = 0; j < 3 && Tags.Num() > 0; ++j)
+		{
+			Collection.AddTag(Tags[Random.RandHelper(Tags.Num())]);
+		}
+		CollectionTags.Add(Collection.ToString());
+	}
+
+	// Cold path, every tag string is parsed as it is without a snapshot
+	FPInv_RegistrySnapshot RecordedSnapshot;
+	RecordedSnapshot.SetRecording(true);
+
+	const double ParseStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumAssets; ++i)
+	{
+		RecordedSnapshot.SetItemId(AssetIds[i], FPInv_RegistrySnapshot::ParseIdTagString(ItemIdTags[i], FPInv_RegistrySnapshot::HashTagString(ItemIdTags[i])));
+		RecordedSnapshot.SetLootId(AssetIds[i], FPInv_RegistrySnapshot::ParseIdTagString(LootIdTags[i], FPInv_RegistrySnapshot::HashTagString(LootIdTags[i])));
+
+		FGameplayTagContainer Collection;
+		Collection.FromExportString(CollectionTags[i]);
+
+		FPInv_RegistrySnapshot::FCollectionTag CollectionTag;
+		CollectionTag.TagHash = FPInv_RegistrySnapshot::HashTagString(CollectionTags[i]);
+		CollectionTag.bIsSet = true;
+		for (const FGameplayTag& Tag : Collection)
+		{
+			CollectionTag.TagNames.Add(Tag.GetTagName());
+		}
+		RecordedSnapshot.SetCollection(AssetIds[i], CollectionTag);
+	}
+	const double ParseMs = (FPlatformTime::Seconds() - ParseStartTime) * 1000.0;
+
+	const FString SnapshotFilePath = FPaths::AutomationTransientDir() / TEXT("PInv_RegistrySnapshotStartup.bin");
+	if (!TestTrue(TEXT("Snapshot was written"), RecordedSnapshot.SaveToFile(SnapshotFilePath)))
+	{
+		return false;
+	}
+
+	// Warm path, what StartInitialLoading and the initial scan do in a cooked build
+	FPInv_RegistrySnapshot LoadedSnapshot;
+
+	const double LoadStartTime = FPlatformTime::Seconds();
+	const bool bLoaded = LoadedSnapshot.LoadFromFile(SnapshotFilePath);
+	const double LoadMs = (FPlatformTime::Seconds() - LoadStartTime) * 1000.0;
+
+	int32 NumMismatches = 0;
+	const double LookupStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumAssets; ++i)
+	{
+		const FPInv_RegistrySnapshot::FIdTag* ItemId = LoadedSnapshot.FindItemId(AssetIds[i], FPInv_RegistrySnapshot::HashTagString(ItemIdTags[i]));
+		const FPInv_RegistrySnapshot::FIdTag* LootId = LoadedSnapshot.FindLootId(AssetIds[i], FPInv_RegistrySnapshot::HashTagString(LootIdTags[i]));
+		const FPInv_RegistrySnapshot::FCollectionTag* Collection = LoadedSnapshot.FindCollection(AssetIds[i], FPInv_RegistrySnapshot::HashTagString(CollectionTags[i]));
+
+		if (ItemId == nullptr || LootId == nullptr || Collection == nullptr || ItemId->LegacyId != i + 1 || LootId->LegacyId != i + 1)
+		{
+			++NumMismatches;
+			continue;
+		}
+
+		FGameplayTagContainer CollectionContainer;
+		for (const FName& TagName : Collection->TagNames)
+		{
+			CollectionContainer.AddTag(FGameplayTag::RequestGameplayTag(TagName, false));
+		}
+	}
+	const double LookupMs = (FPlatformTime::Seconds() - LookupStartTime) * 1000.0;
+
+	IFileManager::Get().Delete(*SnapshotFilePath);
+
+	TestTrue(TEXT("Snapshot was loaded"), bLoaded);
+	TestEqual(TEXT("Loaded snapshot entries"), LoadedSnapshot.Num(), NumAssets);
+	TestEqual(TEXT("Snapshot lookups that missed or disagreed with the parsed tags"), NumMismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d assets: parsing tags %.2f ms, snapshot load %.2f ms + lookups %.2f ms (%.1fx)"),
+		NumAssets, ParseMs, LoadMs, LookupMs, ParseMs / FMath::Max(LoadMs + LookupMs, 0.001)));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,140 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Texture2D.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "RHAsyncImage.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHAsyncImageSharedRequestTest, "RallyHereStart.UI.AsyncImageSharedRequests", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHAsyncImageSharedRequestTest::RunTest(const FString& Parameters)
+{
+	const int32 NumImages = 200;
+
+	if (!UAssetManager::IsValid())
+	{
+		AddWarning(TEXT("No asset manager, nothing to stream"));
+		return true;
+	}
+
+	// Any texture that is not in memory yet, so every image has to wait on the load
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UTexture2D::StaticClass()->GetClassPathName());
+	Filter.PackagePaths.Add(TEXT("/Game"));
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> AssetData;
+	UAssetManager::Get().GetAssetRegistry().GetAssets(Filter, AssetData);
+
+	const FAssetData* UnloadedAsset = AssetData.FindByPredicate([](const FAssetData& Asset) { return !Asset.IsAssetLoaded(); });
+	if (UnloadedAsset == nullptr)
+	{
+		AddWarning(TEXT("No unloaded texture under /Game to stream"));
+		return true;
+	}
+
+	const FSoftObjectPath SoftPath = UnloadedAsset->ToSoftObjectPath();
+
+	TArray<URHAsyncImage*> Images;
+	Images.Reserve(NumImages);
+	for (int32 i = 0; i < NumImages; ++i)
+	{
+		URHAsyncImage* Image = NewObject<URHAsyncImage>(GetTransientPackage());
+		Image->AddToRoot();
+		Image->SetBrushFromPathOnItem(nullptr, SoftPath);
+		Images.Add(Image);
+	}
+
+	const TSharedPtr<FStreamableHandle> Handle = Images[0]->StreamingHandle;
+	TestTrue(TEXT("First image started a load"), Handle.IsValid());
+
+	int32 NumSharingHandle = 0;
+	for (URHAsyncImage* Image : Images)
+	{
+		if (Image->SharedLoadPath == SoftPath && Image->StreamingHandle.IsValid() && Image->StreamingHandle == Handle)
+		{
+			++NumSharingHandle;
+		}
+	}
+	TestEqual(TEXT("Images waiting on the one shared load"), NumSharingHandle, NumImages);
+
+	// The load has to survive until the last image waiting on it lets go
+	for (int32 i = 1; i < NumImages; ++i)
+	{
+		Images[i]->CancelImageStreaming();
+	}
+
+	if (Handle.IsValid())
+	{
+		TestFalse(TEXT("Load canceled while an image was still waiting on it"), Handle->WasCanceled());
+
+		Images[0]->CancelImageStreaming();
+		TestTrue(TEXT("Load canceled once no image was waiting on it"), Handle->WasCanceled());
+	}
+
+	for (URHAsyncImage* Image : Images)
+	{
+		Image->RemoveFromRoot();
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHAsyncImageResidentTextureTest, "RallyHereStart.UI.AsyncImageResidentTextures", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHAsyncImageResidentTextureTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* BudgetVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("rh.AsyncImage.ResidentTextureBudgetMB"));
+	if (!TestNotNull(TEXT("Resident texture budget variable"), BudgetVariable))
+	{
+		return false;
+	}
+
+	// Each texture alone is over a 1MB budget, so anything not displayed has to be released
+	UTexture2D* FirstTexture = UTexture2D::CreateTransient(1024, 1024, PF_B8G8R8A8);
+	UTexture2D* SecondTexture = UTexture2D::CreateTransient(1024, 1024, PF_B8G8R8A8);
+	FirstTexture->AddToRoot();
+	SecondTexture->AddToRoot();
+
+	URHAsyncImage* FirstImage = NewObject<URHAsyncImage>(GetTransientPackage());
+	URHAsyncImage* SecondImage = NewObject<URHAsyncImage>(GetTransientPackage());
+	FirstImage->AddToRoot();
+	SecondImage->AddToRoot();
+
+	const int32 PreviousBudgetMB = BudgetVariable->GetInt();
+	BudgetVariable->Set(1, ECVF_SetByCode);
+
+	FirstImage->SetBrushFromTexture(FirstTexture);
+	SecondImage->SetBrushFromTexture(FirstTexture);
+	TestTrue(TEXT("Displayed texture forced resident"), FirstTexture->bForceMiplevelsToBeResident);
+
+	// Showing a newer texture over budget must not release one another image still displays
+	FirstImage->SetBrushFromTexture(SecondTexture);
+	TestTrue(TEXT("Texture still displayed by another image stays resident over budget"), FirstTexture->bForceMiplevelsToBeResident);
+	TestTrue(TEXT("Newly displayed texture forced resident"), SecondTexture->bForceMiplevelsToBeResident);
+
+	// Once the last image stops displaying it, it is the first to go
+	SecondImage->SetBrushFromTexture(SecondTexture);
+	TestFalse(TEXT("Texture no image displays released over budget"), FirstTexture->bForceMiplevelsToBeResident);
+	TestTrue(TEXT("Texture displayed by both images stays resident"), SecondTexture->bForceMiplevelsToBeResident);
+
+	FirstImage->SetBrushFromTexture(nullptr);
+	SecondImage->SetBrushFromTexture(nullptr);
+	TestFalse(TEXT("Texture released once neither image displays it"), SecondTexture->bForceMiplevelsToBeResident);
+
+	BudgetVariable->Set(PreviousBudgetMB, ECVF_SetByCode);
+
+	FirstImage->RemoveFromRoot();
+	SecondImage->RemoveFromRoot();
+	FirstTexture->RemoveFromRoot();
+	SecondTexture->RemoveFromRoot();
+
+	return true;
+}
+
+#endif
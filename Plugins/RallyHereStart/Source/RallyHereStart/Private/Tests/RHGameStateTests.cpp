@@ -0,0 +1,63 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/RHGameState.h"
+#include "Player/Controllers/RHPlayerState.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHGameStateHumanPlayerCountTest, "RallyHereStart.GameFramework.HumanPlayerCount", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHGameStateHumanPlayerCountTest::RunTest(const FString& Parameters)
+{
+	// A world of its own with no game mode, so nothing but the test adds or flags player states
+	UWorld* pWorld = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(pWorld);
+	pWorld->InitializeActorsForPlay(FURL());
+
+	ARHGameState* pGameState = pWorld->SpawnActor<ARHGameState>();
+	if (!TestNotNull(TEXT("Game state was spawned"), pGameState) || !TestTrue(TEXT("Spawned game state is the world's game state"), pWorld->GetGameState<ARHGameState>() == pGameState))
+	{
+		GEngine->DestroyWorldContext(pWorld);
+		pWorld->DestroyWorld(false);
+		return false;
+	}
+
+	// Both player states are added by their PostInitializeComponents before any flag is set, as on a client before the initial replication
+	ARHPlayerState* pHuman = pWorld->SpawnActor<ARHPlayerState>();
+	ARHPlayerState* pBot = pWorld->SpawnActor<ARHPlayerState>();
+	if (!TestNotNull(TEXT("Human player state was spawned"), pHuman) || !TestNotNull(TEXT("Bot player state was spawned"), pBot))
+	{
+		GEngine->DestroyWorldContext(pWorld);
+		pWorld->DestroyWorld(false);
+		return false;
+	}
+	TestEqual(TEXT("Player states counted as human before their flags arrive"), pGameState->GetNumHumanPlayers(), 2);
+
+	// The bot flag arrives late and has no rep notify, the notifies that follow the replicated properties pick it up
+	pBot->SetIsABot(true);
+	pBot->PostRepNotifies();
+	TestEqual(TEXT("Bot no longer counted as human once its flag arrived"), pGameState->GetNumHumanPlayers(), 1);
+	TestFalse(TEXT("A single human player does not use multiplayer features"), pGameState->IsUsingMultiplayerFeatures());
+
+	// Later refreshes of either player state leave the count alone
+	pBot->PostRepNotifies();
+	pHuman->PostRepNotifies();
+	TestEqual(TEXT("Repeated refreshes keep the count"), pGameState->GetNumHumanPlayers(), 1);
+
+	// A removed player state is not counted again by a refresh
+	pGameState->RemovePlayerState(pHuman);
+	pHuman->PostRepNotifies();
+	TestEqual(TEXT("Removed player state not counted after a refresh"), pGameState->GetNumHumanPlayers(), 0);
+
+	GEngine->DestroyWorldContext(pWorld);
+	pWorld->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
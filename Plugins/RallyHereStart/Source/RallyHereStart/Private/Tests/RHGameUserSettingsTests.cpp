@@ -0,0 +1,79 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "GameFramework/RHGameUserSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	bool IsLocalActionInSlot(const FString& SlotName, const FName& Action)
+	{
+		const URHSettingsSaveGame* const pSaveGame = Cast<URHSettingsSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+		return pSaveGame != nullptr && pSaveGame->SavedLocalActions.Contains(Action);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHGameUserSettingsSaveFlushTest, "RallyHereStart.Settings.SaveFlush", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHGameUserSettingsSaveFlushTest::RunTest(const FString& Parameters)
+{
+	URHGameUserSettings* Settings = GEngine != nullptr ? Cast<URHGameUserSettings>(GEngine->GetGameUserSettings()) : nullptr;
+	if (Settings == nullptr)
+	{
+		AddWarning(TEXT("The game user settings are not a URHGameUserSettings, nothing to test"));
+		return true;
+	}
+
+	// Start from nothing scheduled, then write to a slot of our own so the player's settings slot is never touched
+	Settings->FlushPendingSave();
+
+	const FString TestId = FGuid::NewGuid().ToString();
+	const FString SlotName = FString::Printf(TEXT("RHSettingsSaveFlushTest_%s"), *TestId);
+	const FName FirstAction(*FString::Printf(TEXT("SaveFlushTest_First_%s"), *TestId));
+	const FName SecondAction(*FString::Printf(TEXT("SaveFlushTest_Second_%s"), *TestId));
+	Settings->TestSaveGameSlotName = SlotName;
+
+	// Save requests within the debounce window are folded into one write
+	const int32 NumCoalescedSaves = Settings->GetNumCoalescedSaves();
+	Settings->SaveLocalAction(FirstAction);
+	Settings->SaveSettings();
+	TestEqual(TEXT("Second save within the debounce window was coalesced"), Settings->GetNumCoalescedSaves(), NumCoalescedSaves + 1);
+
+	// Let the debounced write start on the worker, then change a setting while it is still in flight
+	Settings->WriteSettings(false);
+	TestTrue(TEXT("Slot write is in flight"), Settings->SlotWriteResult.IsValid());
+	Settings->SaveLocalAction(SecondAction);
+
+	// Flush as shutdown or suspend would, without the game thread ticking in between
+	Settings->FlushPendingSave();
+
+	TestFalse(TEXT("Save still pending after flush"), Settings->bSavePending);
+	TestFalse(TEXT("Debounce ticker still registered after flush"), Settings->SaveDebounceHandle.IsValid());
+	TestFalse(TEXT("Slot write still in flight after flush"), Settings->SlotWriteResult.IsValid());
+	TestTrue(TEXT("Slot holds the setting changed while the write was in flight"), IsLocalActionInSlot(SlotName, SecondAction));
+
+	// The older write's completion arrives on the game thread afterwards, and must not write anything over the flushed settings
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	TestFalse(TEXT("Completion of the older write started another write"), Settings->SlotWriteResult.IsValid());
+	TestTrue(TEXT("Slot still holds the flushed settings after the older write completed"), IsLocalActionInSlot(SlotName, FirstAction) && IsLocalActionInSlot(SlotName, SecondAction));
+
+	// Loading reads the setting back from the slot
+	Settings->SavedLocalActions.Remove(SecondAction);
+	Settings->LoadSaveGameConfig();
+	TestTrue(TEXT("Setting read back from the slot"), Settings->IsLocalActionSaved(SecondAction));
+
+	// Drop the test actions and the test slot, and write the settings back as they were
+	Settings->SavedLocalActions.Remove(FirstAction);
+	Settings->SavedLocalActions.Remove(SecondAction);
+	Settings->TestSaveGameSlotName.Empty();
+	UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+	Settings->WriteSettings(true);
+
+	return true;
+}
+
+#endif
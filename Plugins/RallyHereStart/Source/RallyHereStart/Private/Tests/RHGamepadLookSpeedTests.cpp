@@ -0,0 +1,189 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "Curves/CurveVector.h"
+#include "GameFramework/RHGamepadCurvedLookSpeedManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	void AddCubicKeys(FRichCurve& Curve, const TArray<FVector2D>& Keys)
+	{
+		for (const FVector2D& Key : Keys)
+		{
+			Curve.SetKeyInterpMode(Curve.AddKey(Key.X, Key.Y), RCIM_Cubic);
+		}
+		Curve.AutoSetTangents();
+	}
+
+	// Largest difference between the baked table and evaluating the curve directly on one axis, across and past either end of its keyed range
+	float GetMaxBakeError(const FRHBakedLookCurve& Table, const UCurveVector* Curve, int32 Axis, float Scale)
+	{
+		const int32 NumTestPoints = 1000;
+		const FRichCurve& AxisCurve = Curve->FloatCurves[Axis];
+
+		float StartTime = 0.f, EndTime = 0.f;
+		AxisCurve.GetTimeRange(StartTime, EndTime);
+		const float Padding = (EndTime - StartTime) * 0.25f;
+
+		float MaxError = 0.f;
+		for (int32 i = 0; i <= NumTestPoints; ++i)
+		{
+			const float Time = FMath::Lerp(StartTime - Padding, EndTime + Padding, (float)i / NumTestPoints);
+			const FVector2D Baked = Table.Eval(FVector2D(Time, Time));
+			MaxError = FMath::Max(MaxError, FMath::Abs((Axis == 0 ? Baked.X : Baked.Y) - AxisCurve.Eval(Time) * Scale));
+		}
+
+		return MaxError;
+	}
+
+	// The per sub-step base velocity loop URHGamepadCurvedLookSpeedManager::UpdateGamepadLook ran before the boost was integrated in closed form
+	float IntegrateBaseVelocityAxisPerStep(float AbsInput, float Dir, float BaseSpeed, float BoostMultiplier, float BoostThreshold, float BoostAcceleration, float AccelerationTimestep, float DeltaTime, float& InOutSpeed)
+	{
+		float Distance = 0.f;
+		float AccelerationTimeRemaining = DeltaTime;
+		while (AccelerationTimeRemaining > 0.0005f)
+		{
+			const float Timestep = FMath::Min(AccelerationTimestep, AccelerationTimeRemaining);
+
+			if (AbsInput < BoostThreshold || FMath::Abs(InOutSpeed) < BaseSpeed || FMath::Sign(InOutSpeed) != Dir)
+			{
+				InOutSpeed = BaseSpeed * Dir;
+			}
+
+			if (AbsInput >= BoostThreshold)
+			{
+				InOutSpeed += Timestep * Dir * BoostAcceleration;
+
+				const float DesiredSpeed = BaseSpeed * BoostMultiplier;
+				InOutSpeed = FMath::Clamp(InOutSpeed, -DesiredSpeed, DesiredSpeed);
+			}
+
+			Distance += InOutSpeed * Timestep;
+			AccelerationTimeRemaining -= Timestep;
+		}
+
+		return Distance;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHBakedLookCurveTest, "RallyHereStart.Input.BakedLookCurve", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHBakedLookCurveTest::RunTest(const FString& Parameters)
+{
+	// Shaped like the stock look speed curves, a stick response on X and a velocity ramp on a wider range on Y
+	UCurveVector* Curve = NewObject<UCurveVector>(GetTransientPackage());
+	AddCubicKeys(Curve->FloatCurves[0], { FVector2D(0.f, 0.f), FVector2D(0.3f, 0.05f), FVector2D(0.7f, 0.4f), FVector2D(1.f, 1.f) });
+	AddCubicKeys(Curve->FloatCurves[1], { FVector2D(0.f, 0.f), FVector2D(5.f, 80.f), FVector2D(20.f, 120.f) });
+
+	const FVector2D NoScale(1.f, 1.f);
+	const FVector2D BoostScale(1.2f, 1.2f);
+
+	FRHBakedLookCurve Table;
+	Table.Bake(Curve, 256, NoScale);
+	TestTrue(TEXT("Baked table is valid"), Table.IsValid());
+
+	FRHBakedLookCurve ScaledTable;
+	ScaledTable.Bake(Curve, 256, BoostScale);
+
+	// Within a thousandth of each axis' value range, 1 on X and 120 on Y before scaling
+	const float Tolerance = 1e-3f;
+	const FVector2D ValueRange(1.f, 120.f);
+	for (int32 Axis = 0; Axis < 2; ++Axis)
+	{
+		const float Error = GetMaxBakeError(Table, Curve, Axis, NoScale[Axis]) / ValueRange[Axis];
+		const float ScaledError = GetMaxBakeError(ScaledTable, Curve, Axis, BoostScale[Axis]) / (ValueRange[Axis] * BoostScale[Axis]);
+
+		TestTrue(FString::Printf(TEXT("Axis %d baked table within %.4f of the curve (%.6f)"), Axis, Tolerance, Error), Error <= Tolerance);
+		TestTrue(FString::Printf(TEXT("Axis %d scaled table within %.4f of the scaled curve (%.6f)"), Axis, Tolerance, ScaledError), ScaledError <= Tolerance);
+	}
+
+	// Baking the same curve again has to give the exact same values
+	FRHBakedLookCurve RebakedTable;
+	RebakedTable.Bake(Curve, 256, NoScale);
+
+	int32 NumDifferent = 0;
+	for (int32 i = 0; i <= 100; ++i)
+	{
+		const FVector2D Time(i / 100.f, i * 0.2f);
+		NumDifferent += Table.Eval(Time) == RebakedTable.Eval(Time) ? 0 : 1;
+	}
+	TestEqual(TEXT("Rebaked table evaluations that differed"), NumDifferent, 0);
+
+	FRHBakedLookCurve EmptyTable;
+	EmptyTable.Bake(nullptr, 256, NoScale);
+	TestFalse(TEXT("Table without a curve is not valid"), EmptyTable.IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHBaseVelocityLookAxisTest, "RallyHereStart.Input.BaseVelocityLookAxis", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHBaseVelocityLookAxisTest::RunTest(const FString& Parameters)
+{
+	const float BaseSpeed = 2.5f;
+	const float BoostThreshold = 0.959f;
+	const float DeltaTimes[] = { 1.f / 240.f, 1.f / 144.f, 1.f / 60.f, 1.f / 30.f, 0.1f, 0.25f };
+	const float AbsInputs[] = { 0.5f, 0.959f, 1.f };
+	const float BoostMultipliers[] = { 1.f, 1.2f, 2.f };
+	const float BoostAccelerations[] = { 0.45f, 5.f, 50.f };
+	const float Dirs[] = { 1.f, -1.f };
+
+	int32 NumCases = 0;
+	int32 NumMismatches = 0;
+	for (float DeltaTime : DeltaTimes)
+	{
+		// The frame split UpdateGamepadLook uses, a fixed 1/150s step that grows to a tenth of the frame at low frame rates
+		const float AccelerationTimestep = FMath::Max(DeltaTime / 10.f, 1.f / 150.f);
+		const int32 NumSteps = FMath::FloorToInt(DeltaTime / AccelerationTimestep);
+		float Remainder = DeltaTime - NumSteps * AccelerationTimestep;
+		if (Remainder <= 0.0005f)
+		{
+			Remainder = 0.f;
+		}
+
+		for (float AbsInput : AbsInputs)
+		for (float BoostMultiplier : BoostMultipliers)
+		for (float BoostAcceleration : BoostAccelerations)
+		for (float Dir : Dirs)
+		{
+			const float BoostedSpeed = BaseSpeed * BoostMultiplier;
+
+			// Starting at rest, reversing, at base, partway up the ramp and above the boosted speed
+			const float StartSpeeds[] = { 0.f, -Dir * BaseSpeed, Dir * BaseSpeed, Dir * (BaseSpeed + BoostedSpeed) * 0.5f, Dir * BoostedSpeed * 1.5f };
+			for (float StartSpeed : StartSpeeds)
+			{
+				// Run several frames so the speed carried between frames is covered too
+				float PerStepSpeed = StartSpeed;
+				float ClosedFormSpeed = StartSpeed;
+				for (int32 Frame = 0; Frame < 8; ++Frame)
+				{
+					const float Expected = IntegrateBaseVelocityAxisPerStep(AbsInput, Dir, BaseSpeed, BoostMultiplier, BoostThreshold, BoostAcceleration, AccelerationTimestep, DeltaTime, PerStepSpeed);
+
+					float Acceleration = 0.f;
+					const float Actual = FRHBaseVelocityLookAxis::Integrate(AbsInput, Dir, BaseSpeed, BoostedSpeed, BoostThreshold, BoostAcceleration, AccelerationTimestep, NumSteps, Remainder, ClosedFormSpeed, Acceleration);
+
+					++NumCases;
+					if (!FMath::IsNearlyEqual(Actual, Expected, 1e-5f + FMath::Abs(Expected) * 1e-4f) || !FMath::IsNearlyEqual(ClosedFormSpeed, PerStepSpeed, 1e-4f))
+					{
+						++NumMismatches;
+						if (NumMismatches <= 10)
+						{
+							AddError(FString::Printf(TEXT("dt %.4f, input %.3f, boost x%.1f, accel %.2f, dir %.0f, start speed %.3f, frame %d: closed form %.6f (speed %.4f), per step %.6f (speed %.4f)"),
+								DeltaTime, AbsInput, BoostMultiplier, BoostAcceleration, Dir, StartSpeed, Frame, Actual, ClosedFormSpeed, Expected, PerStepSpeed));
+						}
+					}
+				}
+			}
+		}
+	}
+
+	TestEqual(TEXT("Frames where the closed form disagreed with the per step loop"), NumMismatches, 0);
+	AddInfo(FString::Printf(TEXT("%d frames compared"), NumCases));
+
+	return true;
+}
+
+#endif
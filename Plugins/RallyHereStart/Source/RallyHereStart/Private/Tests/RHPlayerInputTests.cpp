@@ -0,0 +1,288 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "GameFramework/RHPlayerInput.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int32 NumTestActions = 8;
+	const int32 NumTestAxes = 4;
+	const int32 NumRandomOperations = 500;
+
+	const TArray<FRHInputActionKeyMapping>& GetTestActionMappings(const FRHCustomInputActionKeyMappings& CustomMappings, EInputType InputType)
+	{
+		return InputType == EInputType::KBM ? CustomMappings.KBM_Mappings : InputType == EInputType::GP ? CustomMappings.GP_Mappings : CustomMappings.Touch_Mappings;
+	}
+
+	const TMap<float, FRHInputAxisKeyMappings>& GetTestAxisMappings(const FRHCustomInputAxisKeyMappings& CustomMappings, EInputType InputType)
+	{
+		return InputType == EInputType::KBM ? CustomMappings.KBM_Mappings : InputType == EInputType::GP ? CustomMappings.GP_Mappings : CustomMappings.Touch_Mappings;
+	}
+
+	const TArray<FKey>& GetTestKeyPool(EInputType InputType)
+	{
+		static const TArray<FKey> KBMKeys = { EKeys::A, EKeys::B, EKeys::C, EKeys::D, EKeys::E, EKeys::F, EKeys::Q, EKeys::W, EKeys::S, EKeys::SpaceBar, EKeys::LeftMouseButton, EKeys::RightMouseButton };
+		static const TArray<FKey> GPKeys = { EKeys::Gamepad_FaceButton_Bottom, EKeys::Gamepad_FaceButton_Right, EKeys::Gamepad_FaceButton_Left, EKeys::Gamepad_FaceButton_Top, EKeys::Gamepad_LeftShoulder, EKeys::Gamepad_RightShoulder, EKeys::Gamepad_DPad_Up, EKeys::Gamepad_DPad_Down };
+		static const TArray<FKey> TouchKeys = { EKeys::Touch1, EKeys::Touch2, EKeys::Touch3 };
+		return InputType == EInputType::KBM ? KBMKeys : InputType == EInputType::GP ? GPKeys : TouchKeys;
+	}
+
+	EInputType GetRandomInputType(FRandomStream& Random)
+	{
+		const int32 Roll = Random.RandRange(0, 2);
+		return Roll == 0 ? EInputType::KBM : Roll == 1 ? EInputType::GP : EInputType::Touch;
+	}
+
+	// Between one and two distinct keys from the input type's pool, chords only come up on gamepad
+	TArray<FKey> GetRandomKeys(FRandomStream& Random, EInputType InputType)
+	{
+		const TArray<FKey>& Pool = GetTestKeyPool(InputType);
+		TArray<FKey> Keys;
+		const int32 NumKeys = InputType == EInputType::GP ? Random.RandRange(1, 2) : 1;
+		while (Keys.Num() < NumKeys)
+		{
+			Keys.AddUnique(Pool[Random.RandRange(0, Pool.Num() - 1)]);
+		}
+		return Keys;
+	}
+
+	// The first action whose bindings match the keys, found by iterating every applied mapping
+	FName ScanActionWithKeys(const TMap<FName, FRHCustomInputActionKeyMappings>& AppliedMappings, const TArray<FRHInputActionKey>& Keys, EInputType InputType)
+	{
+		for (const TPair<FName, FRHCustomInputActionKeyMappings>& ActionMappingPair : AppliedMappings)
+		{
+			const TArray<FRHInputActionKeyMapping>& Mappings = GetTestActionMappings(ActionMappingPair.Value, InputType);
+			bool bMatches = false;
+			if (InputType == EInputType::GP)
+			{
+				bMatches = Keys.Num() > 0 && Keys.Num() == Mappings.Num();
+				for (const FRHInputActionKeyMapping& InputActionMapping : Mappings)
+				{
+					bMatches = bMatches && Keys.Contains(FRHInputActionKey(InputActionMapping.Mapping.Key, InputActionMapping.Type));
+				}
+			}
+			else
+			{
+				for (const FRHInputActionKeyMapping& InputActionMapping : Mappings)
+				{
+					bMatches = bMatches || Keys.Contains(FRHInputActionKey(InputActionMapping.Mapping.Key, InputActionMapping.Type));
+				}
+			}
+
+			if (bMatches)
+			{
+				return ActionMappingPair.Key;
+			}
+		}
+		return FName();
+	}
+
+	TPair<FName, float> ScanAxisWithKeys(const TMap<FName, FRHCustomInputAxisKeyMappings>& AppliedMappings, const TArray<FKey>& Keys, EInputType InputType)
+	{
+		for (const TPair<FName, FRHCustomInputAxisKeyMappings>& AxisMappingPair : AppliedMappings)
+		{
+			for (const TPair<float, FRHInputAxisKeyMappings>& Mappings : GetTestAxisMappings(AxisMappingPair.Value, InputType))
+			{
+				const TArray<FInputAxisKeyMapping>& AxisMappings = Mappings.Value.InputAxisKeyMappings;
+				bool bMatches = false;
+				if (InputType == EInputType::GP)
+				{
+					bMatches = Keys.Num() > 0 && Keys.Num() == AxisMappings.Num();
+					for (const FInputAxisKeyMapping& Mapping : AxisMappings)
+					{
+						bMatches = bMatches && Keys.Contains(Mapping.Key);
+					}
+				}
+				else
+				{
+					for (const FInputAxisKeyMapping& Mapping : AxisMappings)
+					{
+						bMatches = bMatches || Keys.Contains(Mapping.Key);
+					}
+				}
+
+				if (bMatches)
+				{
+					return TPair<FName, float>(AxisMappingPair.Key, Mappings.Key);
+				}
+			}
+		}
+		return TPair<FName, float>(FName(), 0.f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHPlayerInputKeyMappingIndexTest, "RallyHereStart.Input.KeyMappingIndex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHPlayerInputKeyMappingIndexTest::RunTest(const FString& Parameters)
+{
+	URHPlayerInput* PlayerInput = NewObject<URHPlayerInput>(GetTransientPackage());
+
+	// Start from a fixed set of bindings rather than whatever the project config provides, so the sequence is reproducible
+	TMap<FName, FRHCustomInputActionKeyMappings> DefaultActionMappings;
+	for (int32 i = 0; i < NumTestActions; ++i)
+	{
+		const FName Name(*FString::Printf(TEXT("RHTestAction_%d"), i));
+		const EInputActionType Type = (EInputActionType)(i % 3);
+		FRHCustomInputActionKeyMappings& Mappings = DefaultActionMappings.Add(Name);
+		Mappings.KBM_Mappings.Emplace(FInputActionKeyMapping(Name, GetTestKeyPool(EInputType::KBM)[i]), Type);
+		Mappings.GP_Mappings.Emplace(FInputActionKeyMapping(Name, GetTestKeyPool(EInputType::GP)[i]), Type);
+		if (i % 2 == 0)
+		{
+			Mappings.GP_Mappings.Emplace(FInputActionKeyMapping(Name, EKeys::Gamepad_LeftTrigger), Type);
+		}
+		Mappings.Touch_Mappings.Emplace(FInputActionKeyMapping(Name, GetTestKeyPool(EInputType::Touch)[i % 3]), Type);
+	}
+
+	TMap<FName, FRHCustomInputAxisKeyMappings> DefaultAxisMappings;
+	for (int32 i = 0; i < NumTestAxes; ++i)
+	{
+		const FName Name(*FString::Printf(TEXT("RHTestAxis_%d"), i));
+		FRHCustomInputAxisKeyMappings& Mappings = DefaultAxisMappings.Add(Name);
+		for (const float Scale : { 1.f, -1.f })
+		{
+			const int32 KeyIndex = NumTestActions + i * 2 + (Scale > 0.f ? 0 : 1);
+			Mappings.KBM_Mappings.Add(Scale).InputAxisKeyMappings.Emplace(Name, GetTestKeyPool(EInputType::KBM)[KeyIndex % GetTestKeyPool(EInputType::KBM).Num()], Scale);
+			Mappings.GP_Mappings.Add(Scale).InputAxisKeyMappings.Emplace(Name, GetTestKeyPool(EInputType::GP)[KeyIndex % GetTestKeyPool(EInputType::GP).Num()], Scale);
+		}
+	}
+
+	auto ResetToDefaults = [&]()
+	{
+		PlayerInput->AppliedActionKeyMappings = DefaultActionMappings;
+		PlayerInput->AppliedAxisKeyMappings = DefaultAxisMappings;
+		PlayerInput->RebuildKeyMappingIndex();
+	};
+	ResetToDefaults();
+
+	int32 NumChecked = 0;
+	int32 NumMismatches = 0;
+
+	// Runs every bound key set, each bound key on its own and a few arbitrary keys through both the index and a full scan
+	auto CheckLookups = [&](int32 Operation, FRandomStream& Random)
+	{
+		for (const EInputType InputType : { EInputType::KBM, EInputType::GP, EInputType::Touch })
+		{
+			TArray<TArray<FRHInputActionKey>> ActionQueries;
+			for (const TPair<FName, FRHCustomInputActionKeyMappings>& ActionMappingPair : PlayerInput->AppliedActionKeyMappings)
+			{
+				TArray<FRHInputActionKey>& BoundKeys = ActionQueries.AddDefaulted_GetRef();
+				for (const FRHInputActionKeyMapping& InputActionMapping : GetTestActionMappings(ActionMappingPair.Value, InputType))
+				{
+					BoundKeys.Emplace(InputActionMapping.Mapping.Key, InputActionMapping.Type);
+				}
+				for (const FRHInputActionKey& BoundKey : TArray<FRHInputActionKey>(BoundKeys))
+				{
+					ActionQueries.Add({ BoundKey });
+				}
+			}
+
+			TArray<TArray<FKey>> AxisQueries;
+			for (const TPair<FName, FRHCustomInputAxisKeyMappings>& AxisMappingPair : PlayerInput->AppliedAxisKeyMappings)
+			{
+				for (const TPair<float, FRHInputAxisKeyMappings>& Mappings : GetTestAxisMappings(AxisMappingPair.Value, InputType))
+				{
+					TArray<FKey>& BoundKeys = AxisQueries.AddDefaulted_GetRef();
+					for (const FInputAxisKeyMapping& Mapping : Mappings.Value.InputAxisKeyMappings)
+					{
+						BoundKeys.Add(Mapping.Key);
+					}
+					for (const FKey& BoundKey : TArray<FKey>(BoundKeys))
+					{
+						AxisQueries.Add({ BoundKey });
+					}
+				}
+			}
+
+			for (int32 i = 0; i < 3; ++i)
+			{
+				const TArray<FKey> RandomKeys = GetRandomKeys(Random, InputType);
+				AxisQueries.Add(RandomKeys);
+
+				TArray<FRHInputActionKey>& RandomActionKeys = ActionQueries.AddDefaulted_GetRef();
+				const EInputActionType Type = (EInputActionType)Random.RandRange(0, 2);
+				for (const FKey& Key : RandomKeys)
+				{
+					RandomActionKeys.Emplace(Key, Type);
+				}
+			}
+
+			for (const TArray<FRHInputActionKey>& Keys : ActionQueries)
+			{
+				const FName ScannedName = ScanActionWithKeys(PlayerInput->AppliedActionKeyMappings, Keys, InputType);
+				const FName IndexedName = PlayerInput->GetCustomInputActionWithKeys(Keys, InputType);
+				++NumChecked;
+				if (IndexedName != ScannedName)
+				{
+					++NumMismatches;
+					AddError(FString::Printf(TEXT("After operation %d the index returned action %s but a scan found %s"), Operation, *IndexedName.ToString(), *ScannedName.ToString()));
+				}
+			}
+
+			for (const TArray<FKey>& Keys : AxisQueries)
+			{
+				const TPair<FName, float> ScannedAxis = ScanAxisWithKeys(PlayerInput->AppliedAxisKeyMappings, Keys, InputType);
+				const TPair<FName, float> IndexedAxis = PlayerInput->GetCustomInputAxisWithKeys(Keys, InputType);
+				++NumChecked;
+				if (IndexedAxis.Key != ScannedAxis.Key || IndexedAxis.Value != ScannedAxis.Value)
+				{
+					++NumMismatches;
+					AddError(FString::Printf(TEXT("After operation %d the index returned axis %s (%f) but a scan found %s (%f)"), Operation, *IndexedAxis.Key.ToString(), IndexedAxis.Value, *ScannedAxis.Key.ToString(), ScannedAxis.Value));
+				}
+			}
+		}
+	};
+
+	FRandomStream Random(0x5EED);
+	TArray<FName> ActionNames, AxisNames;
+	DefaultActionMappings.GenerateKeyArray(ActionNames);
+	DefaultAxisMappings.GenerateKeyArray(AxisNames);
+
+	CheckLookups(0, Random);
+	for (int32 Operation = 1; Operation <= NumRandomOperations && NumMismatches == 0; ++Operation)
+	{
+		const EInputType InputType = GetRandomInputType(Random);
+		TArray<FName> ModifiedNames;
+
+		const int32 Roll = Random.RandRange(0, 99);
+		if (Roll < 45)
+		{
+			// Rebind an action, resolving conflicts with any action or axis already on the keys
+			TArray<FRHInputActionKey> Keys;
+			const EInputActionType Type = (EInputActionType)Random.RandRange(0, 2);
+			for (const FKey& Key : GetRandomKeys(Random, InputType))
+			{
+				Keys.Emplace(Key, Type);
+			}
+			PlayerInput->SetCustomInputActionKeyMapping(ActionNames[Random.RandRange(0, ActionNames.Num() - 1)], Keys, InputType, ModifiedNames);
+		}
+		else if (Roll < 75)
+		{
+			const float Scale = Random.RandRange(0, 1) == 0 ? 1.f : -1.f;
+			PlayerInput->SetCustomInputAxisKeyMapping(AxisNames[Random.RandRange(0, AxisNames.Num() - 1)], GetRandomKeys(Random, InputType), InputType, Scale, ModifiedNames);
+		}
+		else if (Roll < 85)
+		{
+			PlayerInput->SetCustomInputActionKeyMapping(ActionNames[Random.RandRange(0, ActionNames.Num() - 1)], TArray<FRHInputActionKey>(), InputType, ModifiedNames);
+		}
+		else if (Roll < 95)
+		{
+			const float Scale = Random.RandRange(0, 1) == 0 ? 1.f : -1.f;
+			PlayerInput->SetCustomInputAxisKeyMapping(AxisNames[Random.RandRange(0, AxisNames.Num() - 1)], TArray<FKey>(), InputType, Scale, ModifiedNames);
+		}
+		else
+		{
+			ResetToDefaults();
+		}
+
+		CheckLookups(Operation, Random);
+	}
+
+	AddInfo(FString::Printf(TEXT("Checked %d key mapping lookups, %d mismatches"), NumChecked, NumMismatches));
+	return NumMismatches == 0;
+}
+
+#endif
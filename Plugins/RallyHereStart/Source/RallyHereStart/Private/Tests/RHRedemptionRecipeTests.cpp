@@ -0,0 +1,283 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "Managers/RHUISessionManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Mocked catalog, vendors by id
+	typedef TMap<int32, FRHAPI_Vendor> FMockVendors;
+
+	FRHAPI_Loot MakeSubVendorLoot(int32 SortOrder, int32 SubVendorId)
+	{
+		FRHAPI_Loot Loot;
+		Loot.SetActive(true);
+		Loot.SetSortOrder(SortOrder);
+		Loot.SetSubVendorId(SubVendorId);
+		return Loot;
+	}
+
+	FRHAPI_Loot MakeItemLoot(int32 SortOrder, int32 ItemId, ERHAPI_InventoryOperation Operation, int32 Quantity)
+	{
+		FRHAPI_Loot Loot;
+		Loot.SetActive(true);
+		Loot.SetSortOrder(SortOrder);
+		Loot.SetItemId(ItemId);
+		Loot.SetInventoryOperation(Operation);
+		Loot.SetQuantity(Quantity);
+		return Loot;
+	}
+
+	void AddVendor(FMockVendors& Vendors, int32 VendorId, const TArray<FRHAPI_Loot>& Loot)
+	{
+		TMap<FString, FRHAPI_Loot> LootMap;
+		for (int32 i = 0; i < Loot.Num(); ++i)
+		{
+			LootMap.Add(FString::Printf(TEXT("%d_%d"), VendorId, i), Loot[i]);
+		}
+
+		FRHAPI_Vendor& Vendor = Vendors.Add(VendorId);
+		Vendor.SetLoot(LootMap);
+	}
+
+	// Synchronous port of the recursive URHUISessionManager::GetClaimableQuantity the flattened recipes replaced
+	int32 EvaluateRecursive(int32 VendorId, const FMockVendors& Vendors, const TMap<FRH_ItemId, int32>& InventoryCounts, TArray<int32>& VendorStack)
+	{
+		const FRHAPI_Vendor* Vendor = Vendors.Find(VendorId);
+		if (Vendor == nullptr || VendorStack.Contains(VendorId))
+		{
+			return 0;
+		}
+
+		TArray<FRHAPI_Loot> RecipeItems;
+		if (const auto& LootItems = Vendor->GetLootOrNull())
+		{
+			for (const auto& VendorItemPair : (*LootItems))
+			{
+				if (VendorItemPair.Value.GetActive(false))
+				{
+					RecipeItems.Add(VendorItemPair.Value);
+				}
+			}
+		}
+
+		RecipeItems.Sort([](const FRHAPI_Loot& A, const FRHAPI_Loot& B) { return (A.GetSortOrder(0) < B.GetSortOrder(0)); });
+
+		VendorStack.Push(VendorId);
+
+		int32 QuantityToRedeem = 0;
+		int32 Result = INDEX_NONE;
+
+		for (const FRHAPI_Loot& RecipeItem : RecipeItems)
+		{
+			if (RecipeItem.GetSubVendorId(0) != 0)
+			{
+				QuantityToRedeem = FMath::Max(QuantityToRedeem, EvaluateRecursive(RecipeItem.GetSubVendorId(0), Vendors, InventoryCounts, VendorStack));
+				continue;
+			}
+
+			if (RecipeItem.GetItemId(0) == 0)
+			{
+				continue;
+			}
+
+			const int32* FoundCount = InventoryCounts.Find(FRH_ItemId(RecipeItem.GetItemId(0)));
+			const int32 InventoryCount = FoundCount != nullptr ? *FoundCount : 0;
+			int32 NewQty = QuantityToRedeem;
+
+			switch (RecipeItem.GetInventoryOperation(ERHAPI_InventoryOperation::Invalid))
+			{
+				case ERHAPI_InventoryOperation::CheckLessThan:
+					if (InventoryCount >= RecipeItem.GetQuantity())
+					{
+						Result = QuantityToRedeem;
+					}
+					break;
+				case ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract:
+					if (InventoryCount > 0 && RecipeItem.GetQuantity() > 0)
+					{
+						NewQty = FMath::Max(QuantityToRedeem, InventoryCount / RecipeItem.GetQuantity());
+					}
+					// FALLTHROUGH
+				case ERHAPI_InventoryOperation::CheckGreaterThanOrEqual:
+					if (InventoryCount < RecipeItem.GetQuantity())
+					{
+						Result = QuantityToRedeem;
+					}
+					break;
+				case ERHAPI_InventoryOperation::Subtract:
+				case ERHAPI_InventoryOperation::Set:
+				case ERHAPI_InventoryOperation::Add:
+					Result = QuantityToRedeem > 0 ? QuantityToRedeem : 1;
+					break;
+				default:
+					break;
+			}
+
+			if (Result != INDEX_NONE)
+			{
+				break;
+			}
+
+			QuantityToRedeem = NewQty;
+		}
+
+		VendorStack.Pop();
+
+		return Result != INDEX_NONE ? Result : QuantityToRedeem;
+	}
+
+	int32 EvaluateFlattened(int32 VendorId, const FMockVendors& Vendors, const TMap<FRH_ItemId, int32>& InventoryCounts)
+	{
+		FRHRedemptionRecipe Recipe;
+		TSet<int32> ItemIds;
+		Recipe.Compile(VendorId, [&Vendors](int32 LookupVendorId, FRHAPI_Vendor& OutVendor)
+			{
+				if (const FRHAPI_Vendor* Vendor = Vendors.Find(LookupVendorId))
+				{
+					OutVendor = *Vendor;
+					return true;
+				}
+				return false;
+			}, ItemIds);
+
+		return Recipe.Evaluate(InventoryCounts);
+	}
+
+	int32 EvaluateReference(int32 VendorId, const FMockVendors& Vendors, const TMap<FRH_ItemId, int32>& InventoryCounts)
+	{
+		TArray<int32> VendorStack;
+		return EvaluateRecursive(VendorId, Vendors, InventoryCounts, VendorStack);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHRedemptionRecipeEvaluateTest, "RallyHereStart.SessionManager.RedemptionRecipeEvaluate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHRedemptionRecipeEvaluateTest::RunTest(const FString& Parameters)
+{
+	const int32 CheckedItemId = 100;
+	const int32 OtherItemId = 101;
+	const int32 GrantedItemId = 200;
+
+	// Early out, a failed check before the grant means nothing is claimed
+	{
+		FMockVendors Vendors;
+		AddVendor(Vendors, 1, {
+			MakeItemLoot(0, CheckedItemId, ERHAPI_InventoryOperation::CheckGreaterThanOrEqual, 2),
+			MakeItemLoot(1, GrantedItemId, ERHAPI_InventoryOperation::Add, 1) });
+
+		TestEqual(TEXT("Early out before the grant"), EvaluateFlattened(1, Vendors, { { FRH_ItemId(CheckedItemId), 1 } }), 0);
+		TestEqual(TEXT("Passed check reaches the grant"), EvaluateFlattened(1, Vendors, { { FRH_ItemId(CheckedItemId), 2 } }), 1);
+	}
+
+	// CheckGreaterThanOrEqualAndSubtract counts how many times the item can be consumed, and falls through to the plain check
+	{
+		FMockVendors Vendors;
+		AddVendor(Vendors, 1, {
+			MakeItemLoot(0, CheckedItemId, ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract, 2),
+			MakeItemLoot(1, GrantedItemId, ERHAPI_InventoryOperation::Add, 1) });
+
+		TestEqual(TEXT("Subtract check claims count / quantity times"), EvaluateFlattened(1, Vendors, { { FRH_ItemId(CheckedItemId), 7 } }), 3);
+		TestEqual(TEXT("Subtract check below quantity early outs"), EvaluateFlattened(1, Vendors, { { FRH_ItemId(CheckedItemId), 1 } }), 0);
+	}
+
+	// Grant claims at least once, even when nothing was counted before it
+	{
+		FMockVendors Vendors;
+		AddVendor(Vendors, 1, { MakeItemLoot(0, GrantedItemId, ERHAPI_InventoryOperation::Add, 1) });
+
+		TestEqual(TEXT("Grant claims at least once"), EvaluateFlattened(1, Vendors, {}), 1);
+	}
+
+	// Nested blocks fold back in with max, and an early out inside one only ends that block
+	{
+		FMockVendors Vendors;
+		AddVendor(Vendors, 1, {
+			MakeItemLoot(0, OtherItemId, ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract, 1),
+			MakeSubVendorLoot(1, 2),
+			MakeSubVendorLoot(2, 3),
+			MakeItemLoot(3, GrantedItemId, ERHAPI_InventoryOperation::Add, 1) });
+		AddVendor(Vendors, 2, {
+			MakeItemLoot(0, CheckedItemId, ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract, 1),
+			MakeItemLoot(1, GrantedItemId, ERHAPI_InventoryOperation::Add, 1) });
+		AddVendor(Vendors, 3, {
+			MakeItemLoot(0, CheckedItemId, ERHAPI_InventoryOperation::CheckLessThan, 1),
+			MakeItemLoot(1, GrantedItemId, ERHAPI_InventoryOperation::Add, 1) });
+
+		TestEqual(TEXT("Nested block quantity wins when larger"), EvaluateFlattened(1, Vendors, { { FRH_ItemId(OtherItemId), 1 }, { FRH_ItemId(CheckedItemId), 4 } }), 4);
+		TestEqual(TEXT("Outer quantity wins when larger"), EvaluateFlattened(1, Vendors, { { FRH_ItemId(OtherItemId), 5 }, { FRH_ItemId(CheckedItemId), 2 } }), 5);
+		TestEqual(TEXT("Early out in a nested block continues the outer block"), EvaluateFlattened(1, Vendors, { { FRH_ItemId(OtherItemId), 1 } }), 1);
+	}
+
+	// Randomized recipe trees against the recursive evaluator
+	const ERHAPI_InventoryOperation Operations[] =
+	{
+		ERHAPI_InventoryOperation::CheckLessThan,
+		ERHAPI_InventoryOperation::CheckGreaterThanOrEqualAndSubtract,
+		ERHAPI_InventoryOperation::CheckGreaterThanOrEqual,
+		ERHAPI_InventoryOperation::Add,
+		ERHAPI_InventoryOperation::Subtract,
+		ERHAPI_InventoryOperation::Invalid,
+	};
+
+	const int32 NumCases = 2000;
+	const int32 NumVendors = 6;
+	const int32 NumItemIds = 5;
+
+	FRandomStream Random(NumCases);
+	int32 NumMismatches = 0;
+
+	for (int32 Case = 0; Case < NumCases; ++Case)
+	{
+		FMockVendors Vendors;
+		for (int32 VendorId = 1; VendorId <= NumVendors; ++VendorId)
+		{
+			TArray<FRHAPI_Loot> Loot;
+			const int32 NumLoot = Random.RandRange(1, 5);
+			for (int32 i = 0; i < NumLoot; ++i)
+			{
+				// Sub vendors only point at higher ids, the compile time cycle guard is not part of the old semantics
+				if (VendorId < NumVendors && Random.FRand() < 0.25f)
+				{
+					Loot.Add(MakeSubVendorLoot(Random.RandRange(0, 10), Random.RandRange(VendorId + 1, NumVendors)));
+				}
+				else
+				{
+					Loot.Add(MakeItemLoot(Random.RandRange(0, 10), Random.RandRange(1, NumItemIds), Operations[Random.RandHelper(UE_ARRAY_COUNT(Operations))], Random.RandRange(0, 4)));
+				}
+
+				Loot.Last().SetActive(Random.FRand() < 0.9f);
+			}
+			AddVendor(Vendors, VendorId, Loot);
+		}
+
+		TMap<FRH_ItemId, int32> InventoryCounts;
+		for (int32 ItemId = 1; ItemId <= NumItemIds; ++ItemId)
+		{
+			if (Random.FRand() < 0.8f)
+			{
+				InventoryCounts.Add(FRH_ItemId(ItemId), Random.RandRange(0, 9));
+			}
+		}
+
+		const int32 Expected = EvaluateReference(1, Vendors, InventoryCounts);
+		const int32 Actual = EvaluateFlattened(1, Vendors, InventoryCounts);
+		if (Expected != Actual)
+		{
+			if (NumMismatches == 0)
+			{
+				AddError(FString::Printf(TEXT("Case %d: flattened recipe claimed %d, recursive evaluation claimed %d"), Case, Actual, Expected));
+			}
+			++NumMismatches;
+		}
+	}
+
+	TestEqual(TEXT("Randomized recipes that disagree with the recursive evaluation"), NumMismatches, 0);
+
+	return true;
+}
+
+#endif
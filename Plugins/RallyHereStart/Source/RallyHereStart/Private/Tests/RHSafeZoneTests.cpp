@@ -0,0 +1,64 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CoreDelegates.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Shared/Widgets/RHSafeZone.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHSafeZoneRefreshBenchmarkTest, "RallyHereStart.UI.SafeZoneRefresh", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FRHSafeZoneRefreshBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int32 NumSafeZones = 5000;
+
+	if (!FSlateApplication::IsInitialized())
+	{
+		AddWarning(TEXT("Slate is not initialized, safe zones cannot build their widgets"));
+		return true;
+	}
+
+	const int32 NumRegisteredBefore = URHSafeZone::GetNumRegisteredSafeZones();
+
+	TArray<URHSafeZone*> SafeZones;
+	SafeZones.Reserve(NumSafeZones);
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumSafeZones; ++i)
+	{
+		URHSafeZone* SafeZone = NewObject<URHSafeZone>(GetTransientPackage());
+		SafeZone->AddToRoot();
+		SafeZone->TakeWidget();
+		SafeZones.Add(SafeZone);
+	}
+	const double BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	TestEqual(TEXT("Safe zones registered once their widget was built"), URHSafeZone::GetNumRegisteredSafeZones(), NumRegisteredBefore + NumSafeZones);
+
+	// What a safe frame change on device rotation or a display change costs
+	StartTime = FPlatformTime::Seconds();
+	FCoreDelegates::OnSafeFrameChangedEvent.Broadcast();
+	const double SafeFrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	// What changing rh.SafeZone.DrawBorders costs
+	StartTime = FPlatformTime::Seconds();
+	URHSafeZone::RefreshAllBorders();
+	const double BordersMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	for (URHSafeZone* SafeZone : SafeZones)
+	{
+		SafeZone->ReleaseSlateResources(true);
+		SafeZone->RemoveFromRoot();
+	}
+
+	TestEqual(TEXT("Safe zones unregistered once their widget was released"), URHSafeZone::GetNumRegisteredSafeZones(), NumRegisteredBefore);
+
+	AddInfo(FString::Printf(TEXT("%d safe zones: build %.2f ms, safe frame change %.2f ms, border refresh %.2f ms"),
+		NumSafeZones, BuildMs, SafeFrameMs, BordersMs));
+
+	return true;
+}
+
+#endif
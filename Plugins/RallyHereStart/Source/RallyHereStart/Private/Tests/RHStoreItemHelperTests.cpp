@@ -0,0 +1,224 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RallyHereStart.h"
+#include "Misc/AutomationTest.h"
+#include "Managers/RHStoreItemHelper.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Mocked catalog, vendors by id
+	typedef TMap<int32, FRHAPI_Vendor> FMockVendors;
+
+	struct FWalkedVendor
+	{
+		TArray<FRH_LootId> LootIds;
+		TSet<FRH_ItemId> DirectGrantedItemIds;
+		TSet<FRH_ItemId> GrantedItemIds;
+	};
+
+	bool GrantsItem(const FRHAPI_Loot& Loot)
+	{
+		const ERHAPI_InventoryOperation InventoryOperation = Loot.GetInventoryOperation(ERHAPI_InventoryOperation::Invalid);
+		return Loot.GetItemId(0) != 0 &&
+			(InventoryOperation == ERHAPI_InventoryOperation::Add || (InventoryOperation == ERHAPI_InventoryOperation::Set && Loot.GetQuantity(0) > 0));
+	}
+
+	// Synchronous port of the recursive sub vendor walk in URHStoreItemHelper::GetLootIdsForVendor the closures replaced, with unloaded vendors empty
+	void WalkVendor(int32 VendorId, const FMockVendors& Vendors, const TSet<int32>& LoadedVendorIds, FWalkedVendor& OutWalked, TArray<int32>& VendorStack)
+	{
+		const FRHAPI_Vendor* Vendor = Vendors.Find(VendorId);
+		if (Vendor == nullptr || !LoadedVendorIds.Contains(VendorId) || VendorStack.Contains(VendorId))
+		{
+			return;
+		}
+
+		VendorStack.Push(VendorId);
+
+		if (const auto& LootItems = Vendor->GetLootOrNull())
+		{
+			for (const auto& pItemPair : (*LootItems))
+			{
+				if (!pItemPair.Value.GetActive(false))
+				{
+					continue;
+				}
+
+				if (VendorStack.Num() == 1 && GrantsItem(pItemPair.Value))
+				{
+					OutWalked.DirectGrantedItemIds.Add(FRH_ItemId(pItemPair.Value.GetItemId(0)));
+				}
+
+				if (pItemPair.Value.GetSubVendorId(0) != 0)
+				{
+					WalkVendor(pItemPair.Value.GetSubVendorId(0), Vendors, LoadedVendorIds, OutWalked, VendorStack);
+				}
+				else
+				{
+					OutWalked.LootIds.AddUnique(FRH_LootId(pItemPair.Value.GetLootId()));
+
+					if (GrantsItem(pItemPair.Value))
+					{
+						OutWalked.GrantedItemIds.Add(FRH_ItemId(pItemPair.Value.GetItemId(0)));
+					}
+				}
+			}
+		}
+
+		VendorStack.Pop();
+	}
+
+	// Random vendors with item and sub vendor loot, sub vendors only point at higher ids unless cycles are allowed
+	void MakeRandomVendors(FRandomStream& Random, int32 NumVendors, bool bAllowCycles, FMockVendors& OutVendors)
+	{
+		static const ERHAPI_InventoryOperation Operations[] = { ERHAPI_InventoryOperation::Add, ERHAPI_InventoryOperation::Set, ERHAPI_InventoryOperation::Subtract };
+
+		for (int32 VendorId = 1; VendorId <= NumVendors; ++VendorId)
+		{
+			TMap<FString, FRHAPI_Loot> LootMap;
+			const int32 NumLoot = Random.RandRange(0, 5);
+			for (int32 i = 0; i < NumLoot; ++i)
+			{
+				FRHAPI_Loot Loot;
+				Loot.SetActive(Random.FRand() < 0.9f);
+
+				const int32 MinSubVendorId = bAllowCycles ? 1 : VendorId + 1;
+				if (MinSubVendorId <= NumVendors && Random.FRand() < 0.4f)
+				{
+					Loot.SetSubVendorId(Random.RandRange(MinSubVendorId, NumVendors));
+				}
+				else
+				{
+					Loot.SetLootId(FGuid::NewGuid());
+					Loot.SetItemId(Random.RandRange(1, 20));
+					Loot.SetInventoryOperation(Operations[Random.RandHelper(UE_ARRAY_COUNT(Operations))]);
+					Loot.SetQuantity(Random.RandRange(0, 2));
+				}
+
+				LootMap.Add(FString::Printf(TEXT("%d_%d"), VendorId, i), Loot);
+			}
+
+			OutVendors.Add(VendorId).SetLoot(LootMap);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHVendorClosureBuildTest, "RallyHereStart.Store.VendorClosureBuild", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHVendorClosureBuildTest::RunTest(const FString& Parameters)
+{
+	const int32 NumGraphs = 200;
+	const int32 NumVendors = 30;
+
+	FRandomStream Random(NumGraphs);
+
+	int32 NumLootMismatches = 0;
+	int32 NumItemMismatches = 0;
+	int32 NumStaleClosures = 0;
+
+	for (int32 Graph = 0; Graph < NumGraphs; ++Graph)
+	{
+		// Cycles make the order loot is found in depend on where the walk starts, so only acyclic vendors compare in order
+		const bool bAllowCycles = (Graph % 2) == 1;
+
+		FMockVendors Vendors;
+		MakeRandomVendors(Random, NumVendors, bAllowCycles, Vendors);
+
+		TSet<int32> LoadedVendorIds;
+		for (int32 VendorId = 1; VendorId <= NumVendors; ++VendorId)
+		{
+			if (Random.FRand() < 0.8f)
+			{
+				LoadedVendorIds.Add(VendorId);
+			}
+		}
+
+		TMap<int32, FRHVendorClosure> Closures;
+		FRHVendorClosure UncachedClosure;
+
+		auto CheckAllVendors = [&]()
+		{
+			TArray<int32> QueryOrder;
+			for (int32 VendorId = 1; VendorId <= NumVendors; ++VendorId)
+			{
+				QueryOrder.Insert(VendorId, Random.RandHelper(QueryOrder.Num() + 1));
+			}
+
+			// Every query shares the closures earlier queries cached, which have to be right wherever they are reached from
+			for (int32 VendorId : QueryOrder)
+			{
+				const FRHVendorClosure* Closure = FRHVendorClosure::Build(VendorId, [&Vendors, &LoadedVendorIds](int32 LookupVendorId, FRHAPI_Vendor& OutVendor)
+					{
+						if (LoadedVendorIds.Contains(LookupVendorId))
+						{
+							OutVendor = Vendors.FindChecked(LookupVendorId);
+							return true;
+						}
+						return false;
+					}, Closures, UncachedClosure);
+
+				FWalkedVendor Walked;
+				TArray<int32> VendorStack;
+				WalkVendor(VendorId, Vendors, LoadedVendorIds, Walked, VendorStack);
+
+				if (Closure == nullptr)
+				{
+					++NumLootMismatches;
+					continue;
+				}
+
+				const bool bLootMatches = bAllowCycles
+					? (Closure->LootIds.Num() == Walked.LootIds.Num() && Closure->LootIds.Includes(TSet<FRH_LootId>(Walked.LootIds)))
+					: Closure->LootIds.Array() == Walked.LootIds;
+
+				NumLootMismatches += bLootMatches ? 0 : 1;
+				NumItemMismatches += (Closure->GrantedItemIds.Num() == Walked.GrantedItemIds.Num() && Closure->GrantedItemIds.Includes(Walked.GrantedItemIds)
+					&& Closure->DirectGrantedItemIds.Num() == Walked.DirectGrantedItemIds.Num() && Closure->DirectGrantedItemIds.Includes(Walked.DirectGrantedItemIds)) ? 0 : 1;
+			}
+		};
+
+		CheckAllVendors();
+
+		// Nothing built on an unloaded vendor may have been cached
+		for (const TPair<int32, FRHVendorClosure>& Pair : Closures)
+		{
+			TArray<int32> Reachable = { Pair.Key };
+			for (int32 i = 0; i < Reachable.Num(); ++i)
+			{
+				if (!LoadedVendorIds.Contains(Reachable[i]))
+				{
+					++NumStaleClosures;
+					break;
+				}
+
+				if (const auto& LootItems = Vendors.FindChecked(Reachable[i]).GetLootOrNull())
+				{
+					for (const auto& pItemPair : (*LootItems))
+					{
+						if (pItemPair.Value.GetActive(false) && pItemPair.Value.GetSubVendorId(0) != 0)
+						{
+							Reachable.AddUnique(pItemPair.Value.GetSubVendorId(0));
+						}
+					}
+				}
+			}
+		}
+
+		// The rest of the vendors arrive, everything still cached has to be as right as a fresh build
+		for (int32 VendorId = 1; VendorId <= NumVendors; ++VendorId)
+		{
+			LoadedVendorIds.Add(VendorId);
+		}
+
+		CheckAllVendors();
+	}
+
+	TestEqual(TEXT("Closures whose loot ids disagreed with walking the sub vendors"), NumLootMismatches, 0);
+	TestEqual(TEXT("Closures whose granted item ids disagreed with walking the sub vendors"), NumItemMismatches, 0);
+	TestEqual(TEXT("Cached closures that reach an unloaded vendor"), NumStaleClosures, 0);
+
+	return true;
+}
+
+#endif
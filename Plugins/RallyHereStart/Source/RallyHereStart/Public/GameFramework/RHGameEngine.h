@@ -1,8 +1,48 @@
 #pragma once
 
 #include "Engine/GameEngine.h"
+#include "Engine/World.h"
 #include "RHGameEngine.generated.h"
 
+class AGameModeBase;
+class APlayerController;
+
+// Phases of a map load, in the order they are normally reached
+enum class ERHMapLoadPhase : uint8
+{
+    TravelStart,
+    PackageLoad,
+    WorldInit,
+    GameModeInitGame,
+    FirstFrame,
+    FirstPlayerLogin,
+    MAX
+};
+
+// Timeline of the most recent map load, all times are in seconds since TravelStart (negative if the phase was not reached)
+struct RALLYHERESTART_API FRHMapLoadTimeline
+{
+    FRHMapLoadTimeline() { Reset(); }
+
+    void Reset();
+    void MarkPhase(ERHMapLoadPhase Phase);
+    void SampleMemory();
+
+    bool HasReachedPhase(ERHMapLoadPhase Phase) const { return PhaseTimes[(int32)Phase] >= 0.0; }
+    double GetPhaseTime(ERHMapLoadPhase Phase) const { return PhaseTimes[(int32)Phase]; }
+    static const TCHAR* GetPhaseName(ERHMapLoadPhase Phase);
+
+    FString MapName;
+    double StartTimeSeconds;
+    double PhaseTimes[(int32)ERHMapLoadPhase::MAX];
+
+    uint64 StartMemoryBytes;
+    uint64 PeakMemoryBytes;
+
+    int32 PackagesLoaded;
+    uint64 PackageBytesLoaded;
+};
+
 UCLASS(config=Engine)
 class RALLYHERESTART_API URHGameEngine : public UGameEngine
 {
@@ -18,13 +58,30 @@ public:
     // Gets Telemetry collector so client can access recorded stats
     const TSharedPtr<class FPCom_RuntimeTelemetryCollector>& GetTelemetryCollector() { return RuntimeTelemetryCollector; }
 
+    // Gets the phase timeline of the most recent map load
+    const FRHMapLoadTimeline& GetMapLoadTimeline() const { return MapLoadTimeline; }
+
 protected:
     virtual void OnPostLoadMapWithWorld(UWorld* pWorld);
 
+    void OnPreWorldInitialization(UWorld* pWorld, const UWorld::InitializationValues IVS);
+    void OnPostWorldInitialization(UWorld* pWorld, const UWorld::InitializationValues IVS);
+    void OnGameModeInitialized(AGameModeBase* pGameMode);
+    void OnGameModePostLogin(AGameModeBase* pGameMode, APlayerController* pNewPlayer);
+    void OnEndLoadPackage(const FEndLoadPackageContext& Context);
+
+    // Marks a load phase and passes the updated timeline on to the telemetry collector
+    void MarkMapLoadPhase(ERHMapLoadPhase Phase);
+
 private:
     bool ShouldCollectRuntimeTelemetry() { return (IsRunningDedicatedServer() || IsRunningGame()); }
     virtual void CreateRuntimeTelemetryCollector(class UWorld* pWorld);
 
     // stats collector with hooks to send stats to DB/file for use by operations
     TSharedPtr<class FPCom_RuntimeTelemetryCollector> RuntimeTelemetryCollector;
+
+    FRHMapLoadTimeline MapLoadTimeline;
+
+    // True from the start of LoadMap until the first frame after it has been ticked
+    bool bIsTrackingMapLoad;
 };
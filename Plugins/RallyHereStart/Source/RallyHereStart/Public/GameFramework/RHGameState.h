@@ -12,4 +12,22 @@ class RALLYHERESTART_API ARHGameState : public AGameState
 public:
     virtual void AddPlayerState(APlayerState* PlayerState) override;
     virtual void RemovePlayerState(APlayerState* PlayerState) override;
+
+    // Number of active, non-bot player states, kept up to date as player states are added and removed
+    int32 GetNumHumanPlayers() const { return HumanPlayers.Num(); }
+
+    // A match counts as using multiplayer features once it has at least this many human players
+    static const int32 MultiplayerFeaturesPlayerCount = 2;
+    bool IsUsingMultiplayerFeatures() const { return GetNumHumanPlayers() >= MultiplayerFeaturesPlayerCount; }
+
+    // Re-evaluates whether a player state counts as human, for when its bot or inactive flag is set after it was added
+    void RefreshHumanPlayer(APlayerState* PlayerState);
+
+protected:
+    void SetIsHumanPlayer(APlayerState* PlayerState, bool bIsHuman);
+
+    // Called when the human player count crosses MultiplayerFeaturesPlayerCount, updates the OSS flag for the local players
+    virtual void OnUsingMultiplayerFeaturesChanged();
+
+    TSet<TWeakObjectPtr<APlayerState>> HumanPlayers;
 };
\ No newline at end of file
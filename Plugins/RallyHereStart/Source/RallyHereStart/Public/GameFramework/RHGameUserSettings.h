@@ -2,6 +2,8 @@
 
 #include "GameFramework/GameUserSettings.h"
 #include "GameFramework/SaveGame.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
 #include "RH_Properties.h"
 #include "RHGameUserSettings.generated.h"
 
@@ -152,14 +154,22 @@ public:
 	void RevertSettingsToDefault();
 	void ApplySavedSettings();
     virtual void LoadSettings(bool bForceReload = false) override;
+	// Schedules a save, saves requested within the debounce window are coalesced into a single write
 	virtual void SaveSettings() override;
 
+	// Waits for any in flight slot write, then immediately writes any scheduled save. Used on shutdown and suspend so no change is lost.
+	void FlushPendingSave();
+
+	// Number of save requests that were folded into an already scheduled write
+	FORCEINLINE int32 GetNumCoalescedSaves() const { return NumCoalescedSaves; }
+
 protected:
 	bool bIsLoading;
 
 public:
     virtual bool LoadSaveGameConfig();
-    virtual bool SaveSaveGameConfig();
+	// On save game platforms the snapshot is written to the slot on a worker thread, unless bWaitForWrite is set
+    virtual bool SaveSaveGameConfig(bool bWaitForWrite = false);
 
 	bool GetDefaultSettingAsBool(const FName& Name, bool& OutBool) const;
 	bool GetDefaultSettingAsInt(const FName& Name, int32& OutInt) const;
@@ -198,6 +208,9 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SaveLocalAction(const FName& Name);
 
+	// Marks several action names as saved locally with a single settings save
+	void SaveLocalActions(const TArray<FName>& Names);
+
 	UFUNCTION(BlueprintPure)
 	bool IsLocalActionSaved(const FName& Name) const { return SavedLocalActions.Contains(Name); }
 
@@ -421,6 +434,33 @@ protected:
 	TMap<FName, FCachedSettingValue> AppliedSettingsConfig;
 	TMap<FName, FApplySettingFunctionPtr> ApplySettingFunctionMap;
 
+private:
+	bool HandleSaveDebounceElapsed(float DeltaTime);
+	void WriteSettings(bool bWaitForWrite);
+
+	// Returns false on platforms that persist settings through config instead of a save game slot
+	bool GetSaveGameSlot(FString& OutSlotName, int32& OutUserIndex) const;
+	URHSettingsSaveGame* CreateSaveGameSnapshot() const;
+	bool SerializeSaveGameSnapshot(TArray<uint8>& OutSaveData) const;
+	void HandleSlotWriteComplete(int32 WriteSerial, bool bSuccess);
+	// Blocks until the slot write on the worker has finished, so nothing older can land after the next write
+	void WaitForSlotWrite();
+
+	bool bSavePending;
+	int32 NumCoalescedSaves;
+	FTSTicker::FDelegateHandle SaveDebounceHandle;
+
+	// Only one async slot write runs at a time, saves requested meanwhile are chained after it
+	TFuture<bool> SlotWriteResult;
+	bool bSlotWriteQueued;
+	// Bumped whenever a write is started or waited on, so a completion for an older write is ignored
+	int32 SlotWriteSerial;
+
+	// Lets automation tests use the save game slot path on platforms that persist settings through config, only honored in builds with dev automation tests
+	FString TestSaveGameSlotName;
+
+	friend class FRHGameUserSettingsSaveFlushTest;
+
 public:
 	UPROPERTY(BlueprintAssignable, Category = "Settings")
 	FOnGamepadIconSetSettingsApplied OnGamepadIconSetSettingsApplied;
@@ -8,6 +8,37 @@
 
 class UCurveVector;
 
+// Piecewise linear bake of the X and Y float curves of a UCurveVector, so per sub-step lookups don't walk the rich curve keys
+struct FRHBakedLookCurve
+{
+	void Bake(const UCurveVector* Curve, int32 NumSamples, const FVector2D& Scale = FVector2D(1.f, 1.f));
+	void Reset();
+	bool IsValid() const { return SamplesX.Num() > 1 && SamplesX.Num() == SamplesY.Num(); }
+
+	// Evaluates the X curve at Time.X and the Y curve at Time.Y
+	FVector2D Eval(const FVector2D& Time) const;
+
+private:
+	static float EvalSamples(const TArray<float>& Samples, float SampleMinTime, float SampleInvStep, float Time);
+
+	TArray<float> SamplesX;
+	TArray<float> SamplesY;
+	FVector2D MinTime = FVector2D::ZeroVector;
+	FVector2D InvStep = FVector2D::ZeroVector;
+};
+
+// Base velocity look for one axis over a frame of constant input. The fixed-timestep sub-steps reduce to a clamped linear ramp, which is summed in closed form.
+struct FRHBaseVelocityLookAxis
+{
+	// Integrates the axis over NumSteps steps of Step seconds plus a trailing step of Remainder seconds, returning the distance covered and updating the axis' current speed
+	static float Integrate(float AbsInput, float Dir, float BaseSpeed, float BoostedSpeed, float BoostThreshold, float BoostAcceleration, float Step, int32 NumSteps, float Remainder, float& InOutSpeed, float& OutAcceleration);
+
+private:
+	// Sums the speed after each of NumSteps steps of Step seconds, plus a trailing step of Remainder seconds, where the speed after
+	// each step is Min(StartSpeed + Accel * ElapsedTime, MaxSpeed). This is the same total as integrating the steps one at a time.
+	static float IntegrateBoostRamp(float StartSpeed, float MaxSpeed, float Accel, float Step, int32 NumSteps, float Remainder, float& OutEndSpeed);
+};
+
 /**
  * 
  */
@@ -71,8 +102,17 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Curve|No Base", meta = (EditCondition = "!bUseBaseVelocity"))
 	UCurveVector* MouseLookAccelerationADSCurve;
 
+	// Number of samples each look curve is baked into, higher values track curve tangents more closely
+	UPROPERTY(EditDefaultsOnly, Category = "Curve", AdvancedDisplay, meta = (ClampMin = "2", ClampMax = "4096"))
+	int32 LookCurveTableResolution;
+
 	float GetFOVScaling(ARHPlayerController* pPlayerController) const;
 
+	// Pulls sensitivity and boost settings from the player input, then rebakes the look curve tables if anything they depend on changed
+	void RefreshLookSettings(const class URHPlayerInput* PlayerInput);
+	void RebuildLookCurveTables();
+	FORCEINLINE void MarkLookCurveTablesDirty() { bLookCurveTablesDirty = true; }
+
     UPROPERTY(EditDefaultsOnly, Category = "Curve|BaseVelocity", AdvancedDisplay, meta = (EditCondition = "bUseBaseVelocity"))
     TMap<FName, UCurveVector*> TestBaseVelocityCurves;
 
@@ -87,6 +127,19 @@ private:
     UPROPERTY(Transient)
     FVector2D CurrentTurnSpeed;
 
+    FRHBakedLookCurve BaseVelocityTable;
+    // Base velocity scaled by BoostMultiplier, the speed boosted input accelerates towards
+    FRHBakedLookCurve BoostedVelocityTable;
+    FRHBakedLookCurve MaxVelocityTable;
+    FRHBakedLookCurve AccelerationTable;
+
+    bool bLookCurveTablesDirty;
+
+    // Sensitivity as of the last player input settings revision we saw
+    FVector2D CachedSensitivity;
+    uint32 CachedSettingsRevision;
+    bool bHasCachedSettings;
+
 
 private:
 	static bool StickAimDebug;
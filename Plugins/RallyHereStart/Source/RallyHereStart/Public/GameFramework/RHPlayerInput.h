@@ -263,6 +263,30 @@ struct FRHCustomInputAxisKeyMappings
 	}
 };
 
+// A key bound for one input type, used as the key of URHPlayerInput's reverse binding index. Axis bindings always use Press.
+struct FRHKeyBindingIndexKey
+{
+	FKey Key;
+	EInputType InputType;
+	EInputActionType ActionType;
+
+	FRHKeyBindingIndexKey(const FKey& InKey, EInputType InInputType, EInputActionType InActionType = EInputActionType::Press)
+		: Key(InKey)
+		, InputType(InInputType)
+		, ActionType(InActionType)
+	{}
+
+	bool operator==(const FRHKeyBindingIndexKey& Other) const
+	{
+		return Key == Other.Key && InputType == Other.InputType && ActionType == Other.ActionType;
+	}
+
+	friend uint32 GetTypeHash(const FRHKeyBindingIndexKey& IndexKey)
+	{
+		return HashCombine(GetTypeHash(IndexKey.Key), ((uint32)IndexKey.InputType << 8) | (uint32)IndexKey.ActionType);
+	}
+};
+
 typedef void(URHPlayerInput::*FApplyInputSettingFunctionPtr)(const FName&);
 
 UCLASS(config=Input, defaultconfig)
@@ -316,9 +340,14 @@ public:
 
 	bool RevertSettingToDefault(const FName& Name);
 
+	// Incremented whenever an applied setting changes, so systems can cache derived values between changes
+	FORCEINLINE uint32 GetSettingsRevision() const { return SettingsRevision; }
+
 private:
 	void CallApplySettingFunction(const FName& Name);
 
+	uint32 SettingsRevision = 0;
+
 public:
 	// Custom Apply Setting Names
 	static const FName MouseDoubleClickTime;
@@ -447,6 +476,25 @@ private:
     void ResolveCustomInputActionKeyMappingConflicts(const TArray<FRHInputActionKey>& ConflictingKeys, const TArray<FRHInputActionKey>& ReplacementKeys, EInputType InputType, TArray<FName>& OutModifiedKeybindNames);
     void ResolveCustomInputAxisKeyMappingConflicts(const TArray<FKey>& ConflictingKeys, const TArray<FKey>& ReplacementKeys, EInputType InputType, TArray<FName>& OutModifiedKeybindNames);
 
+	// Updates the reverse binding index for a single name, must be called after any change to its applied mappings
+	void ReindexCustomActionKeyMappings(const FName& Name);
+	void ReindexCustomAxisKeyMappings(const FName& Name);
+	void RebuildKeyMappingIndex();
+
+	// Names bound to any of the keys, in the same order as iterating the applied mappings
+	void GetIndexedActionNamesForKeys(const TArray<FRHInputActionKey>& Keys, EInputType InputType, TArray<FName>& OutNames) const;
+	void GetIndexedAxisNamesForKeys(const TArray<FKey>& Keys, EInputType InputType, TArray<FName>& OutNames) const;
+
+	// Reverse index from bound keys to the applied action and axis names using them.
+	// Entries may be stale after a name loses a key until it is reindexed, so candidates are always checked against the applied mappings.
+	TMap<FRHKeyBindingIndexKey, TArray<FName>> ActionNamesByKey;
+	TMap<FRHKeyBindingIndexKey, TArray<FName>> AxisNamesByKey;
+	// Keys each name was last indexed under, so reindexing a name only touches its own buckets
+	TMap<FName, TArray<FRHKeyBindingIndexKey>> IndexedActionKeys;
+	TMap<FName, TArray<FRHKeyBindingIndexKey>> IndexedAxisKeys;
+
+	friend class FRHPlayerInputKeyMappingIndexTest;
+
 public:
     void GetSoloInputActionKeyMappings(const TArray<FName>& MappingNames, TArray<TPair<FName, FRHInputActionKey>>& OutSoloMappings);
     void GetChordInputActionKeyMappings(const TArray<FName>& MappingNames, TArray<TPair<FName, TArray<FRHInputActionKey>>>& OutChordMappings);
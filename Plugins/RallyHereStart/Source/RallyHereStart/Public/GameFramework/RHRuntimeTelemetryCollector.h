@@ -86,6 +86,10 @@ public:
 
     FOnTelemetrySampledNative& OnTelemetrySampledNative() { return OnTelemetrySampledNativeDel; }
 
+    // Records the phase timeline of the map load this collector is tracking, and writes it to the log file
+    virtual void RecordMapLoadTimeline(const FRHMapLoadTimeline& InTimeline);
+    const FRHMapLoadTimeline& GetMapLoadTimeline() const { return MapLoadTimeline; }
+
     const FString& GetTelemetryId() const { return TelemetryId; }
     const UWorld* GetWorld() const { return ParentWorld.Get(); }
 
@@ -114,6 +118,8 @@ protected:
     // Simple counter used to determine when seconds roll over
     int32 CurrentSecondCounter;
 
+    FRHMapLoadTimeline MapLoadTimeline;
+
     // initializes LogFeatures from ELogFlagsFromCore
     virtual void InitFeaturesFromConfig();
 
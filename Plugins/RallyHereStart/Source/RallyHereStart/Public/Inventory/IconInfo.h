@@ -26,6 +26,9 @@ public:
 	virtual TSoftObjectPtr<UTexture2D> GetSoftItemIcon() const { return TSoftObjectPtr<UTexture2D>(); }	
 	virtual bool IsValidIcon() const { return false; }
 
+	// Appends the soft references this icon needs loaded to display, used to stream icons in ahead of time
+	virtual void AppendIconAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const {}
+
 	virtual void ApplyToAsyncImage(URHAsyncImage* InImage, bool bMatchSize = false) {}
 };
 
@@ -45,6 +48,14 @@ public:
 
 	virtual bool IsValidIcon() const override { return !IconImage.IsNull(); }
 
+	virtual void AppendIconAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const override
+	{
+		if (!IconImage.IsNull())
+		{
+			OutAssetPaths.Add(IconImage);
+		}
+	}
+
 	virtual void ApplyToAsyncImage(URHAsyncImage* InImage, bool bMatchSize = false) override;
 };
 
@@ -7,8 +7,11 @@
 #include "Inventory/RHEvent.h"
 #include "RH_PlayerInventory.h"
 #include "Managers/RHStoreItemHelper.h"
+#include "Engine/StreamableManager.h"
 #include "RHBattlepass.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBattlepassRewardAssetsLoaded);
+
 UENUM(BlueprintType)
 enum class EBattlepassTrackType : uint8
 {
@@ -126,6 +129,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Battlepass")
 	URHBattlepassLevel* GetBattlepassLevel(int32 LevelNumber) const;
 
+	// Every level reward of the pass grouped by level in level order, empty until GetLevels has been called
+	const TArray<URHBattlepassRewardItem*>& GetCachedLevelRewards() const { return CachedLevelRewards; }
+
+	// Called once every page of reward assets has been streamed in
+	UPROPERTY(BlueprintAssignable, Category = "Battlepass")
+	FOnBattlepassRewardAssetsLoaded OnAllRewardAssetPagesLoaded;
+
+	// Streams in the reward assets for the pages covering the given levels, the page with the player's current level is requested first at a higher priority
+	UFUNCTION(BlueprintCallable, Category = "Battlepass")
+	void StreamRewardAssetsForLevels(int32 FirstLevelNumber, int32 LastLevelNumber);
+
 	// Gets the instant unlock rewards, if it isn't cached, it will generate and cache it
 	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"), Category = "Battlepass")
 	TArray<URHBattlepassRewardItem*> GetInstantUnlockRewards(const UObject* WorldContextObject);
@@ -137,6 +151,7 @@ public:
 	FORCEINLINE UIconInfo* GetPremiumIconInfo() const { return PremiumIconInfo; }
 
 	virtual void AppendRequiredLootTableIds(TArray<int32>& LootTableIds) override;
+	virtual void AppendPrefetchAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const override;
 
 #if WITH_EDITOR
 	virtual void GetPreloadDependencies(TArray<UObject*>& OutDeps) override;
@@ -150,6 +165,12 @@ protected:
 	void RewardAssetsFullyLoaded();
 	void InstantUnlocksAssetsFullyLoaded();
 
+	// Builds the level model from the Xp table and groups the rewards of both tracks by level
+	void BuildLevelModel(URHStoreItemHelper* StoreItemHelper);
+
+	void RequestRewardAssetPage(int32 PageIndex, int32 Priority);
+	void OnRewardAssetPageLoaded(int32 PageIndex);
+
 	UPROPERTY(EditDefaultsOnly)
 	int32 XpTableId;
 
@@ -159,15 +180,44 @@ protected:
 	UPROPERTY(EditAnywhere, NoClear, Instanced, Category = "Battlepass", meta = (DisplayName = "Premium Icon"))
 	UIconInfo* PremiumIconInfo;
 
+	// Number of levels whose reward assets are streamed in together
+	UPROPERTY(EditDefaultsOnly, Category = "Battlepass", meta = (ClampMin = "1"))
+	int32 RewardAssetPageSize;
+
+	// Indexed by level number - 1
 	UPROPERTY(Transient)
 	TArray<URHBattlepassLevel*> CachedBattlepassLevels;
 
+	// Struct of arrays level model, entry i describes level i + 1. A level starts at the previous level's end Xp.
+	TArray<int32> LevelEndXp;
+	// Offset of each level's first reward in CachedLevelRewards, with one trailing entry for the end of the last level
+	TArray<int32> LevelRewardOffsets;
+
+	UPROPERTY(Transient)
+	TArray<URHBattlepassRewardItem*> CachedLevelRewards;
+
+	// Reward asset streaming per page of RewardAssetPageSize levels
+	TArray<TSharedPtr<FStreamableHandle>> RewardAssetPageHandles;
+	TBitArray<> RewardAssetPagesRequested;
+	TBitArray<> RewardAssetPagesLoaded;
+	int32 NumRewardAssetPagesLoaded;
+	// Page requested when the level model is built, RewardsFullyLoaded is set once it has loaded
+	int32 InitialRewardAssetPage;
+
+	// The level the player was last seen earning towards, its page is streamed ahead of the others
+	int32 PriorityLevelNumber;
+
 	UPROPERTY(Transient)
 	TArray<URHBattlepassRewardItem*> CachedInstantUnlocks;
 
+	// Set once the reward list is built and the first page of reward assets has loaded
 	UPROPERTY(BlueprintReadOnly)
 	bool RewardsFullyLoaded;
 
+	// Set once every page of reward assets has loaded, pages are only requested as their levels are shown
+	UPROPERTY(BlueprintReadOnly)
+	bool AllRewardAssetPagesLoaded;
+
 	UPROPERTY(BlueprintReadOnly)
 	bool InstantUnlocksFullyLoaded;
 };
@@ -23,6 +23,9 @@ public:
 
 	virtual void AppendRequiredLootTableIds(TArray<int32>& LootTableIds) { }
 
+	// Appends the soft references the event's screens need, so the EventManager can stream them in when the event is prefetched
+	virtual void AppendPrefetchAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const;
+
 	// The Tag associated with the event, when loaded is set by the EventManager
 	FName EventTag;
 };
@@ -51,6 +51,13 @@ public:
 	{}
 };
 
+// An entry of the resolved watch order, along with its skipping rules for this viewing
+struct FRHMediaPlayerResolvedEntry
+{
+	FRHMediaPlayerWidgetPlaylistEntry* Entry = nullptr;
+	bool bBlockSkipping = false;
+};
+
 /**
  * RoCo UMG widget for playing Media Framework videos
  */
@@ -60,6 +67,7 @@ class RALLYHERESTART_API URHMediaPlayerWidget : public URHWidget
 	GENERATED_BODY()
 
 	virtual void InitializeWidget_Implementation() override;
+	virtual void UninitializeWidget_Implementation() override;
 	virtual void ShowWidget() override;
 
 	void CleanUp();
@@ -79,12 +87,20 @@ public:
 
 	TSharedPtr<FStreamableHandle> MediaAsyncLoadHandle;
 
+	// Streams in the entry after the current one while the current one plays
+	TSharedPtr<FStreamableHandle> NextMediaAsyncLoadHandle;
+
 	UPROPERTY(EditDefaultsOnly)
 	bool bOnlyWatchFirstEntry;
 
 	void CleanupAsyncLoadHandle();
 	void PlayNextPlaylistEntry();
 	void HandleMediaLoaded();
+	// Works out the full watch order once per viewing from the data table and the watched state
+	void ResolvePlaylist();
+	void PreloadNextPlaylistEntry();
+	// Saves the watched state of every entry started this viewing in one settings write
+	void FlushWatchedActions();
 	// called at the beginning of the loading of the playlist entry datatable
 	UFUNCTION(BlueprintImplementableEvent, Category = "Media Player Widget")
 	void OnBeginLoadingMedia();
@@ -121,6 +137,12 @@ private:
 	int32 PlaylistEntriesWatched;
 	FRHMediaPlayerWidgetPlaylistEntry* CurrentPlaylistEntry;
 
+	TArray<FRHMediaPlayerResolvedEntry> ResolvedPlaylist;
+	bool bPlaylistResolved;
+
+	// Local actions of the entries started this viewing, saved when the playlist ends
+	TArray<FName> PendingWatchedActions;
+
 	void SetupSkipPrompting(bool BlockSkipping, float SkipDelay);
 	void UpdateSkipPromptDelayTimer();
 	void ClearUpdateSkipPromptDelayTimer();
@@ -87,6 +87,12 @@ protected:
     UFUNCTION(BlueprintImplementableEvent)
     void OnJsonChanged(const FString& JsonName);
 
+	// Called when an inventory change flips the visibility of some of the last checked panels, with the full list of visible panels
+	// By default this falls back to OnJsonChanged so widgets that refresh from it keep updating
+	UFUNCTION(BlueprintNativeEvent)
+	void OnVisiblePanelsChanged(const TArray<URHNewsRotatorData*>& InVisiblePanels);
+	virtual void OnVisiblePanelsChanged_Implementation(const TArray<URHNewsRotatorData*>& InVisiblePanels);
+
     // References the JSON section that is used to populate this widget
     UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "News Rotator Widget")
     FString JsonSection;
@@ -98,4 +104,26 @@ protected:
 private:
     UFUNCTION(BlueprintPure)
     URHJsonDataFactory* GetJsonDataFactory();
+
+	// Parses the panels of JsonSection out of the landing panel document into CachedPanels
+	void RebuildPanelModels(URHJsonDataFactory* pJsonDataFactory);
+
+	// Panel models built from the landing panel document, reused by every call until the document changes
+	UPROPERTY(Transient)
+	TArray<URHNewsRotatorData*> CachedPanels;
+
+	int32 CachedPanelsRevision = INDEX_NONE;
+	FString CachedPanelsCulture;
+
+	// Re-checks only the invalidated panels that are part of the last check
+	UFUNCTION()
+	void OnJsonPanelsInvalidated(const TArray<URHJsonData*>& InvalidatedPanels);
+
+	// Panels passed to the last visibility check, in display order
+	UPROPERTY(Transient)
+	TArray<URHNewsRotatorData*> CheckedPanels;
+
+	// Subset of CheckedPanels that passed the last check
+	UPROPERTY(Transient)
+	TSet<URHNewsRotatorData*> VisiblePanels;
 };
\ No newline at end of file
@@ -128,6 +128,10 @@ protected:
 	UFUNCTION()
 	void UpdateWhatsNewPanels(const FString& JsonName);
 
+	// Only notifies the blueprint when one of the stored panels depends on the changed inventory, the panels themselves don't need rebuilding
+	UFUNCTION()
+	void HandleJsonPanelsInvalidated(const TArray<URHJsonData*>& InvalidatedPanels);
+
 private:
     UFUNCTION(BlueprintPure)
     URHJsonDataFactory* GetJsonDataFactory();
@@ -2,8 +2,12 @@
 #include "Engine/DataTable.h"
 #include "Inventory/RHEvent.h"
 #include "RH_ConfigSubsystem.h"
+#include "Engine/StreamableManager.h"
 #include "RHEventManager.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEventActiveStateChanged, FName, EventTag);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnEventPrefetchComplete);
+
 USTRUCT(BlueprintType)
 struct FRHEventData : public FTableRowBase
 {
@@ -17,6 +21,41 @@ struct FRHEventData : public FTableRowBase
     }
 };
 
+// Parsed start and end times of an event, cached so activity checks don't need to look up and parse app settings
+struct FRHEventScheduleEntry
+{
+	FDateTime StartTime;
+	FDateTime EndTime;
+	// Last state broadcast through OnEventActivated / OnEventDeactivated, only updated when the transition timer fires.
+	// Use IsActiveAt to know if the event is active right now.
+	bool bActive = false;
+
+	bool IsActiveAt(const FDateTime& Time) const
+	{
+		return StartTime.GetTicks() > 0 && EndTime.GetTicks() > 0 && Time.GetTicks() > 0 && StartTime <= Time && Time < EndTime;
+	}
+};
+
+// Progress of an event's data object and its art being streamed in ahead of use
+struct FRHEventPrefetchState
+{
+	TSharedPtr<FStreamableHandle> DataObjectHandle;
+	TSharedPtr<FStreamableHandle> AssetsHandle;
+	double StartTime = 0.0;
+	// Seconds from the prefetch request until the event's art finished loading, negative while still loading
+	float LoadSeconds = -1.f;
+	bool bDataObjectLoaded = false;
+
+	bool IsComplete() const { return LoadSeconds >= 0.f; }
+};
+
+// A point in time where an event may start or stop being active
+struct FRHEventScheduleTransition
+{
+	FDateTime Time;
+	FName EventTag;
+};
+
 UCLASS(Config = Game)
 class RALLYHERESTART_API URHEventManager : public UObject
 {
@@ -35,11 +74,14 @@ public:
 	{
 		if (EventsDataDT != nullptr)
 		{
-			for (FName EventTag : EventsDataDT->GetRowNames())
+			const FDateTime CurrentTime = GetCurrentTime();
+
+			for (const TPair<FName, FRHEventScheduleEntry>& ScheduleEntry : EventSchedule)
 			{
 				// Only check active events so we don't try and load everything
-				if (IsEventActive(EventTag))
+				if (ScheduleEntry.Value.IsActiveAt(CurrentTime))
 				{
+					const FName EventTag = ScheduleEntry.Key;
 					if (FRHEventData* EventRow = EventsDataDT->FindRow<FRHEventData>(EventTag, "Load Active Event To Check"))
 					{
 						// Only load the event if it potentially could match what we need
@@ -61,9 +103,17 @@ public:
 		return nullptr;
 	}
 
-	// When the player gets logged in check for all active events and request their needed vendors
+	// When the player gets logged in prefetch all active events and request their needed vendors
 	void OnLoginPlayerChanged(ULocalPlayer* LocalPlayer);
 
+	// Whether every event that was active at login has finished streaming in its data and art
+	UFUNCTION(BlueprintPure, Category = "Event Manager")
+	bool IsEventPrefetchComplete() const { return bEventPrefetchComplete; }
+
+	// Gets how long the event took to prefetch in seconds, or a negative value if it has not finished
+	UFUNCTION(BlueprintPure, Category = "Event Manager")
+	float GetEventPrefetchSeconds(FName EventTag) const;
+
 	UFUNCTION(BlueprintCallable)
 	URHEvent* GetEventByTag(FName EventTag) const;
 
@@ -85,7 +135,58 @@ public:
 	// Gets the current server time
 	FDateTime GetCurrentTime() const;
 
+	// Called when an event's timeframe starts, or when a settings update moves it into its timeframe
+	UPROPERTY(BlueprintAssignable, Category = "Event Manager")
+	FOnEventActiveStateChanged OnEventActivated;
+
+	// Called when an event's timeframe ends, or when a settings update moves it out of its timeframe
+	UPROPERTY(BlueprintAssignable, Category = "Event Manager")
+	FOnEventActiveStateChanged OnEventDeactivated;
+
+	// Called once every event that was active at login has been prefetched, so screens can open without loading
+	UPROPERTY(BlueprintAssignable, Category = "Event Manager")
+	FOnEventPrefetchComplete OnEventPrefetchComplete;
+
 protected:
+	// Parses every event's start and end times from the app settings and rebuilds the transition timeline
+	void RebuildEventSchedule();
+
+	// Applies every transition that has been reached, then sets the timer for the next one
+	void ProcessScheduleTransitions();
+	void ScheduleNextTransition();
+
+	void SetEventActive(FName EventTag, FRHEventScheduleEntry& ScheduleEntry, bool bActive);
+
+	// Starts streaming in an event's data object, then the art it references, so they are ready before anything asks for them
+	void PrefetchEvent(FName EventTag);
+	void OnEventDataObjectLoaded(FName EventTag);
+	void OnEventAssetsLoaded(FName EventTag);
+
+	// Requests collected vendors once login's events have their data, and signals completion once they have their art
+	void UpdateLoginPrefetch();
+	void RequestPendingVendorData();
+
+	FDateTime ReadEventTimeSetting(FName EventTag, const TCHAR* SettingSuffix) const;
+
+	TMap<FName, FRHEventScheduleEntry> EventSchedule;
+
+	// Upcoming transitions sorted by time, entries before NextTransitionIndex have been applied
+	TArray<FRHEventScheduleTransition> ScheduleTimeline;
+	int32 NextTransitionIndex;
+
+	FTimerHandle ScheduleTimerHandle;
+	FDelegateHandle SettingsUpdatedHandle;
+
+	TMap<FName, FRHEventPrefetchState> EventPrefetchStates;
+
+	// Events that were active at login and still gate the prefetch completion signal
+	TSet<FName> LoginPrefetchEvents;
+
+	// Loot table ids collected from prefetched events that have not been requested yet
+	TArray<int32> PendingLootTableIds;
+
+	bool bEventPrefetchComplete;
+
 	/** Path to the DataTable to load, configurable per game. If empty, it will not spawn one */
 	UPROPERTY(Config)
 	FSoftObjectPath EventManagerDataTableClassName;
@@ -14,6 +14,49 @@ class URHGameInstance;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FJsonPanelUpdated, const FString&, JsonName);
 
+// Platforms a landing panel can be limited to, resolved once for the local client and compiled once per panel
+enum class ERHJsonPanelPlatform : uint16
+{
+	None = 0,
+	Steam = 1 << 0,
+	Epic = 1 << 1,
+	// Desktop client not logged in through Steam or Epic (oss=anon in dev), allowed by either PC flag
+	DesktopAnon = 1 << 2,
+	PS4 = 1 << 3,
+	PS5 = 1 << 4,
+	XB1 = 1 << 5,
+	XSX = 1 << 6,
+	Switch = 1 << 7,
+	IOS = 1 << 8,
+	Android = 1 << 9,
+};
+ENUM_CLASS_FLAGS(ERHJsonPanelPlatform);
+
+// Eligibility rules of a URHJsonData, compiled by LoadData so panels can be checked without re-reading the JSON fields
+struct FRHJsonDataPredicate
+{
+	// Zero when the window is open on that side
+	int64 StartTicks = 0;
+	int64 EndTicks = 0;
+
+	ERHJsonPanelPlatform AllowedPlatforms = ERHJsonPanelPlatform::None;
+
+	// Hide the panel if any of these are owned
+	TArray<int32> HideIfOwnedIds;
+	// Only show the panel if all of these are owned, except the player xp item. This is every id the panel's rules check, including the HideIfItemOwned ids and the associated loot of HideIfOwned panels.
+	TArray<int32> RequiredOwnedIds;
+
+	int32 MinLevel = INDEX_NONE;
+	int32 MaxLevel = INDEX_NONE;
+
+	bool IsInTimeWindow(const FDateTime& Now) const;
+	bool IsAllowedOnPlatforms(ERHJsonPanelPlatform LocalPlatforms) const { return EnumHasAllFlags(AllowedPlatforms, LocalPlatforms); }
+	bool HasInventoryRequirements() const { return HideIfOwnedIds.Num() > 0 || RequiredOwnedIds.Num() > 0 || MinLevel != INDEX_NONE || MaxLevel != INDEX_NONE; }
+
+	// Evaluates the inventory rules against counts that include every id this predicate references
+	bool EvaluateInventory(const TMap<FRH_ItemId, int32>& InventoryCounts, const FRH_ItemId& PlayerXpItemId) const;
+};
+
 UCLASS(BlueprintType)
 class RALLYHERESTART_API URHJsonData : public UObject
 {
@@ -68,6 +111,9 @@ public:
 	bool showIOS;
 	UPROPERTY(BlueprintReadOnly)
 	bool showAndroid;
+
+	// Compiled from the fields above when the data is loaded
+	FRHJsonDataPredicate Predicate;
 };
 
 USTRUCT(BlueprintType)
@@ -77,8 +123,23 @@ struct FRHJsonDataWrapper
 
 	UPROPERTY(BlueprintReadWrite)
 	TSet<URHJsonData*> JsonDataSet;
+
+	// Memoized inventory result per panel, cleared when a relevant inventory item changes
+	UPROPERTY(Transient)
+	TMap<URHJsonData*, bool> InventoryResultByPanel;
+
+	// Inventory counts fetched for the panels above, an id is dropped when the inventory reports it changed
+	TMap<FRH_ItemId, int32> InventoryCountsById;
+
+	// Inverted index from item id to the panels in JsonDataSet whose rules reference it, the panels are kept alive by JsonDataSet
+	TMap<int32, TArray<URHJsonData*>> PanelsByItemId;
+
+	// Panels in JsonDataSet gated on the player level, which depend on the player xp item
+	TArray<URHJsonData*> LevelGatedPanels;
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FJsonPanelsInvalidated, const TArray<URHJsonData*>&, InvalidatedPanels);
+
 USTRUCT(BlueprintType)
 struct FRHShouldShowPanelsWrapper
 {
@@ -90,31 +151,6 @@ struct FRHShouldShowPanelsWrapper
 
 DECLARE_DELEGATE_OneParam(FOnGetShouldShowPanels, FRHShouldShowPanelsWrapper);
 
-UCLASS()
-class URH_PlayerShouldShowPanelsHelper : public UObject
-{
-	GENERATED_BODY()
-
-public:
-	void StartCheck();
-
-	int32 Responses;
-	bool bComplete;
-
-	FOnGetShouldShowPanels Event;
-	TArray<URHJsonData*> PanelsToCheck;
-	FRHShouldShowPanelsWrapper Results;
-
-	UPROPERTY()
-	URH_PlayerInfo* PlayerInfo;
-
-	UPROPERTY()
-	URHJsonDataFactory* JsonDataFactory;
-
-private:
-	void OnGetShouldShowResponse(bool bShouldShow, URHJsonData* JsonData);
-};
-
 USTRUCT(BlueprintType)
 struct FRHInventoryCountWrapper
 {
@@ -176,6 +212,9 @@ public:
 
     TSharedPtr<FJsonObject> GetJsonPanelByName(const FString& name);
 
+	// Bumped every time the named document or its downloaded images change, so consumers can keep models built from it until then
+	int32 GetJsonPanelRevision(const FString& name) const;
+
 	URH_PlayerInfo* GetLocalPlayerInfo() const { return MyHud->GetLocalPlayerInfo(); };
 
 	UPROPERTY()
@@ -190,8 +229,12 @@ public:
 
 	FJsonPanelUpdated JsonPanelUpdated;
 
+	// Broadcast with only the panels whose inventory rules reference an item that just changed, so they can be re-checked on their own
+	FJsonPanelsInvalidated JsonPanelsInvalidated;
+
 protected:
     TMap<FString, TSharedPtr<FJsonObject>> JsonPanels;
+	TMap<FString, int32> JsonPanelRevisions;
 	TMap<FString, TArray<int32>> ItemsPerPanel;
 
 	UPROPERTY(BlueprintReadWrite)
@@ -209,6 +252,30 @@ private:
 	void TryLoadLandingPanels();
 	void OnLocalPlayerLoginChanged(ULocalPlayer* LocalPlayer);
 
+	// Adds the panels to the player's cache and makes sure the player is registered for inventory updates, returns null if the player has no inventory
+	FRHJsonDataWrapper* RegisterPanelsForPlayer(const TArray<URHJsonData*>& Panels, URH_PlayerInfo* PlayerInfo);
+
+	// Evaluates the inventory rules of the pending panels against the given counts and memoizes the results
+	void EvaluatePendingPanels(const TArray<URHJsonData*>& PendingPanels, const TMap<FRH_ItemId, int32>& InventoryCounts, FRHJsonDataWrapper* PlayerCache, FRHShouldShowPanelsWrapper& Results) const;
+
+	FRH_ItemId GetPlayerXpItemId() const;
+
+	// Results for level gated panels memoized before the player xp progression loaded never checked the level, so they are dropped once it loads
+	void OnPlayerXpProgressionLoaded();
+
+	// Platforms the local client is on, resolved once and refreshed when a local player logs in or out
+	ERHJsonPanelPlatform GetLocalPlatforms() const;
+
+	mutable ERHJsonPanelPlatform CachedLocalPlatforms = ERHJsonPanelPlatform::None;
+	mutable bool bLocalPlatformsDirty = true;
+
+	// Set when Initialize ran before login, so the landing panels are loaded once a local player logs in
+	bool bLoadLandingPanelsOnLogin = false;
+
+	// Keeps inventory count batches alive until their responses come back
+	UPROPERTY(Transient)
+	TArray<UObject*> PendingInventoryCountHelpers;
+
 	UPROPERTY(config)
 	FSoftObjectPath PlayerProgressionXpClass;
 
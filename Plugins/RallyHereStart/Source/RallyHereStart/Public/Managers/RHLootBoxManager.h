@@ -8,6 +8,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLootBoxOpenStarted);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLootBoxOpenFailed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLootBoxLeave);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLootBoxOpenSequenceCompleted);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLootBoxContentsReady);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDisplayLootBoxIntro, URHLootBox*, LootBox);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDisplayLootBoxIntroAndOpen, URHLootBox*, LootBox);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLootBoxContentsReceived, const TArray<UPlatformInventoryItem*>&, AcquiredItems);
@@ -25,6 +26,21 @@ enum ELootBoxContentsCategories
 	LootBoxContents_Other,
 };
 
+// Immutable drop table contents of every loot box on sale, holding only ids and categories so it can be built off the game thread
+struct FRHLootBoxContentsIndex
+{
+	struct FLootTable
+	{
+		// The Loot Table ID of the vendor with the given contents
+		int32 LootTableId = 0;
+		TArray<FRH_LootId> LootIds;
+		// Category of each entry in LootIds
+		TArray<ELootBoxContentsCategories> Categories;
+	};
+
+	TMap<FRH_LootId, TArray<FLootTable>> LootTablesByLootBox;
+};
+
 UCLASS(Config = Game)
 class RALLYHERESTART_API URHLootBoxDetails : public UObject
 {
@@ -98,9 +114,14 @@ public:
 	UFUNCTION(BlueprintPure)
 	static FText GetContentCategoryName(ELootBoxContentsCategories Category);
 
-	// Returns the details of a given loot box
+	// Returns the details of a given loot box, creating the store items for its contents the first time it is asked for.
+	// Returns nullptr until the contents are ready, see OnLootBoxContentsReady.
 	URHLootBoxDetails* GetLootBoxDetails(URHStoreItem* LootBox);
 
+	// Returns if the loot box contents for the current vendor data have been built
+	UFUNCTION(BlueprintPure, Category = "Loot Box Manager")
+	bool AreLootBoxContentsReady() const { return ContentsIndex.IsValid(); }
+
     // Delegates for loot box sequences
 
 	// Called when a player clicks the open button
@@ -131,13 +152,17 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Loot Box Manager")
 	FOnLootBoxOpenSequenceCompleted OnLootBoxOpenSequenceCompleted;
 
+	// Called when the loot box contents have been built for newly loaded vendor data, GetLootBoxDetails is valid from then on
+	UPROPERTY(BlueprintAssignable, Category = "Loot Box Manager")
+	FOnLootBoxContentsReady OnLootBoxContentsReady;
+
 	UPROPERTY()
 	TArray<FRH_LootId> LootBoxLootIds;
 
 protected:
 
-	// Returns the subcategory for the item based on what it is
-	ELootBoxContentsCategories GetSubCategoryForItem(URHStoreItem* StoreItem) const;
+	// Swaps in a contents index built on a worker thread, unless a newer build has been started since
+	void SetContentsIndex(const TSharedPtr<const FRHLootBoxContentsIndex>& NewContentsIndex, int32 Generation);
 
 	// Pointer to the Store Item Helper
 	UPROPERTY(Transient)
@@ -148,9 +173,13 @@ protected:
 
 	bool HasRequestedVendors;
 
+	// Details already handed out, filled in lazily from ContentsIndex
 	UPROPERTY(Transient)
 	TMap<FRH_LootId, URHLootBoxDetails*> UnopenedLootBoxIdToContents;
 
+	TSharedPtr<const FRHLootBoxContentsIndex> ContentsIndex;
+	int32 ContentsIndexGeneration;
+
 	UPROPERTY(Config)
 	int32 LootBoxsVendorId;
 
@@ -97,6 +97,19 @@ public:
     UPROPERTY(BlueprintReadWrite, Category = "Popup")
     bool CanBeShownOver;
 
+    // Determines if repeats of this popup (same header, description and buttons) collapse into it instead of stacking up.
+    // Only the first popup's button actions fire, so only opt in for popups whose actions just close them (e.g. backend errors).
+    UPROPERTY(BlueprintReadWrite, Category = "Popup")
+    bool CanBeCoalesced;
+
+    // Queued popups with a higher priority are shown first, equal priorities show the most recently queued first
+    UPROPERTY(BlueprintReadWrite, Category = "Popup")
+    int32 Priority;
+
+    // How many times this popup was requested while it was showing or queued
+    UPROPERTY(BlueprintReadOnly, Category = "Popup")
+    int32 RepeatCount;
+
     UPROPERTY(BlueprintReadOnly, Category = "Popup")
     bool TreatAsBlocker;
 
@@ -121,6 +134,10 @@ public:
     UPROPERTY(BlueprintReadWrite, Category = "Popup")
     FKey KeyToDisplay;
 
+    // Set by the popup manager when the popup is added
+    uint32 ContentHash;
+    int32 QueueOrder;
+
     FRHPopupConfig()
 		: Header()
 		, SubHeading()
@@ -135,12 +152,17 @@ public:
         , TextEntryHint()
 		, IsImportant(false)
         , CanBeShownOver(true)
+        , CanBeCoalesced(false)
+        , Priority(0)
+        , RepeatCount(1)
 		, TreatAsBlocker(false)
         , Buttons()
         , CancelAction()
 		, TextAlignment(ETextJustify::Center)
         , PopupId(INDEX_NONE)
 		, PopupFormat(ERHPopupFormat::Standard)
+        , ContentHash(0)
+        , QueueOrder(0)
     {
     }
 
@@ -150,6 +172,13 @@ public:
     }
 };
 
+// Tracks a popup waiting in the popup queue
+struct FRHQueuedPopupState
+{
+    uint32 ContentHash;
+    int32 RepeatCount;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnShowPopupEvent);
 //$$ PGL - Delegate that calls when the Popup Timer finish
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTimerExpired);
@@ -187,6 +216,10 @@ public:
 
     bool HasActivePopup() { return CurrentPopup.IsValid(); }
 
+    // Returns the popups still waiting in the queue, in the order they will be shown
+    UFUNCTION(BlueprintPure, Category = "Platform UMG | Popup")
+    TArray<FRHPopupConfig> GetQueuedPopups() const;
+
     //CommittedText will be empty after this function is called
     FText CommittedTextHandoff();
 
@@ -205,14 +238,41 @@ public:
     UPROPERTY()
     bool bNewPopupsShowOverCurrent;
 
+    // When more popups than this are queued, the lowest priority unimportant ones are dropped. 0 for no limit.
+    UPROPERTY(EditDefaultsOnly, Category = "Platform UMG | Popup")
+    int32 MaxQueuedPopups;
+
 protected:
 
     UFUNCTION(BlueprintImplementableEvent, Category = "Platform UMG | Popup")
     void HidePopup();
 
-    UPROPERTY(BlueprintReadWrite, Category = "Platform UMG | Popup")
+    // Called instead of ShowPopup when a popup is requested again while it is being displayed
+    UFUNCTION(BlueprintImplementableEvent, Category = "Platform UMG | Popup")
+    void OnPopupRepeated(int32 PopupId, int32 RepeatCount);
+
+    // Heap ordered by priority, then most recently queued. Popups removed while queued stay in here until popped or compacted.
+    // Only modify through AddPopup and RemovePopup so the queue bookkeeping stays in sync, use GetQueuedPopups to read it.
+    UPROPERTY(Transient)
     TArray<FRHPopupConfig> PopupQueue;
 
+    static uint32 GetPopupContentHash(const FRHPopupConfig& popupData);
+    // Checks the fields the content hash is built from, so a hash collision never coalesces two different popups
+    static bool HasSamePopupContent(const FRHPopupConfig& A, const FRHPopupConfig& B);
+
+    void EnqueuePopup(const FRHPopupConfig& popupData);
+    void TrimPopupQueue();
+    void CompactPopupQueue();
+    void ForgetQueuedPopup(int32 popupId, uint32 contentHash);
+
+    // Bookkeeping for the popups still waiting in PopupQueue, keyed by PopupId
+    TMap<int32, FRHQueuedPopupState> QueuedPopupStates;
+
+    // Queued popups that can be coalesced, keyed by content hash
+    TMap<uint32, int32> QueuedPopupIdsByHash;
+
+    int32 m_nQueueOrder;
+
     UPROPERTY(BlueprintReadWrite, Category = "Platform UMG | Popup")
     int32 m_nPopupId;
 
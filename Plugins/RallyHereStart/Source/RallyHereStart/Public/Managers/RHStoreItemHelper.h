@@ -490,6 +490,26 @@ private:
 
 class URH_PurchaseAsyncTaskHelper;
 
+// Fills OutVendor with the vendor's data, returns false if the vendor is not loaded
+typedef TFunctionRef<bool(int32 VendorId, FRHAPI_Vendor& OutVendor)> FRHVendorClosureLookup;
+
+// Flattened contents of a vendor's active loot, built once per vendor data update so containment checks don't re-walk sub vendors
+struct FRHVendorClosure
+{
+	// Builds the closure of the vendor and of any sub vendors not in InOutClosures yet, adding the complete ones to InOutClosures.
+	// Returns the vendor's closure, which is OutUncachedClosure if part of it was not loaded.
+	static const FRHVendorClosure* Build(int32 nVendorId, FRHVendorClosureLookup GetVendor, TMap<int32, FRHVendorClosure>& InOutClosures, FRHVendorClosure& OutUncachedClosure);
+
+	// Loot ids reachable through the vendor, with sub vendor loot replaced by its contents, in the order a depth first walk finds them
+	TSet<FRH_LootId> LootIds;
+
+	// Item ids granted (added, or set to a positive quantity) by the vendor's own loot
+	TSet<FRH_ItemId> DirectGrantedItemIds;
+
+	// Item ids granted by the vendor's own loot and by its sub vendors
+	TSet<FRH_ItemId> GrantedItemIds;
+};
+
 USTRUCT(BlueprintType)
 struct FAccountConsumableDetails
 {
@@ -579,6 +599,16 @@ public:
 
     TArray<FRH_LootId> GetLootIdsForVendor(int32 nVendorId, bool bIncludeInctiveItems, bool bSearchSubContainers);
 
+    // Returns if the vendor's active loot grants the item, optionally through its sub vendors as well
+    bool VendorGrantsItemId(int32 nVendorId, const FRH_ItemId& nItemId, bool bSearchSubContainers);
+
+    // Returns the flattened contents of a vendor, building and caching them for it and any sub vendors on first use.
+    // Contents that include a vendor not loaded yet are built but not cached, and only stay valid until the next call.
+    const FRHVendorClosure* GetVendorClosure(int32 nVendorId);
+
+    // Drops the cached vendor closures, done whenever vendor data is received
+    void InvalidateVendorClosures() { VendorClosures.Empty(); }
+
     // Looks up the PricePoints for the GUID, and creates it if needed
     bool GetPriceForGUID(FStorePriceKey Guid, TArray<URHStoreItemPrice*>& Prices);
 
@@ -771,6 +801,12 @@ protected:
     // A map that resolves Price Point Guids to Price data used by the client
     TMap<FStorePriceKey, TArray<URHStoreItemPrice*>> PricePoints;
 
+    // Flattened vendor contents by vendor id, see GetVendorClosure
+    TMap<int32, FRHVendorClosure> VendorClosures;
+
+    // Flattened contents last returned for a vendor that could not be cached because part of it was not loaded
+    FRHVendorClosure UncachedVendorClosure;
+
 	// Map of loot table item ids to the coupons that are valid for them.
 	TMultiMap<FRH_LootId, FRHAPI_Loot> CouponsForLootTableItems;
 
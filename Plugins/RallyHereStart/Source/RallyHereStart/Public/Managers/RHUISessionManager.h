@@ -12,6 +12,54 @@ DECLARE_MULTICAST_DELEGATE(FOnPlayerInventoryReady)
 
 class URHGameInstance;
 
+// Single step of a flattened redemption recipe, nested sub vendor recipes are inlined between BeginBlock and EndBlock ops
+struct FRHRedemptionRecipeOp
+{
+	enum class EType : uint8
+	{
+		// Starts evaluating a nested sub vendor recipe with its own claim quantity
+		BeginBlock,
+		// Folds the nested claim quantity back into the enclosing block
+		EndBlock,
+		// Checks the player's inventory count of ItemId against Quantity
+		CheckItem,
+		// The recipe grants something, so it can be claimed at least once
+		Grant,
+	};
+
+	EType Type = EType::CheckItem;
+	ERHAPI_InventoryOperation Operation = ERHAPI_InventoryOperation::Invalid;
+	int32 ItemId = 0;
+	int32 Quantity = 0;
+	// Op index to continue from when this op ends its block early
+	int32 BlockEnd = INDEX_NONE;
+};
+
+// Fills OutVendor with the vendor's data, returns false if the vendor is not loaded
+typedef TFunctionRef<bool(int32 VendorId, FRHAPI_Vendor& OutVendor)> FRHRedemptionVendorLookup;
+
+struct FRHRedemptionRecipe
+{
+	FRHAPI_Loot LootItem;
+	TArray<FRHRedemptionRecipeOp> Ops;
+
+	// Flattens the recipe of the given sub vendor into Ops, adding every item it checks to OutItemIds
+	void Compile(int32 SubVendorId, FRHRedemptionVendorLookup GetVendor, TSet<int32>& OutItemIds);
+
+	// Returns how many times the player is able to claim the loot with the given inventory counts
+	int32 Evaluate(const TMap<FRH_ItemId, int32>& InventoryCounts) const;
+
+private:
+	static void CompileBlock(int32 VendorId, FRHRedemptionVendorLookup GetVendor, TArray<FRHRedemptionRecipeOp>& OutOps, TSet<int32>& OutItemIds, TArray<int32>& VendorStack);
+};
+
+struct FRHCompiledRedemptionRecipes
+{
+	TArray<FRHRedemptionRecipe> Recipes;
+	// Every item any of the recipes checks, so counts can be fetched in a single batch
+	TArray<int32> ItemIds;
+};
+
 UCLASS()
 class RALLYHERESTART_API URHUISessionData : public UObject
 {
@@ -197,8 +245,20 @@ protected:
 	UPROPERTY(Config)
 	int32 RewardRedemptionVendorId;
 
-	// Evaluated a loot table to see how many times the player is able to claim it
-	void GetClaimableQuantity(FRHAPI_Loot LootItem, URH_CatalogSubsystem* CatalogSubsystem, URH_PlayerInfo* PlayerInfo, int32 LootIndex, int32 Quantity, const FRH_GetInventoryCountBlock& Delegate = FRH_GetInventoryCountBlock());
+	// Flattens the recipe trees of the claimable loot on the redemption vendor
+	void CompileRedemptionRecipes(URH_CatalogSubsystem* CatalogSubsystem);
+
+	// Evaluates every compiled recipe against the fetched counts and claims all of the rewards in one order
+	void RedeemRewards(URH_PlayerInfo* PlayerInfo, const FRHCompiledRedemptionRecipes& CompiledRecipes, const TMap<FRH_ItemId, int32>& InventoryCounts);
+
+	// Compiled redemption recipes, rebuilt whenever the redemption vendor data is refreshed
+	TSharedPtr<const FRHCompiledRedemptionRecipes> CompiledRedemptionRecipes;
+	int32 RedemptionVendorDataGeneration = 0;
+	int32 CompiledRedemptionVendorDataGeneration = INDEX_NONE;
+
+	// Keeps inventory count batches alive until their responses come back
+	UPROPERTY(Transient)
+	TArray<UObject*> PendingInventoryCountHelpers;
 
 	UPROPERTY(Transient)
 	URHGameInstance* GameInstance;
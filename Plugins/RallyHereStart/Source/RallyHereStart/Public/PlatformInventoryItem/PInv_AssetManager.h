@@ -7,6 +7,7 @@
 #include "GameplayTagsManager.h"
 #include "RH_ConfigSubsystem.h"
 #include "RH_Properties.h"
+#include "PlatformInventoryItem/PInv_RegistrySnapshot.h"
 #include "PInv_AssetManager.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogPInv_AssetManager, Log, All);
@@ -41,6 +42,7 @@ public:
     virtual bool ShouldScanPrimaryAssetTypeForCollectionContainer(const FPrimaryAssetTypeInfo& TypeInfo) const;
 
 	const TMap<FRH_ItemId, FPrimaryAssetId>& GetItemIdMap() const { return ItemIdToPrimaryAssetIdMap; }
+	const TMap<FRH_LootId, FPrimaryAssetId>& GetLootIdMap() const { return LootIdToPrimaryAssetIdMap; }
 
     bool GetPrimaryAssetIdListByCollectionQuery(const FGameplayTagQuery& InCollectionQuery, TArray<FPrimaryAssetId>& OutPrimaryAssetIds) const;
     const TMap<FPrimaryAssetId, FGameplayTagContainer>& GetItemCollectionMap() const { return ItemCollectionMap; }
@@ -57,6 +59,14 @@ public:
 	// Returns if the item is currently temp disabled
 	bool IsItemIdTempDisabled(const FRH_ItemId& ItemId) const { return TempDisabledItemIds.Contains(ItemId); }
 
+	// Full path of the cooked Item Id / Loot Id / collection registry snapshot
+	FString GetRegistrySnapshotFilePath() const;
+
+#if WITH_EDITOR
+	// Path the cooker writes the registry snapshot to for the given platform, inside that platform's cook output
+	FString GetCookedRegistrySnapshotFilePath(const ITargetPlatform* TargetPlatform) const;
+#endif
+
 #if WITH_EDITOR
     /** Resets all asset manager data, called in the editor to reinitialize the config */
     virtual void ReinitializeFromConfig() override;
@@ -89,6 +99,15 @@ protected:
 	virtual void AddOrUpdateLootIdMap(const FPrimaryAssetId& PrimaryAssetId, const FAssetData& AssetData, bool bAllowDuplicates);
     virtual void AddOrUpdateCollectionContainerMap(const FPrimaryAssetId& PrimaryAssetId, const FAssetData& AssetData, bool bAllowDuplicates);
 
+    // Renumbers the assets in ItemCollectionMap and clears the per tag lists and memoized query results, expects the index lock to be held
+    void RebuildCollectionTagIndex() const;
+    // Returns the sorted indices of the assets with the tag or any of its children, filled in from ItemsByGameplayTagMap on first use, expects the index lock to be held
+    const TArray<int32>& GetCollectionAssetIndicesForTag(const FGameplayTag& Tag) const;
+    // Evaluates a query expression against the inverted tag index into a sorted list of asset indices, returns false if the expression type is not supported by the index
+    bool EvaluateCollectionQueryExpr(const FGameplayTagQueryExpression& QueryExpr, TArray<int32>& OutAssetIndices) const;
+    // Flags the inverted tag index as stale, it will be rebuilt on the next collection query
+    void MarkCollectionTagIndexDirty();
+
 #if WITH_EDITOR
 	virtual void RemoveFromItemIdMap(const FPrimaryAssetId& PrimaryAssetId);
 	virtual void RemoveFromLootIdMap(const FPrimaryAssetId& PrimaryAssetId);
@@ -121,6 +140,27 @@ private:
     TMap<FPrimaryAssetId, FGameplayTagContainer> ItemCollectionMap;
     TMultiMap<FGameplayTag, FPrimaryAssetId> ItemsByGameplayTagMap;
 
+	// Parsed asset registry tags, written during cook and read at startup so unchanged assets skip tag string parsing
+	FPInv_RegistrySnapshot RegistrySnapshot;
+
+    struct FCollectionQueryCacheEntry
+    {
+        FGameplayTagQuery Query;
+        TArray<FPrimaryAssetId> PrimaryAssetIds;
+    };
+
+    // Dense list of the assets in ItemCollectionMap, the inverted tag index refers to assets by their position in this list
+    mutable TArray<FPrimaryAssetId> CollectionIndexAssetIds;
+    mutable TMap<FPrimaryAssetId, int32> CollectionAssetIndexById;
+    // Sorted asset indices for the tags queries have asked about so far, derived from ItemsByGameplayTagMap
+    mutable TMap<FGameplayTag, TArray<int32>> CollectionAssetIndicesByTag;
+    // Memoized query results keyed by a hash of the query expression, cleared whenever the index is rebuilt
+    mutable TMultiMap<uint32, FCollectionQueryCacheEntry> CollectionQueryCache;
+    mutable bool bCollectionTagIndexDirty;
+    mutable FCriticalSection CollectionTagIndexLock;
+
+    friend class FPInv_CollectionQueryBenchmarkTest;
+
 public:
 	static const FPrimaryAssetType PlatformInventoryItemType;
 	static const FPrimaryAssetType PlatformStoreAssetType;
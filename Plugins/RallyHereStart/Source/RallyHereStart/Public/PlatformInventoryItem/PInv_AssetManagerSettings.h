@@ -56,4 +56,12 @@ public:
 
     UPROPERTY(config, EditAnywhere, Category="Cook Profile")
     FName CookProfile;
+
+	/** Write a snapshot of parsed Item Id, Loot Id and collection tags during cook and use it at startup to skip parsing unchanged assets */
+	UPROPERTY(config, EditAnywhere, Category = "Registry Snapshot")
+	bool bUseRegistrySnapshot;
+
+	/** Path of the registry snapshot relative to the cooked project content directory, the cooker writes it there so it is staged with the cooked content */
+	UPROPERTY(config, EditAnywhere, Category = "Registry Snapshot")
+	FString RegistrySnapshotPath;
 };
@@ -0,0 +1,93 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/PrimaryAssetId.h"
+
+/**
+ * Binary snapshot of the Item Id, Loot Id and collection container asset registry tags parsed by UPInv_AssetManager.
+ * Written into the cook output at cook time and read back at startup, so only assets whose tag strings have changed since the cook need to be parsed again.
+ */
+class RALLYHERESTART_API FPInv_RegistrySnapshot
+{
+public:
+	// Parsed form of an ItemId or LootId asset registry tag
+	struct FIdTag
+	{
+		// Hash of the raw tag string this entry was parsed from, used to validate the entry against the asset registry
+		uint32 TagHash = 0;
+		FGuid Guid;
+		int32 LegacyId = 0;
+		bool bHasGuid = false;
+		bool bIsSet = false;
+
+		friend FArchive& operator<<(FArchive& Ar, FIdTag& IdTag);
+	};
+
+	// Parsed form of a CollectionContainer asset registry tag
+	struct FCollectionTag
+	{
+		uint32 TagHash = 0;
+		TArray<FName> TagNames;
+		bool bIsSet = false;
+
+		friend FArchive& operator<<(FArchive& Ar, FCollectionTag& CollectionTag);
+	};
+
+	struct FEntry
+	{
+		FIdTag ItemId;
+		FIdTag LootId;
+		FCollectionTag Collection;
+
+		friend FArchive& operator<<(FArchive& Ar, FEntry& Entry);
+	};
+
+	// Parses an ItemId or LootId tag string in either the legacy number or the full struct export format
+	static FIdTag ParseIdTagString(const FString& TagString, uint32 TagHash);
+
+	static uint32 HashTagString(const FString& TagString);
+
+	// Returns the cached entry if it was parsed from the same tag string, otherwise nullptr
+	const FIdTag* FindItemId(const FPrimaryAssetId& PrimaryAssetId, uint32 TagHash) const;
+	const FIdTag* FindLootId(const FPrimaryAssetId& PrimaryAssetId, uint32 TagHash) const;
+	const FCollectionTag* FindCollection(const FPrimaryAssetId& PrimaryAssetId, uint32 TagHash) const;
+
+	// Newly parsed entries are only kept while recording, i.e. while the cooker is building the snapshot it will write out
+	void SetItemId(const FPrimaryAssetId& PrimaryAssetId, const FIdTag& IdTag) { if (bRecording) { Entries.FindOrAdd(PrimaryAssetId).ItemId = IdTag; } }
+	void SetLootId(const FPrimaryAssetId& PrimaryAssetId, const FIdTag& IdTag) { if (bRecording) { Entries.FindOrAdd(PrimaryAssetId).LootId = IdTag; } }
+	void SetCollection(const FPrimaryAssetId& PrimaryAssetId, const FCollectionTag& CollectionTag) { if (bRecording) { Entries.FindOrAdd(PrimaryAssetId).Collection = CollectionTag; } }
+	void Remove(const FPrimaryAssetId& PrimaryAssetId) { Entries.Remove(PrimaryAssetId); }
+
+	// Reads the snapshot file into the entry map, returns false if the file is missing or was written with a different version
+	bool LoadFromFile(const FString& FilePath);
+	bool SaveToFile(const FString& FilePath) const;
+
+	void Reset();
+	bool IsEmpty() const { return Entries.Num() == 0; }
+	int32 Num() const { return Entries.Num(); }
+
+	void SetRecording(bool bInRecording) { bRecording = bInRecording; }
+	bool IsRecording() const { return bRecording; }
+
+	// Tag strings only need hashing while there are entries to look up or new ones are being recorded
+	bool IsActive() const { return bRecording || !IsEmpty(); }
+
+	// Number of lookups answered from the snapshot and number that had to fall back to parsing since the last Reset
+	int32 GetNumHits() const { return NumHits; }
+	int32 GetNumMisses() const { return NumMisses; }
+
+private:
+	bool Serialize(FArchive& Ar);
+
+	static const uint32 SnapshotMagic;
+	static const int32 SnapshotVersion;
+
+	TMap<FPrimaryAssetId, FEntry> Entries;
+
+	bool bRecording = false;
+
+	mutable int32 NumHits = 0;
+	mutable int32 NumMisses = 0;
+};
@@ -16,6 +16,9 @@ class RALLYHERESTART_API ARHPlayerState : public APlayerState
 public:
     ARHPlayerState(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
     virtual void BeginPlay();
+	virtual void PostInitializeComponents() override;
+	virtual void PostNetInit() override;
+	virtual void PostRepNotifies() override;
 	
 	virtual void OnRep_UniqueId() override;
 
@@ -23,6 +26,7 @@ public:
 	class URH_PlayerInfo* GetPlayerInfo(ARHHUDCommon* Hud) const;
 
 	virtual void HandleWelcomeMessage() override;
+    // Flags the local player as using multiplayer features with the OSS when the game state's human player count crosses the threshold
     virtual void UpdateMultiplayerFeaturesForOSS();
 
 	FORCEINLINE void SetRHPlayerId(const int32& InRHPlayerId) { RHPlayerId = InRHPlayerId; }
@@ -42,4 +46,11 @@ protected:
     int32 RHPlayerId;
 	UPROPERTY(Replicated)
 	FGuid RHPlayerUuid;
+
+	// Last value passed to the OSS by UpdateMultiplayerFeaturesForOSS, so the flag is only set again when it changes
+	bool bUsingMultiplayerFeaturesForOSS;
+
+private:
+	// Has the game state re-evaluate whether this player state counts as human, for when the bot or inactive flag is set after it was added
+	void RefreshHumanPlayerOnGameState();
 };
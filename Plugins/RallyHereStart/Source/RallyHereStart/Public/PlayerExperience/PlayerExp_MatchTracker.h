@@ -73,6 +73,7 @@ protected:
     virtual void EndMatch(float MatchScoreDeviation);
     virtual void GameModeSwitched();
     virtual TSharedPtr<FJsonValue> CreateReport_MatchInfo();
+    virtual TSharedPtr<FJsonValue> CreateReport_MapLoad();
 
 	class URH_JoinedSession* GetSession() const;
 	void OnSessionUpdated(class URH_SessionView* Session);
@@ -9,6 +9,14 @@
 class UPlayerExp_PlayerTracker;
 class APlayerController;
 
+// A client stat period that has not yet been acknowledged by the server.
+struct FPlayerExp_PendingStatPeriod
+{
+    uint32 Sequence = 0;
+    FPlayerExp_StatAccumulator FrameTimeStats;
+    int32 NumHitchesDetected = 0;
+};
+
 UCLASS(Config=Game)
 class RALLYHERESTART_API UPlayerExp_PlayerComponent : public UActorComponent
 {
@@ -55,6 +63,18 @@ public:
     UPROPERTY(Transient)
     int32 OutTotalPacketsLost;
 
+    // The number of stat upload payload bytes received from this player.
+    UPROPERTY(Transient)
+    int32 StatUploadBytes;
+
+    // The number of stat uploads received from this player.
+    UPROPERTY(Transient)
+    int32 StatUploadCount;
+
+    // The number of stat uploads that were received but discarded (already applied or missing their baseline).
+    UPROPERTY(Transient)
+    int32 StatUploadsRejected;
+
 protected:
     virtual void CollectPerFrameClientStats(float DeltaTime);
     virtual void CollectPerSecondClientStats();
@@ -65,6 +85,7 @@ protected:
 
     virtual void HandleUpdatePing(float InPing);
     void ResetTimeUntilNextAccumulation();
+    void SendPendingStatsToServer();
 
     UPROPERTY(Transient)
     TWeakObjectPtr<UPlayerExp_PlayerTracker> OwningPlayerTracker;
@@ -98,8 +119,34 @@ protected:
     UPROPERTY(Config)
     double HitchDetectionThreshold;
 
+    // Uploads cannot exceed this many periods between sends while they go unacknowledged.
+    UPROPERTY(Config)
+    int32 MaxUpdateToServerBackoff;
+
+    // After this many unacknowledged uploads the client stops delta encoding against its last acknowledged upload.
+    UPROPERTY(Config)
+    int32 MaxUnackedUploadsBeforeFullUpdate;
+
+    // Payload is a sequence header followed by FPlayerExp_StatAccumulator::SerializeCompact.
     UFUNCTION(unreliable, WithValidation, Server)
-    void ServerFrameTimeUpdate(const FPlayerExp_StatAccumulator& InFrameTimeStats, int32 InHitchesDetected);
+    void ServerCompactStatsUpdate(const TArray<uint8>& InPayload);
+
+    UFUNCTION(unreliable, Client)
+    void ClientAckStatsUpdate(uint32 InSequence);
+
+    // Client side upload state. Periods stay pending until the server acknowledges an upload containing them,
+    // so a lost upload is folded into the next one instead of dropping its data.
+    TArray<FPlayerExp_PendingStatPeriod> PendingStatPeriods;
+    TMap<uint32, FPlayerExp_StatAccumulator> SentStatPayloads;
+    FPlayerExp_StatAccumulator AckedStatPayload;
+    uint32 AckedStatSequence;
+    bool bSendFullStatUpdate;
+    uint32 NextStatSequence;
+    int32 ConsecutiveUnackedUploads;
+
+    // Server side upload state, applied payloads are kept for a few uploads as delta baselines.
+    TMap<uint32, FPlayerExp_StatAccumulator> AppliedStatPayloads;
+    uint32 LastAppliedStatSequence;
 
     UPROPERTY(Transient)
     APlayerController* CachedPCOwner;
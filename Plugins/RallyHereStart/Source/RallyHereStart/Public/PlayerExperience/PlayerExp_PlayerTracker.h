@@ -109,6 +109,18 @@ protected:
     UPROPERTY()
     int32 NumServerCorrections;
 
+    // The number of stat upload payload bytes received from the player.
+    UPROPERTY()
+    int32 StatUploadBytes;
+
+    // The number of stat uploads received from the player.
+    UPROPERTY()
+    int32 StatUploadCount;
+
+    // The number of stat uploads from the player that were discarded.
+    UPROPERTY()
+    int32 StatUploadsRejected;
+
     UPROPERTY(Config)
     TSubclassOf<UPlayerExp_PlayerComponent> PlayerComponentClass;
 
@@ -327,6 +327,127 @@ public:
         bOutSuccess = true;
         return true;
     }
+
+    // Compact wire format used for client stat uploads.
+    // Counts are variable length, min/max are quantized to CompactQuantizationScale steps, sums are sent as floats,
+    // and histogram bins are delta encoded against Baseline (or against an empty histogram when Baseline is null).
+    void SerializeCompact(FArchive& Ar, const FPlayerExp_StatAccumulator* Baseline)
+    {
+        static const double CompactQuantizationScale = 100.0;
+
+        auto SerializePackedInt32 = [&Ar](int32& Value)
+        {
+            uint32 Packed = (uint32)FMath::Max(Value, 0);
+            Ar.SerializeIntPacked(Packed);
+            Value = (int32)FMath::Min<uint32>(Packed, MAX_int32);
+        };
+
+        // zig-zag so small negative bin deltas stay small on the wire
+        auto SerializePackedDelta = [&Ar](int32& Delta)
+        {
+            uint32 ZigZag = (uint32)((Delta << 1) ^ (Delta >> 31));
+            Ar.SerializeIntPacked(ZigZag);
+            Delta = (int32)(ZigZag >> 1) ^ -(int32)(ZigZag & 1);
+        };
+
+        auto SerializeQuantized = [&Ar](double& Value)
+        {
+            uint32 Quantized = (uint32)FMath::Clamp(FMath::RoundToDouble(Value * CompactQuantizationScale), 0.0, (double)MAX_uint32);
+            Ar.SerializeIntPacked(Quantized);
+            Value = Quantized / CompactQuantizationScale;
+        };
+
+        if (Baseline != nullptr && Baseline->Histogram.Num() != Histogram.Num())
+        {
+            Ar.SetError();
+            return;
+        }
+
+        SerializePackedInt32(UnderflowCount);
+        SerializePackedInt32(OverflowCount);
+        SerializePackedInt32(ValueCount);
+
+        if (Ar.IsLoading() && GetTotalSamples() <= 0)
+        {
+            Reset();
+            return;
+        }
+        else if (Ar.IsSaving() && GetTotalSamples() <= 0)
+        {
+            return;
+        }
+
+        SerializeQuantized(MinimumValue);
+        SerializeQuantized(MaximumValue);
+
+        float SumXAsFloat = (float)SumX;
+        float SumXSquaredAsFloat = (float)SumXSquared;
+        Ar << SumXAsFloat;
+        Ar << SumXSquaredAsFloat;
+        SumX = SumXAsFloat;
+        SumXSquared = SumXSquaredAsFloat;
+
+        // write the number of bins that differ from the baseline, then each one as (index gap, count delta)
+        int32 ChangedBinCount = 0;
+        if (Ar.IsSaving())
+        {
+            for (int32 Index = 0; Index < Histogram.Num(); Index++)
+            {
+                if (Histogram[Index] != (Baseline != nullptr ? Baseline->Histogram[Index] : 0))
+                {
+                    ChangedBinCount++;
+                }
+            }
+        }
+
+        SerializePackedInt32(ChangedBinCount);
+
+        if (Ar.IsSaving())
+        {
+            int32 PreviousIndex = -1;
+            for (int32 Index = 0; Index < Histogram.Num(); Index++)
+            {
+                int32 Delta = Histogram[Index] - (Baseline != nullptr ? Baseline->Histogram[Index] : 0);
+                if (Delta != 0)
+                {
+                    int32 IndexGap = Index - PreviousIndex - 1;
+                    SerializePackedInt32(IndexGap);
+                    SerializePackedDelta(Delta);
+                    PreviousIndex = Index;
+                }
+            }
+        }
+        else
+        {
+            if (Baseline != nullptr)
+            {
+                Histogram = Baseline->Histogram;
+            }
+            else
+            {
+                Histogram.Init(0, BinCount);
+            }
+
+            int32 PreviousIndex = -1;
+            for (int32 Count = 0; Count < ChangedBinCount && !Ar.IsError(); Count++)
+            {
+                int32 IndexGap = 0;
+                int32 Delta = 0;
+                SerializePackedInt32(IndexGap);
+                SerializePackedDelta(Delta);
+
+                const int32 Index = PreviousIndex + 1 + IndexGap;
+                if (!Histogram.IsValidIndex(Index))
+                {
+                    Ar.SetError();
+                    break;
+                }
+
+                Histogram[Index] = FMath::Max(Histogram[Index] + Delta, 0);
+                PreviousIndex = Index;
+            }
+        }
+    }
 };
 
 template<>
@@ -41,19 +41,12 @@ public:
         OnAsyncImageLoadComplete.Broadcast(this);
     }
     
-    virtual void CancelImageStreaming() override
-    {
-        if (StreamingHandle.IsValid())
-        {
-            Super::CancelImageStreaming();
-            OnAsyncImageLoadCanceled.Broadcast(this);
-            HideWaitingWidget();
-        }
-    }
+    virtual void CancelImageStreaming() override;
 
     virtual void SetBrush(const FSlateBrush& InBrush) override
     {
         Super::SetBrush(InBrush);
+        RefreshDisplayedTexture();
         HideWaitingWidget();
         OnAsyncImageBrushChanged.Broadcast(this);
     }
@@ -69,20 +62,17 @@ public:
     virtual void SetBrushFromAsset(USlateBrushAsset* Asset) override
     {
         Super::SetBrushFromAsset(Asset);
+        RefreshDisplayedTexture();
         HideWaitingWidget();
         OnAsyncImageBrushChanged.Broadcast(this);
     }
 
-    virtual void SetBrushFromTexture(UTexture2D* Texture, bool bMatchSize = false) override
-    {
-        Super::SetBrushFromTexture(Texture, bMatchSize);
-        HideWaitingWidget();
-        OnAsyncImageBrushChanged.Broadcast(this);
-    }
+    virtual void SetBrushFromTexture(UTexture2D* Texture, bool bMatchSize = false) override;
 
     virtual void SetBrushFromAtlasInterface(TScriptInterface<ISlateTextureAtlasInterface> AtlasRegion, bool bMatchSize = false) override
     {
         Super::SetBrushFromAtlasInterface(AtlasRegion, bMatchSize);
+        RefreshDisplayedTexture();
         HideWaitingWidget();
         OnAsyncImageBrushChanged.Broadcast(this);
     }
@@ -90,6 +80,7 @@ public:
     virtual void SetBrushFromTextureDynamic(UTexture2DDynamic* Texture, bool bMatchSize = false) override
     {
         Super::SetBrushFromTextureDynamic(Texture, bMatchSize);
+        RefreshDisplayedTexture();
         HideWaitingWidget();
         OnAsyncImageBrushChanged.Broadcast(this);
     }
@@ -97,6 +88,7 @@ public:
     virtual void SetBrushFromMaterial(UMaterialInterface* Material) override
     {
         Super::SetBrushFromMaterial(Material);
+        RefreshDisplayedTexture();
         HideWaitingWidget();
         OnAsyncImageBrushChanged.Broadcast(this);
     }
@@ -122,6 +114,8 @@ public:
 	UFUNCTION(BlueprintPure)
 	bool IsCurrentlyAsyncLoading() const { return StreamingHandle.IsValid(); };
 
+	virtual void BeginDestroy() override;
+
 	protected:
 	UFUNCTION(BlueprintSetter)
 	void SetMaterialToUse(UMaterialInstanceDynamic* InMID);
@@ -131,6 +125,12 @@ public:
 
 	void InternalSetBrushFromItemTexture(UTexture2D* StrongTexture, bool bMatchSize);
 
+	// Applies a loaded texture or material from an item or icon path, textures go through the filter material if there is one
+	void InternalSetBrushFromItemObject(UObject* StrongObject, bool bMatchSize);
+
+	// Loads SoftPath through the shared image request broker, so every image waiting on the same asset shares one streamable handle
+	void RequestSharedAsyncLoad(const FSoftObjectPath& SoftPath, TFunction<void(UObject*)>&& OnLoaded);
+
 public:
 	UFUNCTION(BlueprintCallable, Category="Waiting Widget")
 	void SetWaitingWidget(UWidget* InWaitingWidget);
@@ -153,6 +153,23 @@ public:
 
 private:
 	friend class UImageIconInfo;
+	friend class FRHAsyncImageRequestBroker;
+	friend class FRHAsyncImageSharedRequestTest;
+
+	// Called by the broker once the shared load this image was waiting on has finished
+	void CompleteSharedAsyncLoad(UObject* LoadedObject, const TFunction<void(UObject*)>& OnLoaded);
+
+	// Path this image is waiting on from the broker, null if it is not waiting on a shared load
+	FSoftObjectPath SharedLoadPath;
+
+	// Moves this image's reference in the broker's resident texture budget to the given texture, the texture now on the brush
+	void SetDisplayedTexture(UTexture2D* Texture);
+
+	// Works out the texture shown by the current brush, directly or through the filter material, and references it
+	void RefreshDisplayedTexture();
+
+	// Texture this image holds a reference on in the broker, a texture is only released from the budget once no image displays it
+	TWeakObjectPtr<UTexture2D> DisplayedTexture;
 
 	static const FName DefaultTextureParameterName;
 };
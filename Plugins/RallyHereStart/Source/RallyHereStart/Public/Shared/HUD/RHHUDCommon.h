@@ -48,6 +48,43 @@ public:
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPreferredRegionUpdated);
 
+// Cached entry for a matchmaking region, rebuilt whenever the matchmaking browser cache reports new regions
+USTRUCT(BlueprintType)
+struct FRHRegionInfo
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "Region Info")
+	FString RegionId;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Region Info")
+	FText Name;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Region Info")
+	int32 SortOrder;
+
+	// Last reported ping to the region in milliseconds, or INDEX_NONE if it has not been measured
+	UPROPERTY(BlueprintReadOnly, Category = "Region Info")
+	int32 PingMs;
+
+	FRHRegionInfo() :
+		SortOrder(0),
+		PingMs(INDEX_NONE)
+	{ }
+};
+
+// Local player identity resolved from the owning player controller, kept until the local player's login changes
+struct FRHHUDLocalPlayerIdentity
+{
+	TWeakObjectPtr<class URH_LocalPlayerSubsystem> LocalPlayerSubsystem;
+	TWeakObjectPtr<URH_PlayerInfoSubsystem> PlayerInfoSubsystem;
+	TWeakObjectPtr<URH_PlayerInfo> LocalPlayerInfo;
+	FGuid PlayerUuid;
+	FRH_PlayerPlatformId PlayerPlatformId;
+	bool bIsValid = false;
+};
+
 UCLASS(config = Game)
 class RALLYHERESTART_API ARHHUDCommon : public AHUD
 {
@@ -113,6 +150,24 @@ public:
     UFUNCTION(BlueprintPure, Category = "Preferred Region Id")
     void GetRegionList(TMap<FString, FText>& OutRegionIdToNameMap) const;
 
+	// Returns the regions ordered by their configured sort order
+	UFUNCTION(BlueprintPure, Category = "Preferred Region Id")
+	const TArray<FRHRegionInfo>& GetSortedRegions() const;
+
+	// Returns the regions ordered by ping, regions without a measured ping are placed last in sort order
+	UFUNCTION(BlueprintPure, Category = "Preferred Region Id")
+	void GetRegionsSortedByPing(TArray<FRHRegionInfo>& OutRegions) const;
+
+	UFUNCTION(BlueprintPure, Category = "Preferred Region Id")
+	bool GetRegionInfo(const FString& RegionId, FRHRegionInfo& OutRegionInfo) const;
+
+	UFUNCTION(BlueprintPure, Category = "Preferred Region Id")
+	bool GetRegionName(const FString& RegionId, FText& OutRegionName) const;
+
+	// Stores a measured ping for the region so it can be sorted on without re-querying, kept across region list rebuilds
+	UFUNCTION(BlueprintCallable, Category = "Preferred Region Id")
+	void SetRegionPing(const FString& RegionId, int32 PingMs);
+
     UPROPERTY(BlueprintAssignable, Category = "Preferred Region Id")
     FOnPreferredRegionUpdated OnPreferredRegionUpdated;
 
@@ -245,6 +300,28 @@ protected:
 
 private:
 	TWeakObjectPtr<URHPlayerInput> PlayerInput;
+
+	void OnLocalPlayerLoginChanged(ULocalPlayer* LocalPlayer);
+
+	// Returns the cached local player identity, resolving it from the owning player controller if needed
+	const FRHHUDLocalPlayerIdentity& GetLocalPlayerIdentity() const;
+	void InvalidateLocalPlayerIdentity();
+
+	mutable FRHHUDLocalPlayerIdentity LocalPlayerIdentity;
+
+	// Rebuilds the cached region list and lookups from the matchmaking browser cache
+	void RebuildRegionCache() const;
+
+	const FRHRegionInfo* FindCachedRegion(const FString& RegionId) const;
+
+	// Regions sorted by SortOrder, with lookups by region id into the list
+	mutable TArray<FRHRegionInfo> CachedRegions;
+	mutable TMap<FString, int32> CachedRegionIndexById;
+	mutable TMap<FString, FText> CachedRegionIdToNameMap;
+	mutable bool bRegionCacheDirty;
+
+	// Pings are reported independently of the region list, so they are kept separately and applied on rebuild
+	TMap<FString, int32> RegionPingsById;
     /*
     * Text Chat controls pass through
     */
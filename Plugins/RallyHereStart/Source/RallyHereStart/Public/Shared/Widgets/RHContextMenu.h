@@ -85,6 +85,35 @@ enum class EViewSide : uint8
 * Player Context Menu
 */
 
+// Relationship state between the local player and the menu's target player, resolved once and shared by every button's visibility check
+struct FRHContextMenuTargetState
+{
+	bool bIsValid = false;
+
+	bool bIsLocalPlayer = false;
+	bool bIsCrossplayEnabled = false;
+	bool bIsPlayerOnline = false;
+
+	bool bIsFriend = false;
+	bool bIsRHFriend = false;
+	bool bIsRequestingFriend = false;
+	bool bIsPendingFriend = false;
+
+	bool bIsMuted = false;
+	bool bIsInVoiceChannel = false;
+	bool bIsIgnored = false;
+	bool bIsBlockedByRH = false;
+	bool bIsBlockedByPlatform = false;
+
+	bool bIsInParty = false;
+	bool bIsPartyFull = false;
+	bool bIsPartyLeader = false;
+	bool bCanInvitePlayer = false;
+	bool bHasPlayerInvited = false;
+	bool bIsPlayerInParty = false;
+	bool bIsPlayerPendingPartyInvite = false;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnContextOptionsUpdated);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnReportPlayer, class URH_RHFriendAndPlatformFriend*, ReportedPlayerTarget);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnContextOptionCompleted, bool, Succeeded);
@@ -97,6 +126,7 @@ class RALLYHERESTART_API URHContextMenu : public URHWidget
 public:
 	
 	virtual void InitializeWidget_Implementation() override;
+	virtual void UninitializeWidget_Implementation() override;
 
 	UFUNCTION(BlueprintCallable, Category = "Context Menu")
 	void SetCurrentFriend(class URH_RHFriendAndPlatformFriend* Friend);
@@ -137,11 +167,26 @@ protected:
 
 	void SetOptionsActive();
 	void SetContextButtonActive(EPlayerContextOptions ContextOption, bool IsActive);
-	void SetContextButtonVisibility(class URHContextMenuButton* ContextButton);
+	void SetContextButtonVisibility(class URHContextMenuButton* ContextButton, const FRHContextMenuTargetState& TargetState);
 
 	UFUNCTION()
 	void HandleOnQueueStatusChange(ERH_MatchStatus QueueStatus);
 
+	// Returns the target's relationship state, resolving it if it has been invalidated since it was last used
+	const FRHContextMenuTargetState& GetTargetState();
+	void InvalidateTargetState();
+
+	void HandleFriendUpdated(class URH_RHFriendAndPlatformFriend* UpdatedFriend);
+	void HandleFriendListUpdated(const TArray<class URH_RHFriendAndPlatformFriend*>& UpdatedFriends);
+	void HandleBlockedPlayerUpdated(const FGuid& PlayerUuid, bool bBlocked);
+
+	UFUNCTION()
+	void HandlePartyUpdated();
+	UFUNCTION()
+	void HandlePartyMemberStatusChanged(const FGuid& PlayerId);
+	UFUNCTION()
+	void HandlePartyInvitationReceived(URH_PlayerInfo* Inviter);
+
 	UPROPERTY(BlueprintAssignable, Category = "Context Menu")
 	FOnContextOptionsUpdated OnContextOptionsUpdated;
 
@@ -182,6 +227,8 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Context Menu")
 	bool bCachedReportedPlayer;
 
+	FRHContextMenuTargetState TargetState;
+
 private:
 	bool IsLobbyOptionVisible(EPlayerContextOptions ContextOption);
 	void UpdateFriendChecks();
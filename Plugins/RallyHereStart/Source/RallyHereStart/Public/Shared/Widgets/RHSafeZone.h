@@ -44,7 +44,23 @@ public:
 	// UWidget interface
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 	virtual void SynchronizeProperties() override;
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 	// End of UWidget interface
+
+	/** Refreshes the borders of every live safe zone, used when rh.SafeZone.DrawBorders changes */
+	static void RefreshAllBorders();
+
+	/** Number of safe zones with a live Slate widget, which are the ones refreshed on a safe frame change */
+	static int32 GetNumRegisteredSafeZones();
+
+private:
+	friend class FRHSafeZoneRegistry;
+
+	// Applies the current border settings to the slate widget
+	void RefreshBorders();
+
+	// Invalidates the slate widget after the safe frame changed
+	void InvalidateSafeArea();
 };
 
 /*
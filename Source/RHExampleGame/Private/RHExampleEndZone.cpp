@@ -2,6 +2,7 @@
 #include "RHExampleEndZone.h"
 #include "GameFramework/RHGameModeBase.h"
 #include "Components/PrimitiveComponent.h"
+#include "TimerManager.h"
 
 
 void ARHExampleEndZone::AddPrimitiveToPawnOverlapCheck(UPrimitiveComponent* InPrimitive)
@@ -27,11 +28,12 @@ void ARHExampleEndZone::AddPrimitiveToPawnOverlapCheck(UPrimitiveComponent* InPr
 
 		if (IsActorInitialized())
 		{
-			TArray<AActor*> OverlappingActors;
-			InPrimitive->GetOverlappingActors(OverlappingActors, AActor::StaticClass());
-			for (AActor* pActor : OverlappingActors)
+			// Count every component pair already overlapping, matching what the begin overlap events would have counted
+			TArray<UPrimitiveComponent*> OverlappingComponents;
+			InPrimitive->GetOverlappingComponents(OverlappingComponents);
+			for (UPrimitiveComponent* pComponent : OverlappingComponents)
 			{
-				ACharacter* pCharacter = Cast<ACharacter>(pActor);
+				ACharacter* pCharacter = pComponent != nullptr ? Cast<ACharacter>(pComponent->GetOwner()) : nullptr;
 				if (pCharacter != nullptr)
 				{
 					AddOverlappingPawnPrivate(pCharacter);
@@ -43,14 +45,9 @@ void ARHExampleEndZone::AddPrimitiveToPawnOverlapCheck(UPrimitiveComponent* InPr
 
 void ARHExampleEndZone::RemovePrimitiveToPawnOverlapCheck(UPrimitiveComponent* InPrimitive)
 {
-	if (InPrimitive != nullptr)
+	if (InPrimitive != nullptr && RegisteredPawnOverlapComponents.Remove(InPrimitive) > 0)
 	{
-		int32 nIndex = RegisteredPawnOverlapComponents.Find(InPrimitive);
-		if (nIndex != INDEX_NONE)
-		{
-			InternalRemovePrimitiveToPawnOverlapCheck(InPrimitive);
-			RegisteredPawnOverlapComponents.RemoveAtSwap(nIndex);
-		}
+		InternalRemovePrimitiveToPawnOverlapCheck(InPrimitive);
 	}
 }
 
@@ -72,6 +69,17 @@ void ARHExampleEndZone::UpdateStateFull()
 	}
 }
 
+void ARHExampleEndZone::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bStateUpdatePending)
+	{
+		GetWorldTimerManager().ClearTimer(PendingStateUpdateHandle);
+		bStateUpdatePending = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ARHExampleEndZone::OnBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
 	if (RegisteredPawnOverlapComponents.Contains(OverlappedComponent))
@@ -82,22 +90,22 @@ void ARHExampleEndZone::OnBeginOverlap(UPrimitiveComponent* OverlappedComponent,
 
 void ARHExampleEndZone::OnEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
 {
+	// Every begin overlap took a reference, so the pawn only leaves once its last overlapping pair ends
 	if (RegisteredPawnOverlapComponents.Contains(OverlappedComponent))
 	{
-		ACharacter* pCharacter = Cast<ACharacter>(OtherActor);
-		if (pCharacter != nullptr && !IsOverlappingOtherComponent(OtherActor, OverlappedComponent))
-		{
-			RemoveOverlappingPawnPrivate(pCharacter);
-		}
+		RemoveOverlappingPawnPrivate(Cast<ACharacter>(OtherActor));
 	}
 }
 
 void ARHExampleEndZone::AddOverlappingPawnPrivate(ACharacter* InCharacter)
 {
-	if (InCharacter != nullptr && !OverlappingPawns.Contains(InCharacter))
+	if (InCharacter != nullptr)
 	{
-		OverlappingPawns.Add(InCharacter);
-		UpdateStateFull();
+		int32& OverlapCount = PawnOverlapCounts.FindOrAdd(InCharacter);
+		if (OverlapCount++ == 0)
+		{
+			RequestStateUpdate();
+		}
 	}
 }
 
@@ -105,11 +113,11 @@ void ARHExampleEndZone::RemoveOverlappingPawnPrivate(ACharacter* InCharacter)
 {
 	if (InCharacter != nullptr)
 	{
-		int32 nIndex = OverlappingPawns.Find(InCharacter);
-		if (nIndex != INDEX_NONE)
+		int32* OverlapCount = PawnOverlapCounts.Find(InCharacter);
+		if (OverlapCount != nullptr && --(*OverlapCount) <= 0)
 		{
-			OverlappingPawns.RemoveAtSwap(nIndex);
-			UpdateStateFull();
+			PawnOverlapCounts.Remove(InCharacter);
+			RequestStateUpdate();
 		}
 	}
 }
@@ -123,35 +131,49 @@ void ARHExampleEndZone::InternalRemovePrimitiveToPawnOverlapCheck(UPrimitiveComp
 
 		if (IsActorInitialized())
 		{
-			TArray<AActor*> OverlappingActors;
-			InPrimitive->GetOverlappingActors(OverlappingActors, ARHExampleEndZone::StaticClass());
-			for (AActor* pActor : OverlappingActors)
+			// Release the references this primitive's overlapping pairs held
+			TArray<UPrimitiveComponent*> OverlappingComponents;
+			InPrimitive->GetOverlappingComponents(OverlappingComponents);
+			for (UPrimitiveComponent* pComponent : OverlappingComponents)
 			{
-				ACharacter* pCharacter = Cast<ACharacter>(pActor);
+				ACharacter* pCharacter = pComponent != nullptr ? Cast<ACharacter>(pComponent->GetOwner()) : nullptr;
 				if (pCharacter != nullptr)
 				{
-					if (!IsOverlappingOtherComponent(pActor, InPrimitive))
-					{
-						RemoveOverlappingPawnPrivate(pCharacter);
-					}
+					RemoveOverlappingPawnPrivate(pCharacter);
 				}
 			}
 		}
 	}
 }
 
-bool ARHExampleEndZone::IsOverlappingOtherComponent(AActor* InActor, UPrimitiveComponent* InExcludeComponent) const
+void ARHExampleEndZone::RequestStateUpdate()
 {
-	if (InActor != nullptr)
+	if (bStateUpdatePending)
 	{
-		for (const UPrimitiveComponent* pPrimitive : RegisteredPawnOverlapComponents)
+		return;
+	}
+
+	if (UWorld* pWorld = GetWorld())
+	{
+		bStateUpdatePending = true;
+		++NumStateUpdatesQueued;
+		PendingStateUpdateHandle = pWorld->GetTimerManager().SetTimerForNextTick(this, &ARHExampleEndZone::FlushStateUpdate);
+	}
+}
+
+void ARHExampleEndZone::FlushStateUpdate()
+{
+	bStateUpdatePending = false;
+	PendingStateUpdateHandle.Invalidate();
+
+	// Drop pawns that were destroyed without an end overlap reaching us
+	for (auto It = PawnOverlapCounts.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
 		{
-			if (pPrimitive != nullptr && pPrimitive != InExcludeComponent && pPrimitive->IsOverlappingActor(InActor))
-			{
-				return true;
-			}
+			It.RemoveCurrent();
 		}
 	}
 
-	return false;
+	UpdateStateFull();
 }
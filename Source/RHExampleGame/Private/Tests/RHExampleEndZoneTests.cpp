@@ -0,0 +1,116 @@
+// Copyright 2022-2023 Rally Here Interactive, Inc. All Rights Reserved.
+
+#include "RHExampleGame.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "RHExampleEndZone.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRHExampleEndZoneOverlapTest, "RHExampleGame.EndZone.OverlapBookkeeping", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FRHExampleEndZoneOverlapTest::RunTest(const FString& Parameters)
+{
+	const int32 NumPawns = 200;
+	const int32 NumPrimitives = 4;
+
+	// A world of its own with no game mode, so an evaluation that does get flushed cannot end a match
+	UWorld* pWorld = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(pWorld);
+	pWorld->InitializeActorsForPlay(FURL());
+
+	ARHExampleEndZone* pEndZone = pWorld->SpawnActor<ARHExampleEndZone>();
+	if (!TestNotNull(TEXT("End zone was spawned"), pEndZone))
+	{
+		GEngine->DestroyWorldContext(pWorld);
+		pWorld->DestroyWorld(false);
+		return false;
+	}
+
+	for (int32 i = 0; i < NumPrimitives; ++i)
+	{
+		UBoxComponent* pBox = NewObject<UBoxComponent>(pEndZone);
+		pBox->SetCollisionResponseToAllChannels(ECR_Ignore);
+		pBox->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+		pBox->RegisterComponent();
+		pEndZone->AddPrimitiveToPawnOverlapCheck(pBox);
+	}
+	TestEqual(TEXT("Registered primitives"), pEndZone->RegisteredPawnOverlapComponents.Num(), NumPrimitives);
+
+	// Spawn the pawns far away with collision off, so the only overlaps they get are the simulated ones below
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	TArray<ACharacter*> Pawns;
+	Pawns.Reserve(NumPawns);
+	for (int32 i = 0; i < NumPawns; ++i)
+	{
+		const FVector SpawnLocation(0.0f, 0.0f, -100000.0f - i * 200.0f);
+		if (ACharacter* pCharacter = pWorld->SpawnActor<ACharacter>(ACharacter::StaticClass(), SpawnLocation, FRotator::ZeroRotator, SpawnParams))
+		{
+			pCharacter->SetActorEnableCollision(false);
+			Pawns.Add(pCharacter);
+		}
+	}
+	TestEqual(TEXT("Pawns spawned"), Pawns.Num(), NumPawns);
+
+	const int32 StartStateUpdatesQueued = pEndZone->NumStateUpdatesQueued;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Every pawn enters every primitive
+	for (ACharacter* pCharacter : Pawns)
+	{
+		for (UPrimitiveComponent* pPrimitive : pEndZone->RegisteredPawnOverlapComponents)
+		{
+			pEndZone->OnBeginOverlap(pPrimitive, pCharacter, pCharacter->GetCapsuleComponent(), 0, false, FHitResult());
+		}
+	}
+
+	int32 NumMiscounted = 0;
+	for (ACharacter* pCharacter : Pawns)
+	{
+		const int32* OverlapCount = pEndZone->PawnOverlapCounts.Find(pCharacter);
+		if (OverlapCount == nullptr || *OverlapCount != NumPrimitives)
+		{
+			++NumMiscounted;
+		}
+	}
+
+	// Every pawn leaves every primitive, it has to stay counted until the last one
+	int32 NumLeftEarly = 0;
+	for (ACharacter* pCharacter : Pawns)
+	{
+		int32 NumLeft = NumPrimitives;
+		for (UPrimitiveComponent* pPrimitive : pEndZone->RegisteredPawnOverlapComponents)
+		{
+			pEndZone->OnEndOverlap(pPrimitive, pCharacter, pCharacter->GetCapsuleComponent(), 0);
+			if (pEndZone->PawnOverlapCounts.Contains(pCharacter) != (--NumLeft > 0))
+			{
+				++NumLeftEarly;
+			}
+		}
+	}
+
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	const int32 NumQueued = pEndZone->NumStateUpdatesQueued - StartStateUpdatesQueued;
+
+	TestEqual(TEXT("Pawns whose overlap count did not match the primitives they entered"), NumMiscounted, 0);
+	TestEqual(TEXT("Pawns that left or stayed at the wrong end overlap"), NumLeftEarly, 0);
+	TestTrue(TEXT("All changes within a frame queued at most one evaluation"), NumQueued <= 1);
+	TestEqual(TEXT("Pawns still counted after leaving every primitive"), pEndZone->PawnOverlapCounts.Num(), 0);
+
+	AddInfo(FString::Printf(TEXT("%d pawns across %d primitives: %d overlap events in %.2f ms, %d evaluations queued"),
+		Pawns.Num(), NumPrimitives, Pawns.Num() * NumPrimitives * 2, ElapsedMs, NumQueued));
+
+	GEngine->DestroyWorldContext(pWorld);
+	pWorld->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
@@ -21,7 +21,10 @@ public:
 	UFUNCTION()
 	virtual void UpdateStateFull();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
+	friend class FRHExampleEndZoneOverlapTest;
 
 	UFUNCTION()
 	void OnBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -35,12 +38,20 @@ private:
 
 	void InternalRemovePrimitiveToPawnOverlapCheck(UPrimitiveComponent* InPrimitive);
 
-	bool IsOverlappingOtherComponent(AActor* InActor, UPrimitiveComponent* InExcludeComponent) const;
+	// Queues UpdateStateFull for the next tick, so any number of overlap changes in a frame are evaluated once
+	void RequestStateUpdate();
 
-	UPROPERTY()
-	TArray<UPrimitiveComponent*> RegisteredPawnOverlapComponents;
+	void FlushStateUpdate();
 
 	UPROPERTY()
-	TArray<ACharacter*> OverlappingPawns;
+	TSet<UPrimitiveComponent*> RegisteredPawnOverlapComponents;
+
+	// Number of overlapping (zone primitive, pawn component) pairs per pawn, a pawn is in the zone while its count is above zero
+	TMap<TWeakObjectPtr<ACharacter>, int32> PawnOverlapCounts;
+
+	FTimerHandle PendingStateUpdateHandle;
+	bool bStateUpdatePending = false;
 
+	// Number of times an evaluation was queued, used to verify changes within a frame coalesce
+	int32 NumStateUpdatesQueued = 0;
 };